@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+"""
+@file   fontpack.py
+@brief  Converts the tImage font tables in USER/Fonts into the packed
+        tPackedFont format and reports the flash saved
+
+Each glyph of a tImage font is a separate byte padded bitmap, reached
+through a tChar and a tImage struct. The packed font stores every glyph
+in one bit stream, rows width bits long with no padding, plus a width
+and a bit offset table indexed by character code.
+
+Usage:
+   fontpack.py [-k KERNFILE] [-d CHAR] [-o OUT.c] FONT.c NAME
+
+   FONT.c    tImage font source, eg. USER/Fonts/FixedSys8_14.c
+   NAME      name of the tPackedFont, eg. PackedFixedSys8_14
+   KERNFILE  optional kerning pairs, one per line: "AV -1"
+   CHAR      drawn for codes the font does not have, default '?'
+   OUT.c     output file, default stdout
+
+The size report is written to stderr, and as a comment in the output.
+"""
+
+import argparse
+import re
+import sys
+
+# Sizes on Cortex-M3, used for the size report
+PTR_SIZE = 4
+TIMAGE_SIZE = 8             # pointer plus three bytes, padded
+TCHAR_SIZE = 4 + PTR_SIZE   # long code plus pointer
+PACKED_HEADER_SIZE = 24     # tPackedFont
+KERN_PAIR_SIZE = 3
+MAX_BITS = 0x10000          # offsets are 16 bit
+
+
+def parse_font(text):
+    """Returns {code: (width, height, [row bytes])} from a tImage font source"""
+    data = {}
+    for m in re.finditer(r"image_data_(\w+)\[\d+\]\s*=\s*\{([^}]*)\}", text):
+        data[m.group(1)] = [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+", m.group(2))]
+
+    images = {}
+    for m in re.finditer(r"static const tImage (\w+)\s*=\s*\{\s*image_data_(\w+),\s*(\d+),\s*(\d+),\s*\d+\s*\}", text):
+        images[m.group(1)] = (int(m.group(3)), int(m.group(4)), data[m.group(2)])
+
+    glyphs = {}
+    array = re.search(r"static const tChar \w+\[\]\s*=\s*\{(.*?)\n\};", text, re.S)
+    if array is None:
+        sys.exit("no tChar array found")
+    for m in re.finditer(r"\{\s*(0x[0-9a-fA-F]+),\s*&(\w+)\s*\}", array.group(1)):
+        code = int(m.group(1), 16)
+        # The #else branches name images that do not exist
+        if m.group(2) in images and code not in glyphs:
+            glyphs[code] = images[m.group(2)]
+    return glyphs
+
+
+def parse_kern(path):
+    pairs = []
+    with open(path) as f:
+        for line in f:
+            line = line.rstrip("\n")
+            if line.strip() == "" or line.startswith("#"):
+                continue
+            if len(line) < 4 or line[2] != " ":
+                sys.exit("bad kerning line: %r" % line)
+            pairs.append((ord(line[0]), ord(line[1]), int(line[3:])))
+    return sorted(pairs)
+
+
+def pack(glyphs):
+    """Returns first, last, height, widths, offsets and packed bytes"""
+    first = min(glyphs)
+    last = max(glyphs)
+    heights = set(g[1] for g in glyphs.values())
+    if len(heights) != 1:
+        sys.exit("glyphs must all be the same height")
+    height = heights.pop()
+
+    widths = []
+    offsets = []
+    bits = []
+    for code in range(first, last + 1):
+        width, rows, data = glyphs.get(code, (0, height, []))
+        n_img = (width + 7) // 8
+        widths.append(width)
+        offsets.append(len(bits))
+        for row in range(rows):
+            for col in range(width):
+                byte = data[(row * n_img) + (col >> 3)]
+                bits.append((byte >> (7 - (col & 7))) & 1)
+
+    if len(bits) >= MAX_BITS:
+        sys.exit("font too large for 16 bit offsets")
+
+    packed = bytearray((len(bits) + 7) // 8)
+    for i, bit in enumerate(bits):
+        if bit:
+            packed[i >> 3] |= 0x80 >> (i & 7)
+    return first, last, height, widths, offsets, packed
+
+
+def size_report(name, glyphs, widths, offsets, packed, kern):
+    old_data = sum(((w + 7) // 8) * h for (w, h, _) in glyphs.values())
+    old = old_data + (len(glyphs) * (TIMAGE_SIZE + TCHAR_SIZE))
+    new = (len(packed) + len(widths) + (2 * len(offsets)) +
+           PACKED_HEADER_SIZE + (KERN_PAIR_SIZE * len(kern)))
+    return ["%s: %d glyphs" % (name, len(glyphs)),
+            "   tImage font  %5d bytes (%d bitmap, %d tImage + tChar)" %
+            (old, old_data, old - old_data),
+            "   packed font  %5d bytes (%d bits, %d widths, %d offsets, %d kerning)" %
+            (new, len(packed), len(widths), 2 * len(offsets), KERN_PAIR_SIZE * len(kern)),
+            "   saved        %5d bytes, %d%%" % (old - new, ((old - new) * 100) // old)]
+
+
+def c_array(values, fmt, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("   " + ", ".join(fmt % v for v in values[i:i + per_line]))
+    return ",\n".join(lines)
+
+
+def write_c(out, src, name, first, last, height, widths, offsets, packed, kern, default, report):
+    out.write("/**\n")
+    out.write("*  @file   %s.c\n" % name)
+    out.write("*  @brief  Packed font generated by Tools/fontpack.py from %s,\n" % src)
+    out.write("*          do not edit\n")
+    for line in report:
+        out.write("*          %s\n" % line)
+    out.write("*/\n\n")
+    out.write("#include <stdint.h>\n#include \"fonts.h\"\n\n")
+
+    out.write("static const uint8_t %s_bits[%d] = {\n%s\n   };\n\n" %
+              (name, len(packed), c_array(list(packed), "0x%02x", 12)))
+    out.write("static const uint8_t %s_widths[%d] = {\n%s\n   };\n\n" %
+              (name, len(widths), c_array(widths, "%2d", 16)))
+    out.write("static const uint16_t %s_offsets[%d] = {\n%s\n   };\n\n" %
+              (name, len(offsets), c_array(offsets, "%5d", 10)))
+    if kern:
+        out.write("static const tKernPair %s_kern[%d] = {\n%s\n   };\n\n" %
+                  (name, len(kern), c_array(kern, "{0x%02x, 0x%02x, %d}", 4)))
+
+    out.write("const tPackedFont %s = {\n" % name)
+    out.write("   0x%02x, 0x%02x, %d, %d,\n" % (first, last, height, max(widths)))
+    out.write("   %s_widths,\n   %s_offsets,\n   %s_bits,\n" % (name, name, name))
+    if kern:
+        out.write("   %s_kern, %d,\n" % (name, len(kern)))
+    else:
+        out.write("   0, 0,\n")
+    out.write("   0x%02x\n" % default)
+    out.write("   };\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pack a tImage font")
+    parser.add_argument("font")
+    parser.add_argument("name")
+    parser.add_argument("-k", "--kern")
+    parser.add_argument("-d", "--default", default="?")
+    parser.add_argument("-o", "--out")
+    args = parser.parse_args()
+
+    with open(args.font) as f:
+        glyphs = parse_font(f.read())
+    kern = parse_kern(args.kern) if args.kern else []
+    if len(kern) > 255:
+        sys.exit("too many kerning pairs")
+
+    first, last, height, widths, offsets, packed = pack(glyphs)
+    default = ord(args.default[0])
+    if default not in glyphs:
+        sys.exit("font has no default character %r" % args.default)
+    report = size_report(args.name, glyphs, widths, offsets, packed, kern)
+    sys.stderr.write("\n".join(report) + "\n")
+
+    src = args.font.replace("\\", "/").split("/")[-1]
+    out = open(args.out, "w", newline="\r\n") if args.out else sys.stdout
+    write_c(out, src, args.name, first, last, height, widths, offsets, packed, kern, default, report)
+    if args.out:
+        out.close()
+
+
+if __name__ == "__main__":
+    main()
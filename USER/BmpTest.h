@@ -1,20 +1,20 @@
-/**
-*  @file   BmpTest.h
-*  @author Rob Gee
-*  @date   November 2017
-*  @brief  Include file for Text rendering test module
-*/
-
-#ifndef __BMPTEST_H
-#define __BMPTEST_H
-
-/***** Constants  *************************************************/
-
-/***** Types      *************************************************/
-
-/***** Exported functions   ***************************************/
-void TextTest(t_ButtonEvent button_event);
-void GraphTest(t_ButtonEvent button_event);
-
-
-#endif /* __BMPTEST_H */
+/**
+*  @file   BmpTest.h
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Include file for Text rendering test module
+*/
+
+#ifndef __BMPTEST_H
+#define __BMPTEST_H
+
+/***** Constants  *************************************************/
+
+/***** Types      *************************************************/
+
+/***** Exported functions   ***************************************/
+void TextTest(t_ButtonEvent button_event);
+void GraphTest(t_ButtonEvent button_event);
+
+
+#endif /* __BMPTEST_H */
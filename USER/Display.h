@@ -1,20 +1,20 @@
-/**
-*  @file   Display.h
-*  @author Rob Gee
-*  @date   November 2017
-*  @brief  Generic include file for graphics display
-*/
-
-#ifndef __DISPLAY_H
-#define __DISPLAY_H
-
-#include "Video.h"
-
-
-/***** Constants  *************************************************/
-
-/***** Types      *************************************************/
-
-/***** Exported functions   ***************************************/
-
-#endif  /*  __DISPLAY_H  */
+/**
+*  @file   Display.h
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Generic include file for graphics display
+*/
+
+#ifndef __DISPLAY_H
+#define __DISPLAY_H
+
+#include "Video.h"
+
+
+/***** Constants  *************************************************/
+
+/***** Types      *************************************************/
+
+/***** Exported functions   ***************************************/
+
+#endif  /*  __DISPLAY_H  */
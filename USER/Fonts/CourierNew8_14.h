@@ -1,18 +1,19 @@
-/**
-*  @file   CourierNew8_14.h
-*  @author Rob Gee
-*  @date   November 2017
-*  @brief  Include file for courier new 8x14
-*/
-
-#ifndef __COURIERNEW_8_14_H
-#define __COURIERNEW_8_14_H
-
-const tChar* GetFontCourier_new8_14(uint8_t ASCII);
-
-
-#endif /*__COURIERNEW_8_14_H */
-
-
-
-
+/**
+*  @file   CourierNew8_14.h
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Include file for courier new 8x14
+*/
+
+#ifndef __COURIERNEW_8_14_H
+#define __COURIERNEW_8_14_H
+
+const tChar* GetFontCourier_new8_14(uint8_t ASCII);
+extern const tPackedFont PackedCourierNew8_14;
+
+
+#endif /*__COURIERNEW_8_14_H */
+
+
+
+
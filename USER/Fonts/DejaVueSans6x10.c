@@ -1,2429 +1,2431 @@
-
-/*******************************************************************************
-* font
-* filename: unsaved
-* name: DejaVueSans6x10
-* family: DejaVu Sans Mono
-* size: 10
-* style: Normal
-* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
-* antialiasing: no
-* type: proportional
-* encoding: ASMO-708
-* unicode bom: no
-*
-* preset name: Monochrome_TB
-* data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
-* conversion type: Monochrome, Edge 128
-* bits per pixel: 1
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: yes
-*******************************************************************************/
-
-/*
- typedef struct {
-     long int code;
-     const tImage *image;
-     } tChar;
- typedef struct {
-     int length;
-     const tChar *chars;
-     } tFont;
-*/
-
-#include <stdint.h>
-#include "fonts.h"
-
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x20[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x20 = { image_data_DejaVueSans6x10_0x20,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x21[10] = {
-    0x00, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x00, 
-    0x10, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x21 = { image_data_DejaVueSans6x10_0x21,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x22[10] = {
-    0x00, 
-    0x28, 
-    0x28, 
-    0x28, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x22 = { image_data_DejaVueSans6x10_0x22,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x23[10] = {
-    0x00, 
-    0x28, 
-    0x28, 
-    0x7c, 
-    0x50, 
-    0xf8, 
-    0x50, 
-    0x50, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x23 = { image_data_DejaVueSans6x10_0x23,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x24[10] = {
-    0x00, 
-    0x10, 
-    0x3c, 
-    0x50, 
-    0x70, 
-    0x1c, 
-    0x14, 
-    0x78, 
-    0x10, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x24 = { image_data_DejaVueSans6x10_0x24,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x25[10] = {
-    0x00, 
-    0xe0, 
-    0xa0, 
-    0xe8, 
-    0x30, 
-    0x5c, 
-    0x14, 
-    0x1c, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x25 = { image_data_DejaVueSans6x10_0x25,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x26[10] = {
-    0x00, 
-    0x38, 
-    0x20, 
-    0x30, 
-    0x54, 
-    0x4c, 
-    0x48, 
-    0x34, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x26 = { image_data_DejaVueSans6x10_0x26,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x27[10] = {
-    0x00, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x27 = { image_data_DejaVueSans6x10_0x27,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x28[10] = {
-    0x10, 
-    0x20, 
-    0x20, 
-    0x20, 
-    0x20, 
-    0x20, 
-    0x20, 
-    0x20, 
-    0x10, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x28 = { image_data_DejaVueSans6x10_0x28,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x29[10] = {
-    0x20, 
-    0x20, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x20, 
-    0x20, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x29 = { image_data_DejaVueSans6x10_0x29,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x2a[10] = {
-    0x00, 
-    0x54, 
-    0x38, 
-    0x38, 
-    0x54, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x2a = { image_data_DejaVueSans6x10_0x2a,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x2b[10] = {
-    0x00, 
-    0x00, 
-    0x10, 
-    0x10, 
-    0x7c, 
-    0x10, 
-    0x10, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x2b = { image_data_DejaVueSans6x10_0x2b,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x2c[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x20, 
-    0x20, 
-    0x20
-};
-static const tImage DejaVueSans6x10_0x2c = { image_data_DejaVueSans6x10_0x2c,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x2d[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x38, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x2d = { image_data_DejaVueSans6x10_0x2d,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x2e[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x20, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x2e = { image_data_DejaVueSans6x10_0x2e,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x2f[10] = {
-    0x00, 
-    0x04, 
-    0x08, 
-    0x08, 
-    0x10, 
-    0x10, 
-    0x20, 
-    0x20, 
-    0x40, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x2f = { image_data_DejaVueSans6x10_0x2f,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x30[10] = {
-    0x00, 
-    0x38, 
-    0x44, 
-    0x44, 
-    0x54, 
-    0x44, 
-    0x44, 
-    0x38, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x30 = { image_data_DejaVueSans6x10_0x30,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x31[10] = {
-    0x00, 
-    0x70, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x7c, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x31 = { image_data_DejaVueSans6x10_0x31,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x32[10] = {
-    0x00, 
-    0x38, 
-    0x44, 
-    0x04, 
-    0x0c, 
-    0x18, 
-    0x20, 
-    0x7c, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x32 = { image_data_DejaVueSans6x10_0x32,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x33[10] = {
-    0x00, 
-    0x38, 
-    0x44, 
-    0x04, 
-    0x38, 
-    0x04, 
-    0x44, 
-    0x38, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x33 = { image_data_DejaVueSans6x10_0x33,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x34[10] = {
-    0x00, 
-    0x08, 
-    0x18, 
-    0x28, 
-    0x68, 
-    0x7c, 
-    0x08, 
-    0x08, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x34 = { image_data_DejaVueSans6x10_0x34,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x35[10] = {
-    0x00, 
-    0x78, 
-    0x40, 
-    0x78, 
-    0x04, 
-    0x04, 
-    0x04, 
-    0x78, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x35 = { image_data_DejaVueSans6x10_0x35,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x36[10] = {
-    0x00, 
-    0x3c, 
-    0x60, 
-    0x40, 
-    0x78, 
-    0x44, 
-    0x44, 
-    0x38, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x36 = { image_data_DejaVueSans6x10_0x36,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x37[10] = {
-    0x00, 
-    0x7c, 
-    0x0c, 
-    0x08, 
-    0x08, 
-    0x10, 
-    0x10, 
-    0x20, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x37 = { image_data_DejaVueSans6x10_0x37,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x38[10] = {
-    0x00, 
-    0x38, 
-    0x44, 
-    0x44, 
-    0x38, 
-    0x44, 
-    0x44, 
-    0x38, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x38 = { image_data_DejaVueSans6x10_0x38,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x39[10] = {
-    0x00, 
-    0x38, 
-    0x44, 
-    0x44, 
-    0x3c, 
-    0x04, 
-    0x0c, 
-    0x78, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x39 = { image_data_DejaVueSans6x10_0x39,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x3a[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x20, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x20, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x3a = { image_data_DejaVueSans6x10_0x3a,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x3b[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x20, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x20, 
-    0x20, 
-    0x20
-};
-static const tImage DejaVueSans6x10_0x3b = { image_data_DejaVueSans6x10_0x3b,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x3c[10] = {
-    0x00, 
-    0x00, 
-    0x04, 
-    0x38, 
-    0x40, 
-    0x38, 
-    0x04, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x3c = { image_data_DejaVueSans6x10_0x3c,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x3d[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0xf8, 
-    0x00, 
-    0xf8, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x3d = { image_data_DejaVueSans6x10_0x3d,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x3e[10] = {
-    0x00, 
-    0x00, 
-    0x40, 
-    0x38, 
-    0x04, 
-    0x38, 
-    0x40, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x3e = { image_data_DejaVueSans6x10_0x3e,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x3f[10] = {
-    0x00, 
-    0x78, 
-    0x08, 
-    0x10, 
-    0x20, 
-    0x20, 
-    0x00, 
-    0x20, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x3f = { image_data_DejaVueSans6x10_0x3f,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x40[10] = {
-    0x00, 
-    0x38, 
-    0x24, 
-    0x5c, 
-    0x54, 
-    0x54, 
-    0x54, 
-    0x5c, 
-    0x20, 
-    0x18
-};
-static const tImage DejaVueSans6x10_0x40 = { image_data_DejaVueSans6x10_0x40,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x41[10] = {
-    0x00, 
-    0x10, 
-    0x10, 
-    0x28, 
-    0x28, 
-    0x38, 
-    0x44, 
-    0x44, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x41 = { image_data_DejaVueSans6x10_0x41,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x42[10] = {
-    0x00, 
-    0x78, 
-    0x44, 
-    0x44, 
-    0x78, 
-    0x44, 
-    0x44, 
-    0x78, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x42 = { image_data_DejaVueSans6x10_0x42,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x43[10] = {
-    0x00, 
-    0x3c, 
-    0x64, 
-    0x40, 
-    0x40, 
-    0x40, 
-    0x64, 
-    0x3c, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x43 = { image_data_DejaVueSans6x10_0x43,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x44[10] = {
-    0x00, 
-    0x78, 
-    0x4c, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x4c, 
-    0x78, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x44 = { image_data_DejaVueSans6x10_0x44,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x45[10] = {
-    0x00, 
-    0x7c, 
-    0x40, 
-    0x40, 
-    0x7c, 
-    0x40, 
-    0x40, 
-    0x7c, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x45 = { image_data_DejaVueSans6x10_0x45,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x46[10] = {
-    0x00, 
-    0x7c, 
-    0x40, 
-    0x40, 
-    0x7c, 
-    0x40, 
-    0x40, 
-    0x40, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x46 = { image_data_DejaVueSans6x10_0x46,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x47[10] = {
-    0x00, 
-    0x38, 
-    0x64, 
-    0x40, 
-    0x4c, 
-    0x44, 
-    0x64, 
-    0x3c, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x47 = { image_data_DejaVueSans6x10_0x47,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x48[10] = {
-    0x00, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x7c, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x48 = { image_data_DejaVueSans6x10_0x48,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x49[10] = {
-    0x00, 
-    0x7c, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x7c, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x49 = { image_data_DejaVueSans6x10_0x49,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x4a[10] = {
-    0x00, 
-    0x38, 
-    0x08, 
-    0x08, 
-    0x08, 
-    0x08, 
-    0x48, 
-    0x30, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x4a = { image_data_DejaVueSans6x10_0x4a,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x4b[10] = {
-    0x00, 
-    0x44, 
-    0x48, 
-    0x50, 
-    0x60, 
-    0x50, 
-    0x48, 
-    0x44, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x4b = { image_data_DejaVueSans6x10_0x4b,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x4c[10] = {
-    0x00, 
-    0x40, 
-    0x40, 
-    0x40, 
-    0x40, 
-    0x40, 
-    0x40, 
-    0x7c, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x4c = { image_data_DejaVueSans6x10_0x4c,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x4d[10] = {
-    0x00, 
-    0x44, 
-    0x6c, 
-    0x6c, 
-    0x54, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x4d = { image_data_DejaVueSans6x10_0x4d,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x4e[10] = {
-    0x00, 
-    0x44, 
-    0x64, 
-    0x64, 
-    0x54, 
-    0x4c, 
-    0x4c, 
-    0x44, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x4e = { image_data_DejaVueSans6x10_0x4e,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x4f[10] = {
-    0x00, 
-    0x38, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x38, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x4f = { image_data_DejaVueSans6x10_0x4f,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x50[10] = {
-    0x00, 
-    0x78, 
-    0x44, 
-    0x44, 
-    0x78, 
-    0x40, 
-    0x40, 
-    0x40, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x50 = { image_data_DejaVueSans6x10_0x50,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x51[10] = {
-    0x00, 
-    0x38, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x38, 
-    0x0c, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x51 = { image_data_DejaVueSans6x10_0x51,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x52[10] = {
-    0x00, 
-    0x78, 
-    0x44, 
-    0x44, 
-    0x78, 
-    0x4c, 
-    0x44, 
-    0x42, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x52 = { image_data_DejaVueSans6x10_0x52,
-    7, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x53[10] = {
-    0x00, 
-    0x38, 
-    0x44, 
-    0x40, 
-    0x38, 
-    0x04, 
-    0x44, 
-    0x38, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x53 = { image_data_DejaVueSans6x10_0x53,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x54[10] = {
-    0x00, 
-    0x7c, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x54 = { image_data_DejaVueSans6x10_0x54,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x55[10] = {
-    0x00, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x38, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x55 = { image_data_DejaVueSans6x10_0x55,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x56[10] = {
-    0x00, 
-    0x44, 
-    0x44, 
-    0x28, 
-    0x28, 
-    0x28, 
-    0x10, 
-    0x10, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x56 = { image_data_DejaVueSans6x10_0x56,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x57[10] = {
-    0x00, 
-    0x84, 
-    0xb4, 
-    0xb4, 
-    0x78, 
-    0x48, 
-    0x48, 
-    0x48, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x57 = { image_data_DejaVueSans6x10_0x57,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x58[10] = {
-    0x00, 
-    0x44, 
-    0x28, 
-    0x28, 
-    0x10, 
-    0x28, 
-    0x28, 
-    0x44, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x58 = { image_data_DejaVueSans6x10_0x58,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x59[10] = {
-    0x00, 
-    0x44, 
-    0x28, 
-    0x28, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x59 = { image_data_DejaVueSans6x10_0x59,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x5a[10] = {
-    0x00, 
-    0x7c, 
-    0x08, 
-    0x08, 
-    0x10, 
-    0x20, 
-    0x20, 
-    0x7c, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x5a = { image_data_DejaVueSans6x10_0x5a,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x5b[10] = {
-    0x30, 
-    0x20, 
-    0x20, 
-    0x20, 
-    0x20, 
-    0x20, 
-    0x20, 
-    0x20, 
-    0x30, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x5b = { image_data_DejaVueSans6x10_0x5b,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x5c[10] = {
-    0x00, 
-    0x40, 
-    0x20, 
-    0x20, 
-    0x10, 
-    0x10, 
-    0x08, 
-    0x08, 
-    0x04, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x5c = { image_data_DejaVueSans6x10_0x5c,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x5d[10] = {
-    0x30, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x30, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x5d = { image_data_DejaVueSans6x10_0x5d,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x5e[10] = {
-    0x00, 
-    0x20, 
-    0x50, 
-    0x88, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x5e = { image_data_DejaVueSans6x10_0x5e,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x5f[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0xfc
-};
-static const tImage DejaVueSans6x10_0x5f = { image_data_DejaVueSans6x10_0x5f,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x60[10] = {
-    0x40, 
-    0x20, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x60 = { image_data_DejaVueSans6x10_0x60,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x61[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x78, 
-    0x04, 
-    0x3c, 
-    0x44, 
-    0x7c, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x61 = { image_data_DejaVueSans6x10_0x61,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x62[10] = {
-    0x40, 
-    0x40, 
-    0x40, 
-    0x78, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x78, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x62 = { image_data_DejaVueSans6x10_0x62,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x63[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x38, 
-    0x40, 
-    0x40, 
-    0x40, 
-    0x38, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x63 = { image_data_DejaVueSans6x10_0x63,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x64[10] = {
-    0x04, 
-    0x04, 
-    0x04, 
-    0x3c, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x3c, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x64 = { image_data_DejaVueSans6x10_0x64,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x65[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x38, 
-    0x44, 
-    0x7c, 
-    0x40, 
-    0x3c, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x65 = { image_data_DejaVueSans6x10_0x65,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x66[10] = {
-    0x18, 
-    0x20, 
-    0x20, 
-    0x78, 
-    0x20, 
-    0x20, 
-    0x20, 
-    0x20, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x66 = { image_data_DejaVueSans6x10_0x66,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x67[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x3c, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x3c, 
-    0x04, 
-    0x38
-};
-static const tImage DejaVueSans6x10_0x67 = { image_data_DejaVueSans6x10_0x67,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x68[10] = {
-    0x40, 
-    0x40, 
-    0x40, 
-    0x78, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x68 = { image_data_DejaVueSans6x10_0x68,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x69[10] = {
-    0x10, 
-    0x00, 
-    0x00, 
-    0x30, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x7c, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x69 = { image_data_DejaVueSans6x10_0x69,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x6a[10] = {
-    0x10, 
-    0x00, 
-    0x00, 
-    0x70, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x60
-};
-static const tImage DejaVueSans6x10_0x6a = { image_data_DejaVueSans6x10_0x6a,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x6b[10] = {
-    0x40, 
-    0x40, 
-    0x40, 
-    0x48, 
-    0x50, 
-    0x70, 
-    0x48, 
-    0x44, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x6b = { image_data_DejaVueSans6x10_0x6b,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x6c[10] = {
-    0xe0, 
-    0x20, 
-    0x20, 
-    0x20, 
-    0x20, 
-    0x20, 
-    0x20, 
-    0x18, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x6c = { image_data_DejaVueSans6x10_0x6c,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x6d[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x7c, 
-    0x54, 
-    0x54, 
-    0x54, 
-    0x54, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x6d = { image_data_DejaVueSans6x10_0x6d,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x6e[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x78, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x6e = { image_data_DejaVueSans6x10_0x6e,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x6f[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x38, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x38, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x6f = { image_data_DejaVueSans6x10_0x6f,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x70[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x78, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x78, 
-    0x40, 
-    0x40
-};
-static const tImage DejaVueSans6x10_0x70 = { image_data_DejaVueSans6x10_0x70,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x71[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x3c, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x3c, 
-    0x04, 
-    0x04
-};
-static const tImage DejaVueSans6x10_0x71 = { image_data_DejaVueSans6x10_0x71,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x72[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x3c, 
-    0x24, 
-    0x20, 
-    0x20, 
-    0x20, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x72 = { image_data_DejaVueSans6x10_0x72,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x73[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x3c, 
-    0x40, 
-    0x3c, 
-    0x04, 
-    0x78, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x73 = { image_data_DejaVueSans6x10_0x73,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x74[10] = {
-    0x00, 
-    0x20, 
-    0x20, 
-    0x78, 
-    0x20, 
-    0x20, 
-    0x20, 
-    0x38, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x74 = { image_data_DejaVueSans6x10_0x74,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x75[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x44, 
-    0x3c, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x75 = { image_data_DejaVueSans6x10_0x75,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x76[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x44, 
-    0x28, 
-    0x28, 
-    0x28, 
-    0x10, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x76 = { image_data_DejaVueSans6x10_0x76,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x77[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x44, 
-    0x54, 
-    0x28, 
-    0x28, 
-    0x28, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x77 = { image_data_DejaVueSans6x10_0x77,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x78[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x6c, 
-    0x28, 
-    0x10, 
-    0x28, 
-    0x6c, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x78 = { image_data_DejaVueSans6x10_0x78,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x79[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x44, 
-    0x28, 
-    0x28, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x60
-};
-static const tImage DejaVueSans6x10_0x79 = { image_data_DejaVueSans6x10_0x79,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x7a[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x7c, 
-    0x08, 
-    0x10, 
-    0x20, 
-    0x7c, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x7a = { image_data_DejaVueSans6x10_0x7a,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x7b[10] = {
-    0x18, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x60, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x18, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x7b = { image_data_DejaVueSans6x10_0x7b,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x7c[10] = {
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x10
-};
-static const tImage DejaVueSans6x10_0x7c = { image_data_DejaVueSans6x10_0x7c,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x7d[10] = {
-    0x30, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x0c, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x30, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x7d = { image_data_DejaVueSans6x10_0x7d,
-    6, 10, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_DejaVueSans6x10_0x7e[10] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x70, 
-    0x0c, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage DejaVueSans6x10_0x7e = { image_data_DejaVueSans6x10_0x7e,
-    6, 10, 8};
-#endif
-
-
-static const tChar DejaVueSans6x10_array[] = {
-
-#if (0x0 == 0x0)
-  // character: ' '
-  {0x20, &DejaVueSans6x10_0x20},
-#else
-  // character: ' ' == ''
-  {0x20, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '!'
-  {0x21, &DejaVueSans6x10_0x21},
-#else
-  // character: '!' == ''
-  {0x21, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '"'
-  {0x22, &DejaVueSans6x10_0x22},
-#else
-  // character: '"' == ''
-  {0x22, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '#'
-  {0x23, &DejaVueSans6x10_0x23},
-#else
-  // character: '#' == ''
-  {0x23, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '$'
-  {0x24, &DejaVueSans6x10_0x24},
-#else
-  // character: '$' == ''
-  {0x24, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '%'
-  {0x25, &DejaVueSans6x10_0x25},
-#else
-  // character: '%' == ''
-  {0x25, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '&'
-  {0x26, &DejaVueSans6x10_0x26},
-#else
-  // character: '&' == ''
-  {0x26, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '''
-  {0x27, &DejaVueSans6x10_0x27},
-#else
-  // character: ''' == ''
-  {0x27, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '('
-  {0x28, &DejaVueSans6x10_0x28},
-#else
-  // character: '(' == ''
-  {0x28, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ')'
-  {0x29, &DejaVueSans6x10_0x29},
-#else
-  // character: ')' == ''
-  {0x29, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '*'
-  {0x2a, &DejaVueSans6x10_0x2a},
-#else
-  // character: '*' == ''
-  {0x2a, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '+'
-  {0x2b, &DejaVueSans6x10_0x2b},
-#else
-  // character: '+' == ''
-  {0x2b, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ','
-  {0x2c, &DejaVueSans6x10_0x2c},
-#else
-  // character: ',' == ''
-  {0x2c, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '-'
-  {0x2d, &DejaVueSans6x10_0x2d},
-#else
-  // character: '-' == ''
-  {0x2d, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '.'
-  {0x2e, &DejaVueSans6x10_0x2e},
-#else
-  // character: '.' == ''
-  {0x2e, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '/'
-  {0x2f, &DejaVueSans6x10_0x2f},
-#else
-  // character: '/' == ''
-  {0x2f, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '0'
-  {0x30, &DejaVueSans6x10_0x30},
-#else
-  // character: '0' == ''
-  {0x30, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '1'
-  {0x31, &DejaVueSans6x10_0x31},
-#else
-  // character: '1' == ''
-  {0x31, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '2'
-  {0x32, &DejaVueSans6x10_0x32},
-#else
-  // character: '2' == ''
-  {0x32, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '3'
-  {0x33, &DejaVueSans6x10_0x33},
-#else
-  // character: '3' == ''
-  {0x33, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '4'
-  {0x34, &DejaVueSans6x10_0x34},
-#else
-  // character: '4' == ''
-  {0x34, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '5'
-  {0x35, &DejaVueSans6x10_0x35},
-#else
-  // character: '5' == ''
-  {0x35, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '6'
-  {0x36, &DejaVueSans6x10_0x36},
-#else
-  // character: '6' == ''
-  {0x36, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '7'
-  {0x37, &DejaVueSans6x10_0x37},
-#else
-  // character: '7' == ''
-  {0x37, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '8'
-  {0x38, &DejaVueSans6x10_0x38},
-#else
-  // character: '8' == ''
-  {0x38, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '9'
-  {0x39, &DejaVueSans6x10_0x39},
-#else
-  // character: '9' == ''
-  {0x39, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ':'
-  {0x3a, &DejaVueSans6x10_0x3a},
-#else
-  // character: ':' == ''
-  {0x3a, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ';'
-  {0x3b, &DejaVueSans6x10_0x3b},
-#else
-  // character: ';' == ''
-  {0x3b, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '<'
-  {0x3c, &DejaVueSans6x10_0x3c},
-#else
-  // character: '<' == ''
-  {0x3c, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '='
-  {0x3d, &DejaVueSans6x10_0x3d},
-#else
-  // character: '=' == ''
-  {0x3d, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '>'
-  {0x3e, &DejaVueSans6x10_0x3e},
-#else
-  // character: '>' == ''
-  {0x3e, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '?'
-  {0x3f, &DejaVueSans6x10_0x3f},
-#else
-  // character: '?' == ''
-  {0x3f, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\x0040'
-  {0x40, &DejaVueSans6x10_0x40},
-#else
-  // character: '\x0040' == ''
-  {0x40, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'A'
-  {0x41, &DejaVueSans6x10_0x41},
-#else
-  // character: 'A' == ''
-  {0x41, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'B'
-  {0x42, &DejaVueSans6x10_0x42},
-#else
-  // character: 'B' == ''
-  {0x42, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'C'
-  {0x43, &DejaVueSans6x10_0x43},
-#else
-  // character: 'C' == ''
-  {0x43, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'D'
-  {0x44, &DejaVueSans6x10_0x44},
-#else
-  // character: 'D' == ''
-  {0x44, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'E'
-  {0x45, &DejaVueSans6x10_0x45},
-#else
-  // character: 'E' == ''
-  {0x45, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'F'
-  {0x46, &DejaVueSans6x10_0x46},
-#else
-  // character: 'F' == ''
-  {0x46, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'G'
-  {0x47, &DejaVueSans6x10_0x47},
-#else
-  // character: 'G' == ''
-  {0x47, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'H'
-  {0x48, &DejaVueSans6x10_0x48},
-#else
-  // character: 'H' == ''
-  {0x48, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'I'
-  {0x49, &DejaVueSans6x10_0x49},
-#else
-  // character: 'I' == ''
-  {0x49, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'J'
-  {0x4a, &DejaVueSans6x10_0x4a},
-#else
-  // character: 'J' == ''
-  {0x4a, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'K'
-  {0x4b, &DejaVueSans6x10_0x4b},
-#else
-  // character: 'K' == ''
-  {0x4b, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'L'
-  {0x4c, &DejaVueSans6x10_0x4c},
-#else
-  // character: 'L' == ''
-  {0x4c, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'M'
-  {0x4d, &DejaVueSans6x10_0x4d},
-#else
-  // character: 'M' == ''
-  {0x4d, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'N'
-  {0x4e, &DejaVueSans6x10_0x4e},
-#else
-  // character: 'N' == ''
-  {0x4e, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'O'
-  {0x4f, &DejaVueSans6x10_0x4f},
-#else
-  // character: 'O' == ''
-  {0x4f, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'P'
-  {0x50, &DejaVueSans6x10_0x50},
-#else
-  // character: 'P' == ''
-  {0x50, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Q'
-  {0x51, &DejaVueSans6x10_0x51},
-#else
-  // character: 'Q' == ''
-  {0x51, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'R'
-  {0x52, &DejaVueSans6x10_0x52},
-#else
-  // character: 'R' == ''
-  {0x52, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'S'
-  {0x53, &DejaVueSans6x10_0x53},
-#else
-  // character: 'S' == ''
-  {0x53, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'T'
-  {0x54, &DejaVueSans6x10_0x54},
-#else
-  // character: 'T' == ''
-  {0x54, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'U'
-  {0x55, &DejaVueSans6x10_0x55},
-#else
-  // character: 'U' == ''
-  {0x55, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'V'
-  {0x56, &DejaVueSans6x10_0x56},
-#else
-  // character: 'V' == ''
-  {0x56, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'W'
-  {0x57, &DejaVueSans6x10_0x57},
-#else
-  // character: 'W' == ''
-  {0x57, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'X'
-  {0x58, &DejaVueSans6x10_0x58},
-#else
-  // character: 'X' == ''
-  {0x58, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Y'
-  {0x59, &DejaVueSans6x10_0x59},
-#else
-  // character: 'Y' == ''
-  {0x59, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Z'
-  {0x5a, &DejaVueSans6x10_0x5a},
-#else
-  // character: 'Z' == ''
-  {0x5a, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '['
-  {0x5b, &DejaVueSans6x10_0x5b},
-#else
-  // character: '[' == ''
-  {0x5b, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\'
-  {0x5c, &DejaVueSans6x10_0x5c},
-#else
-  // character: '\' == ''
-  {0x5c, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ']'
-  {0x5d, &DejaVueSans6x10_0x5d},
-#else
-  // character: ']' == ''
-  {0x5d, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '^'
-  {0x5e, &DejaVueSans6x10_0x5e},
-#else
-  // character: '^' == ''
-  {0x5e, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '_'
-  {0x5f, &DejaVueSans6x10_0x5f},
-#else
-  // character: '_' == ''
-  {0x5f, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '`'
-  {0x60, &DejaVueSans6x10_0x60},
-#else
-  // character: '`' == ''
-  {0x60, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'a'
-  {0x61, &DejaVueSans6x10_0x61},
-#else
-  // character: 'a' == ''
-  {0x61, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'b'
-  {0x62, &DejaVueSans6x10_0x62},
-#else
-  // character: 'b' == ''
-  {0x62, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'c'
-  {0x63, &DejaVueSans6x10_0x63},
-#else
-  // character: 'c' == ''
-  {0x63, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'd'
-  {0x64, &DejaVueSans6x10_0x64},
-#else
-  // character: 'd' == ''
-  {0x64, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'e'
-  {0x65, &DejaVueSans6x10_0x65},
-#else
-  // character: 'e' == ''
-  {0x65, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'f'
-  {0x66, &DejaVueSans6x10_0x66},
-#else
-  // character: 'f' == ''
-  {0x66, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'g'
-  {0x67, &DejaVueSans6x10_0x67},
-#else
-  // character: 'g' == ''
-  {0x67, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'h'
-  {0x68, &DejaVueSans6x10_0x68},
-#else
-  // character: 'h' == ''
-  {0x68, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'i'
-  {0x69, &DejaVueSans6x10_0x69},
-#else
-  // character: 'i' == ''
-  {0x69, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'j'
-  {0x6a, &DejaVueSans6x10_0x6a},
-#else
-  // character: 'j' == ''
-  {0x6a, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'k'
-  {0x6b, &DejaVueSans6x10_0x6b},
-#else
-  // character: 'k' == ''
-  {0x6b, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'l'
-  {0x6c, &DejaVueSans6x10_0x6c},
-#else
-  // character: 'l' == ''
-  {0x6c, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'm'
-  {0x6d, &DejaVueSans6x10_0x6d},
-#else
-  // character: 'm' == ''
-  {0x6d, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'n'
-  {0x6e, &DejaVueSans6x10_0x6e},
-#else
-  // character: 'n' == ''
-  {0x6e, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'o'
-  {0x6f, &DejaVueSans6x10_0x6f},
-#else
-  // character: 'o' == ''
-  {0x6f, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'p'
-  {0x70, &DejaVueSans6x10_0x70},
-#else
-  // character: 'p' == ''
-  {0x70, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'q'
-  {0x71, &DejaVueSans6x10_0x71},
-#else
-  // character: 'q' == ''
-  {0x71, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'r'
-  {0x72, &DejaVueSans6x10_0x72},
-#else
-  // character: 'r' == ''
-  {0x72, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 's'
-  {0x73, &DejaVueSans6x10_0x73},
-#else
-  // character: 's' == ''
-  {0x73, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 't'
-  {0x74, &DejaVueSans6x10_0x74},
-#else
-  // character: 't' == ''
-  {0x74, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'u'
-  {0x75, &DejaVueSans6x10_0x75},
-#else
-  // character: 'u' == ''
-  {0x75, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'v'
-  {0x76, &DejaVueSans6x10_0x76},
-#else
-  // character: 'v' == ''
-  {0x76, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'w'
-  {0x77, &DejaVueSans6x10_0x77},
-#else
-  // character: 'w' == ''
-  {0x77, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'x'
-  {0x78, &DejaVueSans6x10_0x78},
-#else
-  // character: 'x' == ''
-  {0x78, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'y'
-  {0x79, &DejaVueSans6x10_0x79},
-#else
-  // character: 'y' == ''
-  {0x79, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'z'
-  {0x7a, &DejaVueSans6x10_0x7a},
-#else
-  // character: 'z' == ''
-  {0x7a, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '{'
-  {0x7b, &DejaVueSans6x10_0x7b},
-#else
-  // character: '{' == ''
-  {0x7b, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '|'
-  {0x7c, &DejaVueSans6x10_0x7c},
-#else
-  // character: '|' == ''
-  {0x7c, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '}'
-  {0x7d, &DejaVueSans6x10_0x7d},
-#else
-  // character: '}' == ''
-  {0x7d, &DejaVueSans6x10_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '~'
-  {0x7e, &DejaVueSans6x10_0x7e}
-#else
-  // character: '~' == ''
-  {0x7e, &DejaVueSans6x10_0x}
-#endif
-
-};
-
-
-
-const tChar* GetFontDejaVueSans6x10(uint8_t ASCII)
-{
-   return &DejaVueSans6x10_array[ASCII - 0x20];
-}
-
-
+
+/*******************************************************************************
+* font
+* filename: unsaved
+* name: DejaVueSans6x10
+* family: DejaVu Sans Mono
+* size: 10
+* style: Normal
+* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+* antialiasing: no
+* type: proportional
+* encoding: ASMO-708
+* unicode bom: no
+*
+* preset name: Monochrome_TB
+* data block size: 8 bit(s), uint8_t
+* RLE compression enabled: no
+* conversion type: Monochrome, Edge 128
+* bits per pixel: 1
+*
+* preprocess:
+*  main scan direction: top_to_bottom
+*  line scan direction: forward
+*  inverse: yes
+*******************************************************************************/
+
+/*
+ typedef struct {
+     long int code;
+     const tImage *image;
+     } tChar;
+ typedef struct {
+     int length;
+     const tChar *chars;
+     } tFont;
+*/
+
+#include <stdint.h>
+#include "fonts.h"
+
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x20[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x20 = { image_data_DejaVueSans6x10_0x20,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x21[10] = {
+    0x00, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x00, 
+    0x10, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x21 = { image_data_DejaVueSans6x10_0x21,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x22[10] = {
+    0x00, 
+    0x28, 
+    0x28, 
+    0x28, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x22 = { image_data_DejaVueSans6x10_0x22,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x23[10] = {
+    0x00, 
+    0x28, 
+    0x28, 
+    0x7c, 
+    0x50, 
+    0xf8, 
+    0x50, 
+    0x50, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x23 = { image_data_DejaVueSans6x10_0x23,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x24[10] = {
+    0x00, 
+    0x10, 
+    0x3c, 
+    0x50, 
+    0x70, 
+    0x1c, 
+    0x14, 
+    0x78, 
+    0x10, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x24 = { image_data_DejaVueSans6x10_0x24,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x25[10] = {
+    0x00, 
+    0xe0, 
+    0xa0, 
+    0xe8, 
+    0x30, 
+    0x5c, 
+    0x14, 
+    0x1c, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x25 = { image_data_DejaVueSans6x10_0x25,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x26[10] = {
+    0x00, 
+    0x38, 
+    0x20, 
+    0x30, 
+    0x54, 
+    0x4c, 
+    0x48, 
+    0x34, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x26 = { image_data_DejaVueSans6x10_0x26,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x27[10] = {
+    0x00, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x27 = { image_data_DejaVueSans6x10_0x27,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x28[10] = {
+    0x10, 
+    0x20, 
+    0x20, 
+    0x20, 
+    0x20, 
+    0x20, 
+    0x20, 
+    0x20, 
+    0x10, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x28 = { image_data_DejaVueSans6x10_0x28,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x29[10] = {
+    0x20, 
+    0x20, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x20, 
+    0x20, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x29 = { image_data_DejaVueSans6x10_0x29,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x2a[10] = {
+    0x00, 
+    0x54, 
+    0x38, 
+    0x38, 
+    0x54, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x2a = { image_data_DejaVueSans6x10_0x2a,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x2b[10] = {
+    0x00, 
+    0x00, 
+    0x10, 
+    0x10, 
+    0x7c, 
+    0x10, 
+    0x10, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x2b = { image_data_DejaVueSans6x10_0x2b,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x2c[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x20, 
+    0x20, 
+    0x20
+};
+static const tImage DejaVueSans6x10_0x2c = { image_data_DejaVueSans6x10_0x2c,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x2d[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x38, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x2d = { image_data_DejaVueSans6x10_0x2d,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x2e[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x20, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x2e = { image_data_DejaVueSans6x10_0x2e,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x2f[10] = {
+    0x00, 
+    0x04, 
+    0x08, 
+    0x08, 
+    0x10, 
+    0x10, 
+    0x20, 
+    0x20, 
+    0x40, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x2f = { image_data_DejaVueSans6x10_0x2f,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x30[10] = {
+    0x00, 
+    0x38, 
+    0x44, 
+    0x44, 
+    0x54, 
+    0x44, 
+    0x44, 
+    0x38, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x30 = { image_data_DejaVueSans6x10_0x30,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x31[10] = {
+    0x00, 
+    0x70, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x7c, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x31 = { image_data_DejaVueSans6x10_0x31,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x32[10] = {
+    0x00, 
+    0x38, 
+    0x44, 
+    0x04, 
+    0x0c, 
+    0x18, 
+    0x20, 
+    0x7c, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x32 = { image_data_DejaVueSans6x10_0x32,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x33[10] = {
+    0x00, 
+    0x38, 
+    0x44, 
+    0x04, 
+    0x38, 
+    0x04, 
+    0x44, 
+    0x38, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x33 = { image_data_DejaVueSans6x10_0x33,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x34[10] = {
+    0x00, 
+    0x08, 
+    0x18, 
+    0x28, 
+    0x68, 
+    0x7c, 
+    0x08, 
+    0x08, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x34 = { image_data_DejaVueSans6x10_0x34,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x35[10] = {
+    0x00, 
+    0x78, 
+    0x40, 
+    0x78, 
+    0x04, 
+    0x04, 
+    0x04, 
+    0x78, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x35 = { image_data_DejaVueSans6x10_0x35,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x36[10] = {
+    0x00, 
+    0x3c, 
+    0x60, 
+    0x40, 
+    0x78, 
+    0x44, 
+    0x44, 
+    0x38, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x36 = { image_data_DejaVueSans6x10_0x36,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x37[10] = {
+    0x00, 
+    0x7c, 
+    0x0c, 
+    0x08, 
+    0x08, 
+    0x10, 
+    0x10, 
+    0x20, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x37 = { image_data_DejaVueSans6x10_0x37,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x38[10] = {
+    0x00, 
+    0x38, 
+    0x44, 
+    0x44, 
+    0x38, 
+    0x44, 
+    0x44, 
+    0x38, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x38 = { image_data_DejaVueSans6x10_0x38,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x39[10] = {
+    0x00, 
+    0x38, 
+    0x44, 
+    0x44, 
+    0x3c, 
+    0x04, 
+    0x0c, 
+    0x78, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x39 = { image_data_DejaVueSans6x10_0x39,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x3a[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x20, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x20, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x3a = { image_data_DejaVueSans6x10_0x3a,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x3b[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x20, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x20, 
+    0x20, 
+    0x20
+};
+static const tImage DejaVueSans6x10_0x3b = { image_data_DejaVueSans6x10_0x3b,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x3c[10] = {
+    0x00, 
+    0x00, 
+    0x04, 
+    0x38, 
+    0x40, 
+    0x38, 
+    0x04, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x3c = { image_data_DejaVueSans6x10_0x3c,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x3d[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0xf8, 
+    0x00, 
+    0xf8, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x3d = { image_data_DejaVueSans6x10_0x3d,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x3e[10] = {
+    0x00, 
+    0x00, 
+    0x40, 
+    0x38, 
+    0x04, 
+    0x38, 
+    0x40, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x3e = { image_data_DejaVueSans6x10_0x3e,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x3f[10] = {
+    0x00, 
+    0x78, 
+    0x08, 
+    0x10, 
+    0x20, 
+    0x20, 
+    0x00, 
+    0x20, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x3f = { image_data_DejaVueSans6x10_0x3f,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x40[10] = {
+    0x00, 
+    0x38, 
+    0x24, 
+    0x5c, 
+    0x54, 
+    0x54, 
+    0x54, 
+    0x5c, 
+    0x20, 
+    0x18
+};
+static const tImage DejaVueSans6x10_0x40 = { image_data_DejaVueSans6x10_0x40,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x41[10] = {
+    0x00, 
+    0x10, 
+    0x10, 
+    0x28, 
+    0x28, 
+    0x38, 
+    0x44, 
+    0x44, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x41 = { image_data_DejaVueSans6x10_0x41,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x42[10] = {
+    0x00, 
+    0x78, 
+    0x44, 
+    0x44, 
+    0x78, 
+    0x44, 
+    0x44, 
+    0x78, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x42 = { image_data_DejaVueSans6x10_0x42,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x43[10] = {
+    0x00, 
+    0x3c, 
+    0x64, 
+    0x40, 
+    0x40, 
+    0x40, 
+    0x64, 
+    0x3c, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x43 = { image_data_DejaVueSans6x10_0x43,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x44[10] = {
+    0x00, 
+    0x78, 
+    0x4c, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x4c, 
+    0x78, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x44 = { image_data_DejaVueSans6x10_0x44,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x45[10] = {
+    0x00, 
+    0x7c, 
+    0x40, 
+    0x40, 
+    0x7c, 
+    0x40, 
+    0x40, 
+    0x7c, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x45 = { image_data_DejaVueSans6x10_0x45,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x46[10] = {
+    0x00, 
+    0x7c, 
+    0x40, 
+    0x40, 
+    0x7c, 
+    0x40, 
+    0x40, 
+    0x40, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x46 = { image_data_DejaVueSans6x10_0x46,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x47[10] = {
+    0x00, 
+    0x38, 
+    0x64, 
+    0x40, 
+    0x4c, 
+    0x44, 
+    0x64, 
+    0x3c, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x47 = { image_data_DejaVueSans6x10_0x47,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x48[10] = {
+    0x00, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x7c, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x48 = { image_data_DejaVueSans6x10_0x48,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x49[10] = {
+    0x00, 
+    0x7c, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x7c, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x49 = { image_data_DejaVueSans6x10_0x49,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x4a[10] = {
+    0x00, 
+    0x38, 
+    0x08, 
+    0x08, 
+    0x08, 
+    0x08, 
+    0x48, 
+    0x30, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x4a = { image_data_DejaVueSans6x10_0x4a,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x4b[10] = {
+    0x00, 
+    0x44, 
+    0x48, 
+    0x50, 
+    0x60, 
+    0x50, 
+    0x48, 
+    0x44, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x4b = { image_data_DejaVueSans6x10_0x4b,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x4c[10] = {
+    0x00, 
+    0x40, 
+    0x40, 
+    0x40, 
+    0x40, 
+    0x40, 
+    0x40, 
+    0x7c, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x4c = { image_data_DejaVueSans6x10_0x4c,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x4d[10] = {
+    0x00, 
+    0x44, 
+    0x6c, 
+    0x6c, 
+    0x54, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x4d = { image_data_DejaVueSans6x10_0x4d,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x4e[10] = {
+    0x00, 
+    0x44, 
+    0x64, 
+    0x64, 
+    0x54, 
+    0x4c, 
+    0x4c, 
+    0x44, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x4e = { image_data_DejaVueSans6x10_0x4e,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x4f[10] = {
+    0x00, 
+    0x38, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x38, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x4f = { image_data_DejaVueSans6x10_0x4f,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x50[10] = {
+    0x00, 
+    0x78, 
+    0x44, 
+    0x44, 
+    0x78, 
+    0x40, 
+    0x40, 
+    0x40, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x50 = { image_data_DejaVueSans6x10_0x50,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x51[10] = {
+    0x00, 
+    0x38, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x38, 
+    0x0c, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x51 = { image_data_DejaVueSans6x10_0x51,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x52[10] = {
+    0x00, 
+    0x78, 
+    0x44, 
+    0x44, 
+    0x78, 
+    0x4c, 
+    0x44, 
+    0x42, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x52 = { image_data_DejaVueSans6x10_0x52,
+    7, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x53[10] = {
+    0x00, 
+    0x38, 
+    0x44, 
+    0x40, 
+    0x38, 
+    0x04, 
+    0x44, 
+    0x38, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x53 = { image_data_DejaVueSans6x10_0x53,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x54[10] = {
+    0x00, 
+    0x7c, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x54 = { image_data_DejaVueSans6x10_0x54,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x55[10] = {
+    0x00, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x38, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x55 = { image_data_DejaVueSans6x10_0x55,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x56[10] = {
+    0x00, 
+    0x44, 
+    0x44, 
+    0x28, 
+    0x28, 
+    0x28, 
+    0x10, 
+    0x10, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x56 = { image_data_DejaVueSans6x10_0x56,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x57[10] = {
+    0x00, 
+    0x84, 
+    0xb4, 
+    0xb4, 
+    0x78, 
+    0x48, 
+    0x48, 
+    0x48, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x57 = { image_data_DejaVueSans6x10_0x57,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x58[10] = {
+    0x00, 
+    0x44, 
+    0x28, 
+    0x28, 
+    0x10, 
+    0x28, 
+    0x28, 
+    0x44, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x58 = { image_data_DejaVueSans6x10_0x58,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x59[10] = {
+    0x00, 
+    0x44, 
+    0x28, 
+    0x28, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x59 = { image_data_DejaVueSans6x10_0x59,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x5a[10] = {
+    0x00, 
+    0x7c, 
+    0x08, 
+    0x08, 
+    0x10, 
+    0x20, 
+    0x20, 
+    0x7c, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x5a = { image_data_DejaVueSans6x10_0x5a,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x5b[10] = {
+    0x30, 
+    0x20, 
+    0x20, 
+    0x20, 
+    0x20, 
+    0x20, 
+    0x20, 
+    0x20, 
+    0x30, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x5b = { image_data_DejaVueSans6x10_0x5b,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x5c[10] = {
+    0x00, 
+    0x40, 
+    0x20, 
+    0x20, 
+    0x10, 
+    0x10, 
+    0x08, 
+    0x08, 
+    0x04, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x5c = { image_data_DejaVueSans6x10_0x5c,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x5d[10] = {
+    0x30, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x30, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x5d = { image_data_DejaVueSans6x10_0x5d,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x5e[10] = {
+    0x00, 
+    0x20, 
+    0x50, 
+    0x88, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x5e = { image_data_DejaVueSans6x10_0x5e,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x5f[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0xfc
+};
+static const tImage DejaVueSans6x10_0x5f = { image_data_DejaVueSans6x10_0x5f,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x60[10] = {
+    0x40, 
+    0x20, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x60 = { image_data_DejaVueSans6x10_0x60,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x61[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x78, 
+    0x04, 
+    0x3c, 
+    0x44, 
+    0x7c, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x61 = { image_data_DejaVueSans6x10_0x61,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x62[10] = {
+    0x40, 
+    0x40, 
+    0x40, 
+    0x78, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x78, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x62 = { image_data_DejaVueSans6x10_0x62,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x63[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x38, 
+    0x40, 
+    0x40, 
+    0x40, 
+    0x38, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x63 = { image_data_DejaVueSans6x10_0x63,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x64[10] = {
+    0x04, 
+    0x04, 
+    0x04, 
+    0x3c, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x3c, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x64 = { image_data_DejaVueSans6x10_0x64,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x65[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x38, 
+    0x44, 
+    0x7c, 
+    0x40, 
+    0x3c, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x65 = { image_data_DejaVueSans6x10_0x65,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x66[10] = {
+    0x18, 
+    0x20, 
+    0x20, 
+    0x78, 
+    0x20, 
+    0x20, 
+    0x20, 
+    0x20, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x66 = { image_data_DejaVueSans6x10_0x66,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x67[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x3c, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x3c, 
+    0x04, 
+    0x38
+};
+static const tImage DejaVueSans6x10_0x67 = { image_data_DejaVueSans6x10_0x67,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x68[10] = {
+    0x40, 
+    0x40, 
+    0x40, 
+    0x78, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x68 = { image_data_DejaVueSans6x10_0x68,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x69[10] = {
+    0x10, 
+    0x00, 
+    0x00, 
+    0x30, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x7c, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x69 = { image_data_DejaVueSans6x10_0x69,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x6a[10] = {
+    0x10, 
+    0x00, 
+    0x00, 
+    0x70, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x60
+};
+static const tImage DejaVueSans6x10_0x6a = { image_data_DejaVueSans6x10_0x6a,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x6b[10] = {
+    0x40, 
+    0x40, 
+    0x40, 
+    0x48, 
+    0x50, 
+    0x70, 
+    0x48, 
+    0x44, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x6b = { image_data_DejaVueSans6x10_0x6b,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x6c[10] = {
+    0xe0, 
+    0x20, 
+    0x20, 
+    0x20, 
+    0x20, 
+    0x20, 
+    0x20, 
+    0x18, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x6c = { image_data_DejaVueSans6x10_0x6c,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x6d[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x7c, 
+    0x54, 
+    0x54, 
+    0x54, 
+    0x54, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x6d = { image_data_DejaVueSans6x10_0x6d,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x6e[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x78, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x6e = { image_data_DejaVueSans6x10_0x6e,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x6f[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x38, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x38, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x6f = { image_data_DejaVueSans6x10_0x6f,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x70[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x78, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x78, 
+    0x40, 
+    0x40
+};
+static const tImage DejaVueSans6x10_0x70 = { image_data_DejaVueSans6x10_0x70,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x71[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x3c, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x3c, 
+    0x04, 
+    0x04
+};
+static const tImage DejaVueSans6x10_0x71 = { image_data_DejaVueSans6x10_0x71,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x72[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x3c, 
+    0x24, 
+    0x20, 
+    0x20, 
+    0x20, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x72 = { image_data_DejaVueSans6x10_0x72,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x73[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x3c, 
+    0x40, 
+    0x3c, 
+    0x04, 
+    0x78, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x73 = { image_data_DejaVueSans6x10_0x73,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x74[10] = {
+    0x00, 
+    0x20, 
+    0x20, 
+    0x78, 
+    0x20, 
+    0x20, 
+    0x20, 
+    0x38, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x74 = { image_data_DejaVueSans6x10_0x74,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x75[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x44, 
+    0x3c, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x75 = { image_data_DejaVueSans6x10_0x75,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x76[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x44, 
+    0x28, 
+    0x28, 
+    0x28, 
+    0x10, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x76 = { image_data_DejaVueSans6x10_0x76,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x77[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x44, 
+    0x54, 
+    0x28, 
+    0x28, 
+    0x28, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x77 = { image_data_DejaVueSans6x10_0x77,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x78[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x6c, 
+    0x28, 
+    0x10, 
+    0x28, 
+    0x6c, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x78 = { image_data_DejaVueSans6x10_0x78,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x79[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x44, 
+    0x28, 
+    0x28, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x60
+};
+static const tImage DejaVueSans6x10_0x79 = { image_data_DejaVueSans6x10_0x79,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x7a[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x7c, 
+    0x08, 
+    0x10, 
+    0x20, 
+    0x7c, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x7a = { image_data_DejaVueSans6x10_0x7a,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x7b[10] = {
+    0x18, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x60, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x18, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x7b = { image_data_DejaVueSans6x10_0x7b,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x7c[10] = {
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x10
+};
+static const tImage DejaVueSans6x10_0x7c = { image_data_DejaVueSans6x10_0x7c,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x7d[10] = {
+    0x30, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x0c, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x30, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x7d = { image_data_DejaVueSans6x10_0x7d,
+    6, 10, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_DejaVueSans6x10_0x7e[10] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x70, 
+    0x0c, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage DejaVueSans6x10_0x7e = { image_data_DejaVueSans6x10_0x7e,
+    6, 10, 8};
+#endif
+
+
+static const tChar DejaVueSans6x10_array[] = {
+
+#if (0x0 == 0x0)
+  // character: ' '
+  {0x20, &DejaVueSans6x10_0x20},
+#else
+  // character: ' ' == ''
+  {0x20, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '!'
+  {0x21, &DejaVueSans6x10_0x21},
+#else
+  // character: '!' == ''
+  {0x21, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '"'
+  {0x22, &DejaVueSans6x10_0x22},
+#else
+  // character: '"' == ''
+  {0x22, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '#'
+  {0x23, &DejaVueSans6x10_0x23},
+#else
+  // character: '#' == ''
+  {0x23, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '$'
+  {0x24, &DejaVueSans6x10_0x24},
+#else
+  // character: '$' == ''
+  {0x24, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '%'
+  {0x25, &DejaVueSans6x10_0x25},
+#else
+  // character: '%' == ''
+  {0x25, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '&'
+  {0x26, &DejaVueSans6x10_0x26},
+#else
+  // character: '&' == ''
+  {0x26, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '''
+  {0x27, &DejaVueSans6x10_0x27},
+#else
+  // character: ''' == ''
+  {0x27, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '('
+  {0x28, &DejaVueSans6x10_0x28},
+#else
+  // character: '(' == ''
+  {0x28, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: ')'
+  {0x29, &DejaVueSans6x10_0x29},
+#else
+  // character: ')' == ''
+  {0x29, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '*'
+  {0x2a, &DejaVueSans6x10_0x2a},
+#else
+  // character: '*' == ''
+  {0x2a, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '+'
+  {0x2b, &DejaVueSans6x10_0x2b},
+#else
+  // character: '+' == ''
+  {0x2b, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: ','
+  {0x2c, &DejaVueSans6x10_0x2c},
+#else
+  // character: ',' == ''
+  {0x2c, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '-'
+  {0x2d, &DejaVueSans6x10_0x2d},
+#else
+  // character: '-' == ''
+  {0x2d, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '.'
+  {0x2e, &DejaVueSans6x10_0x2e},
+#else
+  // character: '.' == ''
+  {0x2e, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '/'
+  {0x2f, &DejaVueSans6x10_0x2f},
+#else
+  // character: '/' == ''
+  {0x2f, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '0'
+  {0x30, &DejaVueSans6x10_0x30},
+#else
+  // character: '0' == ''
+  {0x30, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '1'
+  {0x31, &DejaVueSans6x10_0x31},
+#else
+  // character: '1' == ''
+  {0x31, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '2'
+  {0x32, &DejaVueSans6x10_0x32},
+#else
+  // character: '2' == ''
+  {0x32, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '3'
+  {0x33, &DejaVueSans6x10_0x33},
+#else
+  // character: '3' == ''
+  {0x33, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '4'
+  {0x34, &DejaVueSans6x10_0x34},
+#else
+  // character: '4' == ''
+  {0x34, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '5'
+  {0x35, &DejaVueSans6x10_0x35},
+#else
+  // character: '5' == ''
+  {0x35, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '6'
+  {0x36, &DejaVueSans6x10_0x36},
+#else
+  // character: '6' == ''
+  {0x36, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '7'
+  {0x37, &DejaVueSans6x10_0x37},
+#else
+  // character: '7' == ''
+  {0x37, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '8'
+  {0x38, &DejaVueSans6x10_0x38},
+#else
+  // character: '8' == ''
+  {0x38, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '9'
+  {0x39, &DejaVueSans6x10_0x39},
+#else
+  // character: '9' == ''
+  {0x39, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: ':'
+  {0x3a, &DejaVueSans6x10_0x3a},
+#else
+  // character: ':' == ''
+  {0x3a, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: ';'
+  {0x3b, &DejaVueSans6x10_0x3b},
+#else
+  // character: ';' == ''
+  {0x3b, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '<'
+  {0x3c, &DejaVueSans6x10_0x3c},
+#else
+  // character: '<' == ''
+  {0x3c, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '='
+  {0x3d, &DejaVueSans6x10_0x3d},
+#else
+  // character: '=' == ''
+  {0x3d, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '>'
+  {0x3e, &DejaVueSans6x10_0x3e},
+#else
+  // character: '>' == ''
+  {0x3e, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '?'
+  {0x3f, &DejaVueSans6x10_0x3f},
+#else
+  // character: '?' == ''
+  {0x3f, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '\x0040'
+  {0x40, &DejaVueSans6x10_0x40},
+#else
+  // character: '\x0040' == ''
+  {0x40, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'A'
+  {0x41, &DejaVueSans6x10_0x41},
+#else
+  // character: 'A' == ''
+  {0x41, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'B'
+  {0x42, &DejaVueSans6x10_0x42},
+#else
+  // character: 'B' == ''
+  {0x42, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'C'
+  {0x43, &DejaVueSans6x10_0x43},
+#else
+  // character: 'C' == ''
+  {0x43, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'D'
+  {0x44, &DejaVueSans6x10_0x44},
+#else
+  // character: 'D' == ''
+  {0x44, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'E'
+  {0x45, &DejaVueSans6x10_0x45},
+#else
+  // character: 'E' == ''
+  {0x45, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'F'
+  {0x46, &DejaVueSans6x10_0x46},
+#else
+  // character: 'F' == ''
+  {0x46, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'G'
+  {0x47, &DejaVueSans6x10_0x47},
+#else
+  // character: 'G' == ''
+  {0x47, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'H'
+  {0x48, &DejaVueSans6x10_0x48},
+#else
+  // character: 'H' == ''
+  {0x48, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'I'
+  {0x49, &DejaVueSans6x10_0x49},
+#else
+  // character: 'I' == ''
+  {0x49, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'J'
+  {0x4a, &DejaVueSans6x10_0x4a},
+#else
+  // character: 'J' == ''
+  {0x4a, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'K'
+  {0x4b, &DejaVueSans6x10_0x4b},
+#else
+  // character: 'K' == ''
+  {0x4b, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'L'
+  {0x4c, &DejaVueSans6x10_0x4c},
+#else
+  // character: 'L' == ''
+  {0x4c, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'M'
+  {0x4d, &DejaVueSans6x10_0x4d},
+#else
+  // character: 'M' == ''
+  {0x4d, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'N'
+  {0x4e, &DejaVueSans6x10_0x4e},
+#else
+  // character: 'N' == ''
+  {0x4e, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'O'
+  {0x4f, &DejaVueSans6x10_0x4f},
+#else
+  // character: 'O' == ''
+  {0x4f, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'P'
+  {0x50, &DejaVueSans6x10_0x50},
+#else
+  // character: 'P' == ''
+  {0x50, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'Q'
+  {0x51, &DejaVueSans6x10_0x51},
+#else
+  // character: 'Q' == ''
+  {0x51, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'R'
+  {0x52, &DejaVueSans6x10_0x52},
+#else
+  // character: 'R' == ''
+  {0x52, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'S'
+  {0x53, &DejaVueSans6x10_0x53},
+#else
+  // character: 'S' == ''
+  {0x53, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'T'
+  {0x54, &DejaVueSans6x10_0x54},
+#else
+  // character: 'T' == ''
+  {0x54, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'U'
+  {0x55, &DejaVueSans6x10_0x55},
+#else
+  // character: 'U' == ''
+  {0x55, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'V'
+  {0x56, &DejaVueSans6x10_0x56},
+#else
+  // character: 'V' == ''
+  {0x56, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'W'
+  {0x57, &DejaVueSans6x10_0x57},
+#else
+  // character: 'W' == ''
+  {0x57, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'X'
+  {0x58, &DejaVueSans6x10_0x58},
+#else
+  // character: 'X' == ''
+  {0x58, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'Y'
+  {0x59, &DejaVueSans6x10_0x59},
+#else
+  // character: 'Y' == ''
+  {0x59, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'Z'
+  {0x5a, &DejaVueSans6x10_0x5a},
+#else
+  // character: 'Z' == ''
+  {0x5a, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '['
+  {0x5b, &DejaVueSans6x10_0x5b},
+#else
+  // character: '[' == ''
+  {0x5b, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '\'
+  {0x5c, &DejaVueSans6x10_0x5c},
+#else
+  // character: '\' == ''
+  {0x5c, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: ']'
+  {0x5d, &DejaVueSans6x10_0x5d},
+#else
+  // character: ']' == ''
+  {0x5d, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '^'
+  {0x5e, &DejaVueSans6x10_0x5e},
+#else
+  // character: '^' == ''
+  {0x5e, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '_'
+  {0x5f, &DejaVueSans6x10_0x5f},
+#else
+  // character: '_' == ''
+  {0x5f, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '`'
+  {0x60, &DejaVueSans6x10_0x60},
+#else
+  // character: '`' == ''
+  {0x60, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'a'
+  {0x61, &DejaVueSans6x10_0x61},
+#else
+  // character: 'a' == ''
+  {0x61, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'b'
+  {0x62, &DejaVueSans6x10_0x62},
+#else
+  // character: 'b' == ''
+  {0x62, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'c'
+  {0x63, &DejaVueSans6x10_0x63},
+#else
+  // character: 'c' == ''
+  {0x63, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'd'
+  {0x64, &DejaVueSans6x10_0x64},
+#else
+  // character: 'd' == ''
+  {0x64, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'e'
+  {0x65, &DejaVueSans6x10_0x65},
+#else
+  // character: 'e' == ''
+  {0x65, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'f'
+  {0x66, &DejaVueSans6x10_0x66},
+#else
+  // character: 'f' == ''
+  {0x66, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'g'
+  {0x67, &DejaVueSans6x10_0x67},
+#else
+  // character: 'g' == ''
+  {0x67, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'h'
+  {0x68, &DejaVueSans6x10_0x68},
+#else
+  // character: 'h' == ''
+  {0x68, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'i'
+  {0x69, &DejaVueSans6x10_0x69},
+#else
+  // character: 'i' == ''
+  {0x69, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'j'
+  {0x6a, &DejaVueSans6x10_0x6a},
+#else
+  // character: 'j' == ''
+  {0x6a, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'k'
+  {0x6b, &DejaVueSans6x10_0x6b},
+#else
+  // character: 'k' == ''
+  {0x6b, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'l'
+  {0x6c, &DejaVueSans6x10_0x6c},
+#else
+  // character: 'l' == ''
+  {0x6c, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'm'
+  {0x6d, &DejaVueSans6x10_0x6d},
+#else
+  // character: 'm' == ''
+  {0x6d, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'n'
+  {0x6e, &DejaVueSans6x10_0x6e},
+#else
+  // character: 'n' == ''
+  {0x6e, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'o'
+  {0x6f, &DejaVueSans6x10_0x6f},
+#else
+  // character: 'o' == ''
+  {0x6f, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'p'
+  {0x70, &DejaVueSans6x10_0x70},
+#else
+  // character: 'p' == ''
+  {0x70, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'q'
+  {0x71, &DejaVueSans6x10_0x71},
+#else
+  // character: 'q' == ''
+  {0x71, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'r'
+  {0x72, &DejaVueSans6x10_0x72},
+#else
+  // character: 'r' == ''
+  {0x72, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 's'
+  {0x73, &DejaVueSans6x10_0x73},
+#else
+  // character: 's' == ''
+  {0x73, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 't'
+  {0x74, &DejaVueSans6x10_0x74},
+#else
+  // character: 't' == ''
+  {0x74, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'u'
+  {0x75, &DejaVueSans6x10_0x75},
+#else
+  // character: 'u' == ''
+  {0x75, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'v'
+  {0x76, &DejaVueSans6x10_0x76},
+#else
+  // character: 'v' == ''
+  {0x76, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'w'
+  {0x77, &DejaVueSans6x10_0x77},
+#else
+  // character: 'w' == ''
+  {0x77, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'x'
+  {0x78, &DejaVueSans6x10_0x78},
+#else
+  // character: 'x' == ''
+  {0x78, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'y'
+  {0x79, &DejaVueSans6x10_0x79},
+#else
+  // character: 'y' == ''
+  {0x79, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'z'
+  {0x7a, &DejaVueSans6x10_0x7a},
+#else
+  // character: 'z' == ''
+  {0x7a, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '{'
+  {0x7b, &DejaVueSans6x10_0x7b},
+#else
+  // character: '{' == ''
+  {0x7b, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '|'
+  {0x7c, &DejaVueSans6x10_0x7c},
+#else
+  // character: '|' == ''
+  {0x7c, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '}'
+  {0x7d, &DejaVueSans6x10_0x7d},
+#else
+  // character: '}' == ''
+  {0x7d, &DejaVueSans6x10_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '~'
+  {0x7e, &DejaVueSans6x10_0x7e}
+#else
+  // character: '~' == ''
+  {0x7e, &DejaVueSans6x10_0x}
+#endif
+
+};
+
+
+
+const tChar* GetFontDejaVueSans6x10(uint8_t ASCII)
+{
+   if((uint8_t)(ASCII - 0x20) >= (sizeof(DejaVueSans6x10_array) / sizeof(DejaVueSans6x10_array[0])))
+      ASCII = FONT_DEFAULT_CHAR;
+   return &DejaVueSans6x10_array[ASCII - 0x20];
+}
+
+
@@ -1,18 +1,19 @@
-/**
-*  @file   CourierNew8_14.h
-*  @author Rob Gee
-*  @date   November 2017
-*  @brief  Include file for courier new 8x14
-*/
-
-#ifndef __DEJAVUESANS_6_10_H
-#define __DEJAVUESANS_6_10_H
-
-const tChar* GetFontDejaVueSans6x10(uint8_t ASCII);
-
-
-#endif /*__DEJAVUESANS_6_10_H */
-
-
-
-
+/**
+*  @file   CourierNew8_14.h
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Include file for courier new 8x14
+*/
+
+#ifndef __DEJAVUESANS_6_10_H
+#define __DEJAVUESANS_6_10_H
+
+const tChar* GetFontDejaVueSans6x10(uint8_t ASCII);
+extern const tPackedFont PackedDejaVueSans6x10;
+
+
+#endif /*__DEJAVUESANS_6_10_H */
+
+
+
+
@@ -1,2811 +1,2813 @@
-
-/*******************************************************************************
-* font
-* filename: unsaved
-* name: Font
-* family: Fixedsys
-* size: 10
-* style: Normal
-* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
-* antialiasing: no
-* type: proportional
-* encoding: ASMO-708
-* unicode bom: no
-*
-* preset name: Monochrome_TB
-* data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
-* conversion type: Monochrome, Edge 128
-* bits per pixel: 1
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: yes
-*******************************************************************************/
-
-/*
- typedef struct {
-     long int code;
-     const tImage *image;
-     } tChar;
- typedef struct {
-     int length;
-     const tChar *chars;
-     } tFont;
-*/
-
-#include <stdint.h>
-#include "fonts.h"
-
-
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x20[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x20 = { image_data_Font_0x20,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x21[14] = {
-    0x00, 
-    0x00, 
-    0x18, 
-    0x3c, 
-    0x3c, 
-    0x3c, 
-    0x18, 
-    0x18, 
-    0x00, 
-    0x18, 
-    0x18, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x21 = { image_data_Font_0x21,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x22[14] = {
-    0x00, 
-    0x00, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x22 = { image_data_Font_0x22,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x23[14] = {
-    0x00, 
-    0x00, 
-    0x36, 
-    0x36, 
-    0x7f, 
-    0x36, 
-    0x36, 
-    0x36, 
-    0x7f, 
-    0x36, 
-    0x36, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x23 = { image_data_Font_0x23,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x24[14] = {
-    0x18, 
-    0x18, 
-    0x3c, 
-    0x66, 
-    0x60, 
-    0x30, 
-    0x18, 
-    0x0c, 
-    0x06, 
-    0x66, 
-    0x3c, 
-    0x18, 
-    0x18, 
-    0x00
-};
-static const tImage Font_0x24 = { image_data_Font_0x24,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x25[14] = {
-    0x00, 
-    0x70, 
-    0xd8, 
-    0xda, 
-    0x76, 
-    0x0c, 
-    0x18, 
-    0x30, 
-    0x6e, 
-    0x5b, 
-    0x1b, 
-    0x0e, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x25 = { image_data_Font_0x25,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x26[14] = {
-    0x00, 
-    0x00, 
-    0x38, 
-    0x6c, 
-    0x6c, 
-    0x38, 
-    0x60, 
-    0x6f, 
-    0x66, 
-    0x66, 
-    0x3b, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x26 = { image_data_Font_0x26,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x27[14] = {
-    0x00, 
-    0x00, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x27 = { image_data_Font_0x27,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x28[14] = {
-    0x00, 
-    0x00, 
-    0x0c, 
-    0x18, 
-    0x18, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x18, 
-    0x18, 
-    0x0c, 
-    0x00
-};
-static const tImage Font_0x28 = { image_data_Font_0x28,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x29[14] = {
-    0x00, 
-    0x00, 
-    0x30, 
-    0x18, 
-    0x18, 
-    0x0c, 
-    0x0c, 
-    0x0c, 
-    0x0c, 
-    0x0c, 
-    0x18, 
-    0x18, 
-    0x30, 
-    0x00
-};
-static const tImage Font_0x29 = { image_data_Font_0x29,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x2a[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x36, 
-    0x1c, 
-    0x7f, 
-    0x1c, 
-    0x36, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x2a = { image_data_Font_0x2a,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x2b[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x18, 
-    0x18, 
-    0x7e, 
-    0x18, 
-    0x18, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x2b = { image_data_Font_0x2b,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x2c[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x1c, 
-    0x1c, 
-    0x0c, 
-    0x18, 
-    0x00
-};
-static const tImage Font_0x2c = { image_data_Font_0x2c,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x2d[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x7e, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x2d = { image_data_Font_0x2d,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x2e[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x1c, 
-    0x1c, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x2e = { image_data_Font_0x2e,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x2f[14] = {
-    0x00, 
-    0x00, 
-    0x06, 
-    0x06, 
-    0x0c, 
-    0x0c, 
-    0x18, 
-    0x18, 
-    0x30, 
-    0x30, 
-    0x60, 
-    0x60, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x2f = { image_data_Font_0x2f,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x30[14] = {
-    0x00, 
-    0x00, 
-    0x1e, 
-    0x33, 
-    0x37, 
-    0x37, 
-    0x33, 
-    0x3b, 
-    0x3b, 
-    0x33, 
-    0x1e, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x30 = { image_data_Font_0x30,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x31[14] = {
-    0x00, 
-    0x00, 
-    0x0c, 
-    0x1c, 
-    0x7c, 
-    0x0c, 
-    0x0c, 
-    0x0c, 
-    0x0c, 
-    0x0c, 
-    0x0c, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x31 = { image_data_Font_0x31,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x32[14] = {
-    0x00, 
-    0x00, 
-    0x3c, 
-    0x66, 
-    0x66, 
-    0x06, 
-    0x0c, 
-    0x18, 
-    0x30, 
-    0x60, 
-    0x7e, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x32 = { image_data_Font_0x32,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x33[14] = {
-    0x00, 
-    0x00, 
-    0x3c, 
-    0x66, 
-    0x66, 
-    0x06, 
-    0x1c, 
-    0x06, 
-    0x66, 
-    0x66, 
-    0x3c, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x33 = { image_data_Font_0x33,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x34[14] = {
-    0x00, 
-    0x00, 
-    0x30, 
-    0x30, 
-    0x36, 
-    0x36, 
-    0x36, 
-    0x66, 
-    0x7f, 
-    0x06, 
-    0x06, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x34 = { image_data_Font_0x34,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x35[14] = {
-    0x00, 
-    0x00, 
-    0x7e, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x7c, 
-    0x06, 
-    0x06, 
-    0x0c, 
-    0x78, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x35 = { image_data_Font_0x35,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x36[14] = {
-    0x00, 
-    0x00, 
-    0x1c, 
-    0x18, 
-    0x30, 
-    0x7c, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x3c, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x36 = { image_data_Font_0x36,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x37[14] = {
-    0x00, 
-    0x00, 
-    0x7e, 
-    0x06, 
-    0x0c, 
-    0x0c, 
-    0x18, 
-    0x18, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x37 = { image_data_Font_0x37,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x38[14] = {
-    0x00, 
-    0x00, 
-    0x3c, 
-    0x66, 
-    0x66, 
-    0x76, 
-    0x3c, 
-    0x6e, 
-    0x66, 
-    0x66, 
-    0x3c, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x38 = { image_data_Font_0x38,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x39[14] = {
-    0x00, 
-    0x00, 
-    0x3c, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x3e, 
-    0x0c, 
-    0x18, 
-    0x38, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x39 = { image_data_Font_0x39,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x3a[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x1c, 
-    0x1c, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x1c, 
-    0x1c, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x3a = { image_data_Font_0x3a,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x3b[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x1c, 
-    0x1c, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x1c, 
-    0x1c, 
-    0x0c, 
-    0x18, 
-    0x00
-};
-static const tImage Font_0x3b = { image_data_Font_0x3b,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x3c[14] = {
-    0x00, 
-    0x00, 
-    0x06, 
-    0x0c, 
-    0x18, 
-    0x30, 
-    0x60, 
-    0x30, 
-    0x18, 
-    0x0c, 
-    0x06, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x3c = { image_data_Font_0x3c,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x3d[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x7e, 
-    0x00, 
-    0x7e, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x3d = { image_data_Font_0x3d,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x3e[14] = {
-    0x00, 
-    0x00, 
-    0x60, 
-    0x30, 
-    0x18, 
-    0x0c, 
-    0x06, 
-    0x0c, 
-    0x18, 
-    0x30, 
-    0x60, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x3e = { image_data_Font_0x3e,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x3f[14] = {
-    0x00, 
-    0x00, 
-    0x3c, 
-    0x66, 
-    0x66, 
-    0x0c, 
-    0x18, 
-    0x18, 
-    0x00, 
-    0x18, 
-    0x18, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x3f = { image_data_Font_0x3f,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x40[14] = {
-    0x00, 
-    0x00, 
-    0x7e, 
-    0xc3, 
-    0xc3, 
-    0xcf, 
-    0xdb, 
-    0xdb, 
-    0xcf, 
-    0xc0, 
-    0x7f, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x40 = { image_data_Font_0x40,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x41[14] = {
-    0x00, 
-    0x00, 
-    0x18, 
-    0x3c, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x7e, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x41 = { image_data_Font_0x41,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x42[14] = {
-    0x00, 
-    0x00, 
-    0x7c, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x7c, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x7c, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x42 = { image_data_Font_0x42,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x43[14] = {
-    0x00, 
-    0x00, 
-    0x3c, 
-    0x66, 
-    0x66, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x66, 
-    0x66, 
-    0x3c, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x43 = { image_data_Font_0x43,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x44[14] = {
-    0x00, 
-    0x00, 
-    0x78, 
-    0x6c, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x6c, 
-    0x78, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x44 = { image_data_Font_0x44,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x45[14] = {
-    0x00, 
-    0x00, 
-    0x7e, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x7c, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x7e, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x45 = { image_data_Font_0x45,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x46[14] = {
-    0x00, 
-    0x00, 
-    0x7e, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x7c, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x46 = { image_data_Font_0x46,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x47[14] = {
-    0x00, 
-    0x00, 
-    0x3c, 
-    0x66, 
-    0x66, 
-    0x60, 
-    0x60, 
-    0x6e, 
-    0x66, 
-    0x66, 
-    0x3e, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x47 = { image_data_Font_0x47,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x48[14] = {
-    0x00, 
-    0x00, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x7e, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x48 = { image_data_Font_0x48,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x49[14] = {
-    0x00, 
-    0x00, 
-    0x3c, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x3c, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x49 = { image_data_Font_0x49,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x4a[14] = {
-    0x00, 
-    0x00, 
-    0x06, 
-    0x06, 
-    0x06, 
-    0x06, 
-    0x06, 
-    0x06, 
-    0x66, 
-    0x66, 
-    0x3c, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x4a = { image_data_Font_0x4a,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x4b[14] = {
-    0x00, 
-    0x00, 
-    0x66, 
-    0x66, 
-    0x6c, 
-    0x6c, 
-    0x78, 
-    0x6c, 
-    0x6c, 
-    0x66, 
-    0x66, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x4b = { image_data_Font_0x4b,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x4c[14] = {
-    0x00, 
-    0x00, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x7e, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x4c = { image_data_Font_0x4c,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x4d[14] = {
-    0x00, 
-    0x00, 
-    0x63, 
-    0x63, 
-    0x77, 
-    0x6b, 
-    0x6b, 
-    0x6b, 
-    0x63, 
-    0x63, 
-    0x63, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x4d = { image_data_Font_0x4d,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x4e[14] = {
-    0x00, 
-    0x00, 
-    0x63, 
-    0x63, 
-    0x73, 
-    0x7b, 
-    0x6f, 
-    0x67, 
-    0x63, 
-    0x63, 
-    0x63, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x4e = { image_data_Font_0x4e,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x4f[14] = {
-    0x00, 
-    0x00, 
-    0x3c, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x3c, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x4f = { image_data_Font_0x4f,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x50[14] = {
-    0x00, 
-    0x00, 
-    0x7c, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x7c, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x50 = { image_data_Font_0x50,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x51[14] = {
-    0x00, 
-    0x00, 
-    0x3c, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x3c, 
-    0x0c, 
-    0x06, 
-    0x00
-};
-static const tImage Font_0x51 = { image_data_Font_0x51,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x52[14] = {
-    0x00, 
-    0x00, 
-    0x7c, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x7c, 
-    0x6c, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x52 = { image_data_Font_0x52,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x53[14] = {
-    0x00, 
-    0x00, 
-    0x3c, 
-    0x66, 
-    0x60, 
-    0x30, 
-    0x18, 
-    0x0c, 
-    0x06, 
-    0x66, 
-    0x3c, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x53 = { image_data_Font_0x53,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x54[14] = {
-    0x00, 
-    0x00, 
-    0x7e, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x54 = { image_data_Font_0x54,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x55[14] = {
-    0x00, 
-    0x00, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x3c, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x55 = { image_data_Font_0x55,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x56[14] = {
-    0x00, 
-    0x00, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x3c, 
-    0x18, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x56 = { image_data_Font_0x56,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x57[14] = {
-    0x00, 
-    0x00, 
-    0x63, 
-    0x63, 
-    0x63, 
-    0x6b, 
-    0x6b, 
-    0x6b, 
-    0x36, 
-    0x36, 
-    0x36, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x57 = { image_data_Font_0x57,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x58[14] = {
-    0x00, 
-    0x00, 
-    0x66, 
-    0x66, 
-    0x34, 
-    0x18, 
-    0x18, 
-    0x2c, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x58 = { image_data_Font_0x58,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x59[14] = {
-    0x00, 
-    0x00, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x3c, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x59 = { image_data_Font_0x59,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x5a[14] = {
-    0x00, 
-    0x00, 
-    0x7e, 
-    0x06, 
-    0x06, 
-    0x0c, 
-    0x18, 
-    0x30, 
-    0x60, 
-    0x60, 
-    0x7e, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x5a = { image_data_Font_0x5a,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x5b[14] = {
-    0x00, 
-    0x00, 
-    0x3c, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x3c
-};
-static const tImage Font_0x5b = { image_data_Font_0x5b,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x5c[14] = {
-    0x00, 
-    0x00, 
-    0x60, 
-    0x60, 
-    0x30, 
-    0x30, 
-    0x18, 
-    0x18, 
-    0x0c, 
-    0x0c, 
-    0x06, 
-    0x06, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x5c = { image_data_Font_0x5c,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x5d[14] = {
-    0x00, 
-    0x00, 
-    0x3c, 
-    0x0c, 
-    0x0c, 
-    0x0c, 
-    0x0c, 
-    0x0c, 
-    0x0c, 
-    0x0c, 
-    0x0c, 
-    0x0c, 
-    0x0c, 
-    0x3c
-};
-static const tImage Font_0x5d = { image_data_Font_0x5d,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x5e[14] = {
-    0x18, 
-    0x3c, 
-    0x66, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x5e = { image_data_Font_0x5e,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x5f[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0xff
-};
-static const tImage Font_0x5f = { image_data_Font_0x5f,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x60[14] = {
-    0x38, 
-    0x18, 
-    0x0c, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x60 = { image_data_Font_0x60,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x61[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x3c, 
-    0x06, 
-    0x06, 
-    0x3e, 
-    0x66, 
-    0x66, 
-    0x3e, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x61 = { image_data_Font_0x61,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x62[14] = {
-    0x00, 
-    0x00, 
-    0x60, 
-    0x60, 
-    0x7c, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x7c, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x62 = { image_data_Font_0x62,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x63[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x3c, 
-    0x66, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x66, 
-    0x3c, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x63 = { image_data_Font_0x63,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x64[14] = {
-    0x00, 
-    0x00, 
-    0x06, 
-    0x06, 
-    0x3e, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x3e, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x64 = { image_data_Font_0x64,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x65[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x3c, 
-    0x66, 
-    0x66, 
-    0x7e, 
-    0x60, 
-    0x60, 
-    0x3c, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x65 = { image_data_Font_0x65,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x66[14] = {
-    0x00, 
-    0x00, 
-    0x1e, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x7e, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x66 = { image_data_Font_0x66,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x67[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x3e, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x3e, 
-    0x06, 
-    0x06, 
-    0x7c
-};
-static const tImage Font_0x67 = { image_data_Font_0x67,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x68[14] = {
-    0x00, 
-    0x00, 
-    0x60, 
-    0x60, 
-    0x7c, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x68 = { image_data_Font_0x68,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x69[14] = {
-    0x00, 
-    0x18, 
-    0x18, 
-    0x00, 
-    0x78, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x7e, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x69 = { image_data_Font_0x69,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x6a[14] = {
-    0x00, 
-    0x0c, 
-    0x0c, 
-    0x00, 
-    0x3c, 
-    0x0c, 
-    0x0c, 
-    0x0c, 
-    0x0c, 
-    0x0c, 
-    0x0c, 
-    0x0c, 
-    0x0c, 
-    0x78
-};
-static const tImage Font_0x6a = { image_data_Font_0x6a,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x6b[14] = {
-    0x00, 
-    0x00, 
-    0x60, 
-    0x60, 
-    0x66, 
-    0x66, 
-    0x6c, 
-    0x78, 
-    0x6c, 
-    0x66, 
-    0x66, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x6b = { image_data_Font_0x6b,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x6c[14] = {
-    0x00, 
-    0x00, 
-    0x78, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x7e, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x6c = { image_data_Font_0x6c,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x6d[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x7e, 
-    0x6b, 
-    0x6b, 
-    0x6b, 
-    0x6b, 
-    0x6b, 
-    0x63, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x6d = { image_data_Font_0x6d,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x6e[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x7c, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x6e = { image_data_Font_0x6e,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x6f[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x3c, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x3c, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x6f = { image_data_Font_0x6f,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x70[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x7c, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x7c, 
-    0x60, 
-    0x60, 
-    0x60
-};
-static const tImage Font_0x70 = { image_data_Font_0x70,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x71[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x3e, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x3e, 
-    0x06, 
-    0x06, 
-    0x06
-};
-static const tImage Font_0x71 = { image_data_Font_0x71,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x72[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x66, 
-    0x6e, 
-    0x70, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x72 = { image_data_Font_0x72,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x73[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x3e, 
-    0x60, 
-    0x60, 
-    0x3c, 
-    0x06, 
-    0x06, 
-    0x7c, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x73 = { image_data_Font_0x73,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x74[14] = {
-    0x00, 
-    0x00, 
-    0x30, 
-    0x30, 
-    0x7e, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x1e, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x74 = { image_data_Font_0x74,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x75[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x3e, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x75 = { image_data_Font_0x75,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x76[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x3c, 
-    0x18, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x76 = { image_data_Font_0x76,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x77[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x63, 
-    0x6b, 
-    0x6b, 
-    0x6b, 
-    0x6b, 
-    0x36, 
-    0x36, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x77 = { image_data_Font_0x77,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x78[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x66, 
-    0x66, 
-    0x3c, 
-    0x18, 
-    0x3c, 
-    0x66, 
-    0x66, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x78 = { image_data_Font_0x78,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x79[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x66, 
-    0x3c, 
-    0x0c, 
-    0x18, 
-    0xf0
-};
-static const tImage Font_0x79 = { image_data_Font_0x79,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x7a[14] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x7e, 
-    0x06, 
-    0x0c, 
-    0x18, 
-    0x30, 
-    0x60, 
-    0x7e, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x7a = { image_data_Font_0x7a,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x7b[14] = {
-    0x00, 
-    0x00, 
-    0x0c, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x30, 
-    0x60, 
-    0x30, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x0c, 
-    0x00
-};
-static const tImage Font_0x7b = { image_data_Font_0x7b,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x7c[14] = {
-    0x00, 
-    0x00, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18
-};
-static const tImage Font_0x7c = { image_data_Font_0x7c,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x7d[14] = {
-    0x00, 
-    0x00, 
-    0x30, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x0c, 
-    0x06, 
-    0x0c, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x30, 
-    0x00
-};
-static const tImage Font_0x7d = { image_data_Font_0x7d,
-    8, 14, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x7e[14] = {
-    0x00, 
-    0x00, 
-    0x71, 
-    0xdb, 
-    0x8e, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x7e = { image_data_Font_0x7e,
-    8, 14, 8};
-#endif
-
-
-static const tChar Font_array[] = {
-
-#if (0x0 == 0x0)
-  // character: ' '
-  {0x20, &Font_0x20},
-#else
-  // character: ' ' == ''
-  {0x20, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '!'
-  {0x21, &Font_0x21},
-#else
-  // character: '!' == ''
-  {0x21, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '"'
-  {0x22, &Font_0x22},
-#else
-  // character: '"' == ''
-  {0x22, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '#'
-  {0x23, &Font_0x23},
-#else
-  // character: '#' == ''
-  {0x23, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '$'
-  {0x24, &Font_0x24},
-#else
-  // character: '$' == ''
-  {0x24, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '%'
-  {0x25, &Font_0x25},
-#else
-  // character: '%' == ''
-  {0x25, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '&'
-  {0x26, &Font_0x26},
-#else
-  // character: '&' == ''
-  {0x26, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '''
-  {0x27, &Font_0x27},
-#else
-  // character: ''' == ''
-  {0x27, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '('
-  {0x28, &Font_0x28},
-#else
-  // character: '(' == ''
-  {0x28, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ')'
-  {0x29, &Font_0x29},
-#else
-  // character: ')' == ''
-  {0x29, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '*'
-  {0x2a, &Font_0x2a},
-#else
-  // character: '*' == ''
-  {0x2a, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '+'
-  {0x2b, &Font_0x2b},
-#else
-  // character: '+' == ''
-  {0x2b, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ','
-  {0x2c, &Font_0x2c},
-#else
-  // character: ',' == ''
-  {0x2c, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '-'
-  {0x2d, &Font_0x2d},
-#else
-  // character: '-' == ''
-  {0x2d, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '.'
-  {0x2e, &Font_0x2e},
-#else
-  // character: '.' == ''
-  {0x2e, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '/'
-  {0x2f, &Font_0x2f},
-#else
-  // character: '/' == ''
-  {0x2f, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '0'
-  {0x30, &Font_0x30},
-#else
-  // character: '0' == ''
-  {0x30, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '1'
-  {0x31, &Font_0x31},
-#else
-  // character: '1' == ''
-  {0x31, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '2'
-  {0x32, &Font_0x32},
-#else
-  // character: '2' == ''
-  {0x32, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '3'
-  {0x33, &Font_0x33},
-#else
-  // character: '3' == ''
-  {0x33, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '4'
-  {0x34, &Font_0x34},
-#else
-  // character: '4' == ''
-  {0x34, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '5'
-  {0x35, &Font_0x35},
-#else
-  // character: '5' == ''
-  {0x35, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '6'
-  {0x36, &Font_0x36},
-#else
-  // character: '6' == ''
-  {0x36, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '7'
-  {0x37, &Font_0x37},
-#else
-  // character: '7' == ''
-  {0x37, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '8'
-  {0x38, &Font_0x38},
-#else
-  // character: '8' == ''
-  {0x38, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '9'
-  {0x39, &Font_0x39},
-#else
-  // character: '9' == ''
-  {0x39, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ':'
-  {0x3a, &Font_0x3a},
-#else
-  // character: ':' == ''
-  {0x3a, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ';'
-  {0x3b, &Font_0x3b},
-#else
-  // character: ';' == ''
-  {0x3b, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '<'
-  {0x3c, &Font_0x3c},
-#else
-  // character: '<' == ''
-  {0x3c, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '='
-  {0x3d, &Font_0x3d},
-#else
-  // character: '=' == ''
-  {0x3d, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '>'
-  {0x3e, &Font_0x3e},
-#else
-  // character: '>' == ''
-  {0x3e, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '?'
-  {0x3f, &Font_0x3f},
-#else
-  // character: '?' == ''
-  {0x3f, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\x0040'
-  {0x40, &Font_0x40},
-#else
-  // character: '\x0040' == ''
-  {0x40, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'A'
-  {0x41, &Font_0x41},
-#else
-  // character: 'A' == ''
-  {0x41, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'B'
-  {0x42, &Font_0x42},
-#else
-  // character: 'B' == ''
-  {0x42, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'C'
-  {0x43, &Font_0x43},
-#else
-  // character: 'C' == ''
-  {0x43, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'D'
-  {0x44, &Font_0x44},
-#else
-  // character: 'D' == ''
-  {0x44, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'E'
-  {0x45, &Font_0x45},
-#else
-  // character: 'E' == ''
-  {0x45, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'F'
-  {0x46, &Font_0x46},
-#else
-  // character: 'F' == ''
-  {0x46, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'G'
-  {0x47, &Font_0x47},
-#else
-  // character: 'G' == ''
-  {0x47, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'H'
-  {0x48, &Font_0x48},
-#else
-  // character: 'H' == ''
-  {0x48, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'I'
-  {0x49, &Font_0x49},
-#else
-  // character: 'I' == ''
-  {0x49, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'J'
-  {0x4a, &Font_0x4a},
-#else
-  // character: 'J' == ''
-  {0x4a, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'K'
-  {0x4b, &Font_0x4b},
-#else
-  // character: 'K' == ''
-  {0x4b, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'L'
-  {0x4c, &Font_0x4c},
-#else
-  // character: 'L' == ''
-  {0x4c, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'M'
-  {0x4d, &Font_0x4d},
-#else
-  // character: 'M' == ''
-  {0x4d, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'N'
-  {0x4e, &Font_0x4e},
-#else
-  // character: 'N' == ''
-  {0x4e, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'O'
-  {0x4f, &Font_0x4f},
-#else
-  // character: 'O' == ''
-  {0x4f, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'P'
-  {0x50, &Font_0x50},
-#else
-  // character: 'P' == ''
-  {0x50, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Q'
-  {0x51, &Font_0x51},
-#else
-  // character: 'Q' == ''
-  {0x51, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'R'
-  {0x52, &Font_0x52},
-#else
-  // character: 'R' == ''
-  {0x52, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'S'
-  {0x53, &Font_0x53},
-#else
-  // character: 'S' == ''
-  {0x53, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'T'
-  {0x54, &Font_0x54},
-#else
-  // character: 'T' == ''
-  {0x54, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'U'
-  {0x55, &Font_0x55},
-#else
-  // character: 'U' == ''
-  {0x55, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'V'
-  {0x56, &Font_0x56},
-#else
-  // character: 'V' == ''
-  {0x56, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'W'
-  {0x57, &Font_0x57},
-#else
-  // character: 'W' == ''
-  {0x57, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'X'
-  {0x58, &Font_0x58},
-#else
-  // character: 'X' == ''
-  {0x58, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Y'
-  {0x59, &Font_0x59},
-#else
-  // character: 'Y' == ''
-  {0x59, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Z'
-  {0x5a, &Font_0x5a},
-#else
-  // character: 'Z' == ''
-  {0x5a, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '['
-  {0x5b, &Font_0x5b},
-#else
-  // character: '[' == ''
-  {0x5b, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\'
-  {0x5c, &Font_0x5c},
-#else
-  // character: '\' == ''
-  {0x5c, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ']'
-  {0x5d, &Font_0x5d},
-#else
-  // character: ']' == ''
-  {0x5d, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '^'
-  {0x5e, &Font_0x5e},
-#else
-  // character: '^' == ''
-  {0x5e, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '_'
-  {0x5f, &Font_0x5f},
-#else
-  // character: '_' == ''
-  {0x5f, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '`'
-  {0x60, &Font_0x60},
-#else
-  // character: '`' == ''
-  {0x60, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'a'
-  {0x61, &Font_0x61},
-#else
-  // character: 'a' == ''
-  {0x61, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'b'
-  {0x62, &Font_0x62},
-#else
-  // character: 'b' == ''
-  {0x62, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'c'
-  {0x63, &Font_0x63},
-#else
-  // character: 'c' == ''
-  {0x63, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'd'
-  {0x64, &Font_0x64},
-#else
-  // character: 'd' == ''
-  {0x64, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'e'
-  {0x65, &Font_0x65},
-#else
-  // character: 'e' == ''
-  {0x65, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'f'
-  {0x66, &Font_0x66},
-#else
-  // character: 'f' == ''
-  {0x66, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'g'
-  {0x67, &Font_0x67},
-#else
-  // character: 'g' == ''
-  {0x67, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'h'
-  {0x68, &Font_0x68},
-#else
-  // character: 'h' == ''
-  {0x68, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'i'
-  {0x69, &Font_0x69},
-#else
-  // character: 'i' == ''
-  {0x69, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'j'
-  {0x6a, &Font_0x6a},
-#else
-  // character: 'j' == ''
-  {0x6a, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'k'
-  {0x6b, &Font_0x6b},
-#else
-  // character: 'k' == ''
-  {0x6b, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'l'
-  {0x6c, &Font_0x6c},
-#else
-  // character: 'l' == ''
-  {0x6c, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'm'
-  {0x6d, &Font_0x6d},
-#else
-  // character: 'm' == ''
-  {0x6d, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'n'
-  {0x6e, &Font_0x6e},
-#else
-  // character: 'n' == ''
-  {0x6e, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'o'
-  {0x6f, &Font_0x6f},
-#else
-  // character: 'o' == ''
-  {0x6f, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'p'
-  {0x70, &Font_0x70},
-#else
-  // character: 'p' == ''
-  {0x70, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'q'
-  {0x71, &Font_0x71},
-#else
-  // character: 'q' == ''
-  {0x71, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'r'
-  {0x72, &Font_0x72},
-#else
-  // character: 'r' == ''
-  {0x72, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 's'
-  {0x73, &Font_0x73},
-#else
-  // character: 's' == ''
-  {0x73, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 't'
-  {0x74, &Font_0x74},
-#else
-  // character: 't' == ''
-  {0x74, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'u'
-  {0x75, &Font_0x75},
-#else
-  // character: 'u' == ''
-  {0x75, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'v'
-  {0x76, &Font_0x76},
-#else
-  // character: 'v' == ''
-  {0x76, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'w'
-  {0x77, &Font_0x77},
-#else
-  // character: 'w' == ''
-  {0x77, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'x'
-  {0x78, &Font_0x78},
-#else
-  // character: 'x' == ''
-  {0x78, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'y'
-  {0x79, &Font_0x79},
-#else
-  // character: 'y' == ''
-  {0x79, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'z'
-  {0x7a, &Font_0x7a},
-#else
-  // character: 'z' == ''
-  {0x7a, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '{'
-  {0x7b, &Font_0x7b},
-#else
-  // character: '{' == ''
-  {0x7b, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '|'
-  {0x7c, &Font_0x7c},
-#else
-  // character: '|' == ''
-  {0x7c, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '}'
-  {0x7d, &Font_0x7d},
-#else
-  // character: '}' == ''
-  {0x7d, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '~'
-  {0x7e, &Font_0x7e}
-#else
-  // character: '~' == ''
-  {0x7e, &Font_0x}
-#endif
-
-};
-
-
-//const tFont Font = { 95, Font_array };
-
-const tChar* GetFontFixedSys8_14(uint8_t ASCII)
-{
- //  return (const tChar*)&Font_array[ASCII - 0x20];
-   return &Font_array[ASCII - 0x20];
-}
-
+
+/*******************************************************************************
+* font
+* filename: unsaved
+* name: Font
+* family: Fixedsys
+* size: 10
+* style: Normal
+* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+* antialiasing: no
+* type: proportional
+* encoding: ASMO-708
+* unicode bom: no
+*
+* preset name: Monochrome_TB
+* data block size: 8 bit(s), uint8_t
+* RLE compression enabled: no
+* conversion type: Monochrome, Edge 128
+* bits per pixel: 1
+*
+* preprocess:
+*  main scan direction: top_to_bottom
+*  line scan direction: forward
+*  inverse: yes
+*******************************************************************************/
+
+/*
+ typedef struct {
+     long int code;
+     const tImage *image;
+     } tChar;
+ typedef struct {
+     int length;
+     const tChar *chars;
+     } tFont;
+*/
+
+#include <stdint.h>
+#include "fonts.h"
+
+
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x20[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x20 = { image_data_Font_0x20,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x21[14] = {
+    0x00, 
+    0x00, 
+    0x18, 
+    0x3c, 
+    0x3c, 
+    0x3c, 
+    0x18, 
+    0x18, 
+    0x00, 
+    0x18, 
+    0x18, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x21 = { image_data_Font_0x21,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x22[14] = {
+    0x00, 
+    0x00, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x22 = { image_data_Font_0x22,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x23[14] = {
+    0x00, 
+    0x00, 
+    0x36, 
+    0x36, 
+    0x7f, 
+    0x36, 
+    0x36, 
+    0x36, 
+    0x7f, 
+    0x36, 
+    0x36, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x23 = { image_data_Font_0x23,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x24[14] = {
+    0x18, 
+    0x18, 
+    0x3c, 
+    0x66, 
+    0x60, 
+    0x30, 
+    0x18, 
+    0x0c, 
+    0x06, 
+    0x66, 
+    0x3c, 
+    0x18, 
+    0x18, 
+    0x00
+};
+static const tImage Font_0x24 = { image_data_Font_0x24,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x25[14] = {
+    0x00, 
+    0x70, 
+    0xd8, 
+    0xda, 
+    0x76, 
+    0x0c, 
+    0x18, 
+    0x30, 
+    0x6e, 
+    0x5b, 
+    0x1b, 
+    0x0e, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x25 = { image_data_Font_0x25,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x26[14] = {
+    0x00, 
+    0x00, 
+    0x38, 
+    0x6c, 
+    0x6c, 
+    0x38, 
+    0x60, 
+    0x6f, 
+    0x66, 
+    0x66, 
+    0x3b, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x26 = { image_data_Font_0x26,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x27[14] = {
+    0x00, 
+    0x00, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x27 = { image_data_Font_0x27,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x28[14] = {
+    0x00, 
+    0x00, 
+    0x0c, 
+    0x18, 
+    0x18, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x18, 
+    0x18, 
+    0x0c, 
+    0x00
+};
+static const tImage Font_0x28 = { image_data_Font_0x28,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x29[14] = {
+    0x00, 
+    0x00, 
+    0x30, 
+    0x18, 
+    0x18, 
+    0x0c, 
+    0x0c, 
+    0x0c, 
+    0x0c, 
+    0x0c, 
+    0x18, 
+    0x18, 
+    0x30, 
+    0x00
+};
+static const tImage Font_0x29 = { image_data_Font_0x29,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x2a[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x36, 
+    0x1c, 
+    0x7f, 
+    0x1c, 
+    0x36, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x2a = { image_data_Font_0x2a,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x2b[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x18, 
+    0x18, 
+    0x7e, 
+    0x18, 
+    0x18, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x2b = { image_data_Font_0x2b,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x2c[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x1c, 
+    0x1c, 
+    0x0c, 
+    0x18, 
+    0x00
+};
+static const tImage Font_0x2c = { image_data_Font_0x2c,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x2d[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x7e, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x2d = { image_data_Font_0x2d,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x2e[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x1c, 
+    0x1c, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x2e = { image_data_Font_0x2e,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x2f[14] = {
+    0x00, 
+    0x00, 
+    0x06, 
+    0x06, 
+    0x0c, 
+    0x0c, 
+    0x18, 
+    0x18, 
+    0x30, 
+    0x30, 
+    0x60, 
+    0x60, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x2f = { image_data_Font_0x2f,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x30[14] = {
+    0x00, 
+    0x00, 
+    0x1e, 
+    0x33, 
+    0x37, 
+    0x37, 
+    0x33, 
+    0x3b, 
+    0x3b, 
+    0x33, 
+    0x1e, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x30 = { image_data_Font_0x30,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x31[14] = {
+    0x00, 
+    0x00, 
+    0x0c, 
+    0x1c, 
+    0x7c, 
+    0x0c, 
+    0x0c, 
+    0x0c, 
+    0x0c, 
+    0x0c, 
+    0x0c, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x31 = { image_data_Font_0x31,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x32[14] = {
+    0x00, 
+    0x00, 
+    0x3c, 
+    0x66, 
+    0x66, 
+    0x06, 
+    0x0c, 
+    0x18, 
+    0x30, 
+    0x60, 
+    0x7e, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x32 = { image_data_Font_0x32,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x33[14] = {
+    0x00, 
+    0x00, 
+    0x3c, 
+    0x66, 
+    0x66, 
+    0x06, 
+    0x1c, 
+    0x06, 
+    0x66, 
+    0x66, 
+    0x3c, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x33 = { image_data_Font_0x33,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x34[14] = {
+    0x00, 
+    0x00, 
+    0x30, 
+    0x30, 
+    0x36, 
+    0x36, 
+    0x36, 
+    0x66, 
+    0x7f, 
+    0x06, 
+    0x06, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x34 = { image_data_Font_0x34,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x35[14] = {
+    0x00, 
+    0x00, 
+    0x7e, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x7c, 
+    0x06, 
+    0x06, 
+    0x0c, 
+    0x78, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x35 = { image_data_Font_0x35,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x36[14] = {
+    0x00, 
+    0x00, 
+    0x1c, 
+    0x18, 
+    0x30, 
+    0x7c, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x3c, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x36 = { image_data_Font_0x36,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x37[14] = {
+    0x00, 
+    0x00, 
+    0x7e, 
+    0x06, 
+    0x0c, 
+    0x0c, 
+    0x18, 
+    0x18, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x37 = { image_data_Font_0x37,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x38[14] = {
+    0x00, 
+    0x00, 
+    0x3c, 
+    0x66, 
+    0x66, 
+    0x76, 
+    0x3c, 
+    0x6e, 
+    0x66, 
+    0x66, 
+    0x3c, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x38 = { image_data_Font_0x38,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x39[14] = {
+    0x00, 
+    0x00, 
+    0x3c, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x3e, 
+    0x0c, 
+    0x18, 
+    0x38, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x39 = { image_data_Font_0x39,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x3a[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x1c, 
+    0x1c, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x1c, 
+    0x1c, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x3a = { image_data_Font_0x3a,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x3b[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x1c, 
+    0x1c, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x1c, 
+    0x1c, 
+    0x0c, 
+    0x18, 
+    0x00
+};
+static const tImage Font_0x3b = { image_data_Font_0x3b,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x3c[14] = {
+    0x00, 
+    0x00, 
+    0x06, 
+    0x0c, 
+    0x18, 
+    0x30, 
+    0x60, 
+    0x30, 
+    0x18, 
+    0x0c, 
+    0x06, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x3c = { image_data_Font_0x3c,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x3d[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x7e, 
+    0x00, 
+    0x7e, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x3d = { image_data_Font_0x3d,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x3e[14] = {
+    0x00, 
+    0x00, 
+    0x60, 
+    0x30, 
+    0x18, 
+    0x0c, 
+    0x06, 
+    0x0c, 
+    0x18, 
+    0x30, 
+    0x60, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x3e = { image_data_Font_0x3e,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x3f[14] = {
+    0x00, 
+    0x00, 
+    0x3c, 
+    0x66, 
+    0x66, 
+    0x0c, 
+    0x18, 
+    0x18, 
+    0x00, 
+    0x18, 
+    0x18, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x3f = { image_data_Font_0x3f,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x40[14] = {
+    0x00, 
+    0x00, 
+    0x7e, 
+    0xc3, 
+    0xc3, 
+    0xcf, 
+    0xdb, 
+    0xdb, 
+    0xcf, 
+    0xc0, 
+    0x7f, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x40 = { image_data_Font_0x40,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x41[14] = {
+    0x00, 
+    0x00, 
+    0x18, 
+    0x3c, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x7e, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x41 = { image_data_Font_0x41,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x42[14] = {
+    0x00, 
+    0x00, 
+    0x7c, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x7c, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x7c, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x42 = { image_data_Font_0x42,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x43[14] = {
+    0x00, 
+    0x00, 
+    0x3c, 
+    0x66, 
+    0x66, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x66, 
+    0x66, 
+    0x3c, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x43 = { image_data_Font_0x43,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x44[14] = {
+    0x00, 
+    0x00, 
+    0x78, 
+    0x6c, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x6c, 
+    0x78, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x44 = { image_data_Font_0x44,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x45[14] = {
+    0x00, 
+    0x00, 
+    0x7e, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x7c, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x7e, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x45 = { image_data_Font_0x45,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x46[14] = {
+    0x00, 
+    0x00, 
+    0x7e, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x7c, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x46 = { image_data_Font_0x46,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x47[14] = {
+    0x00, 
+    0x00, 
+    0x3c, 
+    0x66, 
+    0x66, 
+    0x60, 
+    0x60, 
+    0x6e, 
+    0x66, 
+    0x66, 
+    0x3e, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x47 = { image_data_Font_0x47,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x48[14] = {
+    0x00, 
+    0x00, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x7e, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x48 = { image_data_Font_0x48,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x49[14] = {
+    0x00, 
+    0x00, 
+    0x3c, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x3c, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x49 = { image_data_Font_0x49,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x4a[14] = {
+    0x00, 
+    0x00, 
+    0x06, 
+    0x06, 
+    0x06, 
+    0x06, 
+    0x06, 
+    0x06, 
+    0x66, 
+    0x66, 
+    0x3c, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x4a = { image_data_Font_0x4a,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x4b[14] = {
+    0x00, 
+    0x00, 
+    0x66, 
+    0x66, 
+    0x6c, 
+    0x6c, 
+    0x78, 
+    0x6c, 
+    0x6c, 
+    0x66, 
+    0x66, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x4b = { image_data_Font_0x4b,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x4c[14] = {
+    0x00, 
+    0x00, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x7e, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x4c = { image_data_Font_0x4c,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x4d[14] = {
+    0x00, 
+    0x00, 
+    0x63, 
+    0x63, 
+    0x77, 
+    0x6b, 
+    0x6b, 
+    0x6b, 
+    0x63, 
+    0x63, 
+    0x63, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x4d = { image_data_Font_0x4d,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x4e[14] = {
+    0x00, 
+    0x00, 
+    0x63, 
+    0x63, 
+    0x73, 
+    0x7b, 
+    0x6f, 
+    0x67, 
+    0x63, 
+    0x63, 
+    0x63, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x4e = { image_data_Font_0x4e,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x4f[14] = {
+    0x00, 
+    0x00, 
+    0x3c, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x3c, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x4f = { image_data_Font_0x4f,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x50[14] = {
+    0x00, 
+    0x00, 
+    0x7c, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x7c, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x50 = { image_data_Font_0x50,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x51[14] = {
+    0x00, 
+    0x00, 
+    0x3c, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x3c, 
+    0x0c, 
+    0x06, 
+    0x00
+};
+static const tImage Font_0x51 = { image_data_Font_0x51,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x52[14] = {
+    0x00, 
+    0x00, 
+    0x7c, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x7c, 
+    0x6c, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x52 = { image_data_Font_0x52,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x53[14] = {
+    0x00, 
+    0x00, 
+    0x3c, 
+    0x66, 
+    0x60, 
+    0x30, 
+    0x18, 
+    0x0c, 
+    0x06, 
+    0x66, 
+    0x3c, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x53 = { image_data_Font_0x53,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x54[14] = {
+    0x00, 
+    0x00, 
+    0x7e, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x54 = { image_data_Font_0x54,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x55[14] = {
+    0x00, 
+    0x00, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x3c, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x55 = { image_data_Font_0x55,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x56[14] = {
+    0x00, 
+    0x00, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x3c, 
+    0x18, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x56 = { image_data_Font_0x56,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x57[14] = {
+    0x00, 
+    0x00, 
+    0x63, 
+    0x63, 
+    0x63, 
+    0x6b, 
+    0x6b, 
+    0x6b, 
+    0x36, 
+    0x36, 
+    0x36, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x57 = { image_data_Font_0x57,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x58[14] = {
+    0x00, 
+    0x00, 
+    0x66, 
+    0x66, 
+    0x34, 
+    0x18, 
+    0x18, 
+    0x2c, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x58 = { image_data_Font_0x58,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x59[14] = {
+    0x00, 
+    0x00, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x3c, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x59 = { image_data_Font_0x59,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x5a[14] = {
+    0x00, 
+    0x00, 
+    0x7e, 
+    0x06, 
+    0x06, 
+    0x0c, 
+    0x18, 
+    0x30, 
+    0x60, 
+    0x60, 
+    0x7e, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x5a = { image_data_Font_0x5a,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x5b[14] = {
+    0x00, 
+    0x00, 
+    0x3c, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x3c
+};
+static const tImage Font_0x5b = { image_data_Font_0x5b,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x5c[14] = {
+    0x00, 
+    0x00, 
+    0x60, 
+    0x60, 
+    0x30, 
+    0x30, 
+    0x18, 
+    0x18, 
+    0x0c, 
+    0x0c, 
+    0x06, 
+    0x06, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x5c = { image_data_Font_0x5c,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x5d[14] = {
+    0x00, 
+    0x00, 
+    0x3c, 
+    0x0c, 
+    0x0c, 
+    0x0c, 
+    0x0c, 
+    0x0c, 
+    0x0c, 
+    0x0c, 
+    0x0c, 
+    0x0c, 
+    0x0c, 
+    0x3c
+};
+static const tImage Font_0x5d = { image_data_Font_0x5d,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x5e[14] = {
+    0x18, 
+    0x3c, 
+    0x66, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x5e = { image_data_Font_0x5e,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x5f[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0xff
+};
+static const tImage Font_0x5f = { image_data_Font_0x5f,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x60[14] = {
+    0x38, 
+    0x18, 
+    0x0c, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x60 = { image_data_Font_0x60,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x61[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x3c, 
+    0x06, 
+    0x06, 
+    0x3e, 
+    0x66, 
+    0x66, 
+    0x3e, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x61 = { image_data_Font_0x61,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x62[14] = {
+    0x00, 
+    0x00, 
+    0x60, 
+    0x60, 
+    0x7c, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x7c, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x62 = { image_data_Font_0x62,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x63[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x3c, 
+    0x66, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x66, 
+    0x3c, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x63 = { image_data_Font_0x63,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x64[14] = {
+    0x00, 
+    0x00, 
+    0x06, 
+    0x06, 
+    0x3e, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x3e, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x64 = { image_data_Font_0x64,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x65[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x3c, 
+    0x66, 
+    0x66, 
+    0x7e, 
+    0x60, 
+    0x60, 
+    0x3c, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x65 = { image_data_Font_0x65,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x66[14] = {
+    0x00, 
+    0x00, 
+    0x1e, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x7e, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x66 = { image_data_Font_0x66,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x67[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x3e, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x3e, 
+    0x06, 
+    0x06, 
+    0x7c
+};
+static const tImage Font_0x67 = { image_data_Font_0x67,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x68[14] = {
+    0x00, 
+    0x00, 
+    0x60, 
+    0x60, 
+    0x7c, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x68 = { image_data_Font_0x68,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x69[14] = {
+    0x00, 
+    0x18, 
+    0x18, 
+    0x00, 
+    0x78, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x7e, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x69 = { image_data_Font_0x69,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x6a[14] = {
+    0x00, 
+    0x0c, 
+    0x0c, 
+    0x00, 
+    0x3c, 
+    0x0c, 
+    0x0c, 
+    0x0c, 
+    0x0c, 
+    0x0c, 
+    0x0c, 
+    0x0c, 
+    0x0c, 
+    0x78
+};
+static const tImage Font_0x6a = { image_data_Font_0x6a,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x6b[14] = {
+    0x00, 
+    0x00, 
+    0x60, 
+    0x60, 
+    0x66, 
+    0x66, 
+    0x6c, 
+    0x78, 
+    0x6c, 
+    0x66, 
+    0x66, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x6b = { image_data_Font_0x6b,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x6c[14] = {
+    0x00, 
+    0x00, 
+    0x78, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x7e, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x6c = { image_data_Font_0x6c,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x6d[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x7e, 
+    0x6b, 
+    0x6b, 
+    0x6b, 
+    0x6b, 
+    0x6b, 
+    0x63, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x6d = { image_data_Font_0x6d,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x6e[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x7c, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x6e = { image_data_Font_0x6e,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x6f[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x3c, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x3c, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x6f = { image_data_Font_0x6f,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x70[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x7c, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x7c, 
+    0x60, 
+    0x60, 
+    0x60
+};
+static const tImage Font_0x70 = { image_data_Font_0x70,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x71[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x3e, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x3e, 
+    0x06, 
+    0x06, 
+    0x06
+};
+static const tImage Font_0x71 = { image_data_Font_0x71,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x72[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x66, 
+    0x6e, 
+    0x70, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x72 = { image_data_Font_0x72,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x73[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x3e, 
+    0x60, 
+    0x60, 
+    0x3c, 
+    0x06, 
+    0x06, 
+    0x7c, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x73 = { image_data_Font_0x73,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x74[14] = {
+    0x00, 
+    0x00, 
+    0x30, 
+    0x30, 
+    0x7e, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x1e, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x74 = { image_data_Font_0x74,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x75[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x3e, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x75 = { image_data_Font_0x75,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x76[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x3c, 
+    0x18, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x76 = { image_data_Font_0x76,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x77[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x63, 
+    0x6b, 
+    0x6b, 
+    0x6b, 
+    0x6b, 
+    0x36, 
+    0x36, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x77 = { image_data_Font_0x77,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x78[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x66, 
+    0x66, 
+    0x3c, 
+    0x18, 
+    0x3c, 
+    0x66, 
+    0x66, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x78 = { image_data_Font_0x78,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x79[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x66, 
+    0x3c, 
+    0x0c, 
+    0x18, 
+    0xf0
+};
+static const tImage Font_0x79 = { image_data_Font_0x79,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x7a[14] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x7e, 
+    0x06, 
+    0x0c, 
+    0x18, 
+    0x30, 
+    0x60, 
+    0x7e, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x7a = { image_data_Font_0x7a,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x7b[14] = {
+    0x00, 
+    0x00, 
+    0x0c, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x30, 
+    0x60, 
+    0x30, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x0c, 
+    0x00
+};
+static const tImage Font_0x7b = { image_data_Font_0x7b,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x7c[14] = {
+    0x00, 
+    0x00, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18
+};
+static const tImage Font_0x7c = { image_data_Font_0x7c,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x7d[14] = {
+    0x00, 
+    0x00, 
+    0x30, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x0c, 
+    0x06, 
+    0x0c, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x30, 
+    0x00
+};
+static const tImage Font_0x7d = { image_data_Font_0x7d,
+    8, 14, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x7e[14] = {
+    0x00, 
+    0x00, 
+    0x71, 
+    0xdb, 
+    0x8e, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x7e = { image_data_Font_0x7e,
+    8, 14, 8};
+#endif
+
+
+static const tChar Font_array[] = {
+
+#if (0x0 == 0x0)
+  // character: ' '
+  {0x20, &Font_0x20},
+#else
+  // character: ' ' == ''
+  {0x20, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '!'
+  {0x21, &Font_0x21},
+#else
+  // character: '!' == ''
+  {0x21, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '"'
+  {0x22, &Font_0x22},
+#else
+  // character: '"' == ''
+  {0x22, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '#'
+  {0x23, &Font_0x23},
+#else
+  // character: '#' == ''
+  {0x23, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '$'
+  {0x24, &Font_0x24},
+#else
+  // character: '$' == ''
+  {0x24, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '%'
+  {0x25, &Font_0x25},
+#else
+  // character: '%' == ''
+  {0x25, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '&'
+  {0x26, &Font_0x26},
+#else
+  // character: '&' == ''
+  {0x26, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '''
+  {0x27, &Font_0x27},
+#else
+  // character: ''' == ''
+  {0x27, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '('
+  {0x28, &Font_0x28},
+#else
+  // character: '(' == ''
+  {0x28, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: ')'
+  {0x29, &Font_0x29},
+#else
+  // character: ')' == ''
+  {0x29, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '*'
+  {0x2a, &Font_0x2a},
+#else
+  // character: '*' == ''
+  {0x2a, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '+'
+  {0x2b, &Font_0x2b},
+#else
+  // character: '+' == ''
+  {0x2b, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: ','
+  {0x2c, &Font_0x2c},
+#else
+  // character: ',' == ''
+  {0x2c, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '-'
+  {0x2d, &Font_0x2d},
+#else
+  // character: '-' == ''
+  {0x2d, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '.'
+  {0x2e, &Font_0x2e},
+#else
+  // character: '.' == ''
+  {0x2e, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '/'
+  {0x2f, &Font_0x2f},
+#else
+  // character: '/' == ''
+  {0x2f, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '0'
+  {0x30, &Font_0x30},
+#else
+  // character: '0' == ''
+  {0x30, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '1'
+  {0x31, &Font_0x31},
+#else
+  // character: '1' == ''
+  {0x31, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '2'
+  {0x32, &Font_0x32},
+#else
+  // character: '2' == ''
+  {0x32, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '3'
+  {0x33, &Font_0x33},
+#else
+  // character: '3' == ''
+  {0x33, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '4'
+  {0x34, &Font_0x34},
+#else
+  // character: '4' == ''
+  {0x34, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '5'
+  {0x35, &Font_0x35},
+#else
+  // character: '5' == ''
+  {0x35, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '6'
+  {0x36, &Font_0x36},
+#else
+  // character: '6' == ''
+  {0x36, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '7'
+  {0x37, &Font_0x37},
+#else
+  // character: '7' == ''
+  {0x37, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '8'
+  {0x38, &Font_0x38},
+#else
+  // character: '8' == ''
+  {0x38, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '9'
+  {0x39, &Font_0x39},
+#else
+  // character: '9' == ''
+  {0x39, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: ':'
+  {0x3a, &Font_0x3a},
+#else
+  // character: ':' == ''
+  {0x3a, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: ';'
+  {0x3b, &Font_0x3b},
+#else
+  // character: ';' == ''
+  {0x3b, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '<'
+  {0x3c, &Font_0x3c},
+#else
+  // character: '<' == ''
+  {0x3c, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '='
+  {0x3d, &Font_0x3d},
+#else
+  // character: '=' == ''
+  {0x3d, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '>'
+  {0x3e, &Font_0x3e},
+#else
+  // character: '>' == ''
+  {0x3e, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '?'
+  {0x3f, &Font_0x3f},
+#else
+  // character: '?' == ''
+  {0x3f, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '\x0040'
+  {0x40, &Font_0x40},
+#else
+  // character: '\x0040' == ''
+  {0x40, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'A'
+  {0x41, &Font_0x41},
+#else
+  // character: 'A' == ''
+  {0x41, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'B'
+  {0x42, &Font_0x42},
+#else
+  // character: 'B' == ''
+  {0x42, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'C'
+  {0x43, &Font_0x43},
+#else
+  // character: 'C' == ''
+  {0x43, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'D'
+  {0x44, &Font_0x44},
+#else
+  // character: 'D' == ''
+  {0x44, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'E'
+  {0x45, &Font_0x45},
+#else
+  // character: 'E' == ''
+  {0x45, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'F'
+  {0x46, &Font_0x46},
+#else
+  // character: 'F' == ''
+  {0x46, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'G'
+  {0x47, &Font_0x47},
+#else
+  // character: 'G' == ''
+  {0x47, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'H'
+  {0x48, &Font_0x48},
+#else
+  // character: 'H' == ''
+  {0x48, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'I'
+  {0x49, &Font_0x49},
+#else
+  // character: 'I' == ''
+  {0x49, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'J'
+  {0x4a, &Font_0x4a},
+#else
+  // character: 'J' == ''
+  {0x4a, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'K'
+  {0x4b, &Font_0x4b},
+#else
+  // character: 'K' == ''
+  {0x4b, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'L'
+  {0x4c, &Font_0x4c},
+#else
+  // character: 'L' == ''
+  {0x4c, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'M'
+  {0x4d, &Font_0x4d},
+#else
+  // character: 'M' == ''
+  {0x4d, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'N'
+  {0x4e, &Font_0x4e},
+#else
+  // character: 'N' == ''
+  {0x4e, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'O'
+  {0x4f, &Font_0x4f},
+#else
+  // character: 'O' == ''
+  {0x4f, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'P'
+  {0x50, &Font_0x50},
+#else
+  // character: 'P' == ''
+  {0x50, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'Q'
+  {0x51, &Font_0x51},
+#else
+  // character: 'Q' == ''
+  {0x51, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'R'
+  {0x52, &Font_0x52},
+#else
+  // character: 'R' == ''
+  {0x52, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'S'
+  {0x53, &Font_0x53},
+#else
+  // character: 'S' == ''
+  {0x53, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'T'
+  {0x54, &Font_0x54},
+#else
+  // character: 'T' == ''
+  {0x54, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'U'
+  {0x55, &Font_0x55},
+#else
+  // character: 'U' == ''
+  {0x55, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'V'
+  {0x56, &Font_0x56},
+#else
+  // character: 'V' == ''
+  {0x56, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'W'
+  {0x57, &Font_0x57},
+#else
+  // character: 'W' == ''
+  {0x57, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'X'
+  {0x58, &Font_0x58},
+#else
+  // character: 'X' == ''
+  {0x58, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'Y'
+  {0x59, &Font_0x59},
+#else
+  // character: 'Y' == ''
+  {0x59, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'Z'
+  {0x5a, &Font_0x5a},
+#else
+  // character: 'Z' == ''
+  {0x5a, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '['
+  {0x5b, &Font_0x5b},
+#else
+  // character: '[' == ''
+  {0x5b, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '\'
+  {0x5c, &Font_0x5c},
+#else
+  // character: '\' == ''
+  {0x5c, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: ']'
+  {0x5d, &Font_0x5d},
+#else
+  // character: ']' == ''
+  {0x5d, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '^'
+  {0x5e, &Font_0x5e},
+#else
+  // character: '^' == ''
+  {0x5e, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '_'
+  {0x5f, &Font_0x5f},
+#else
+  // character: '_' == ''
+  {0x5f, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '`'
+  {0x60, &Font_0x60},
+#else
+  // character: '`' == ''
+  {0x60, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'a'
+  {0x61, &Font_0x61},
+#else
+  // character: 'a' == ''
+  {0x61, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'b'
+  {0x62, &Font_0x62},
+#else
+  // character: 'b' == ''
+  {0x62, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'c'
+  {0x63, &Font_0x63},
+#else
+  // character: 'c' == ''
+  {0x63, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'd'
+  {0x64, &Font_0x64},
+#else
+  // character: 'd' == ''
+  {0x64, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'e'
+  {0x65, &Font_0x65},
+#else
+  // character: 'e' == ''
+  {0x65, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'f'
+  {0x66, &Font_0x66},
+#else
+  // character: 'f' == ''
+  {0x66, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'g'
+  {0x67, &Font_0x67},
+#else
+  // character: 'g' == ''
+  {0x67, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'h'
+  {0x68, &Font_0x68},
+#else
+  // character: 'h' == ''
+  {0x68, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'i'
+  {0x69, &Font_0x69},
+#else
+  // character: 'i' == ''
+  {0x69, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'j'
+  {0x6a, &Font_0x6a},
+#else
+  // character: 'j' == ''
+  {0x6a, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'k'
+  {0x6b, &Font_0x6b},
+#else
+  // character: 'k' == ''
+  {0x6b, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'l'
+  {0x6c, &Font_0x6c},
+#else
+  // character: 'l' == ''
+  {0x6c, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'm'
+  {0x6d, &Font_0x6d},
+#else
+  // character: 'm' == ''
+  {0x6d, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'n'
+  {0x6e, &Font_0x6e},
+#else
+  // character: 'n' == ''
+  {0x6e, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'o'
+  {0x6f, &Font_0x6f},
+#else
+  // character: 'o' == ''
+  {0x6f, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'p'
+  {0x70, &Font_0x70},
+#else
+  // character: 'p' == ''
+  {0x70, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'q'
+  {0x71, &Font_0x71},
+#else
+  // character: 'q' == ''
+  {0x71, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'r'
+  {0x72, &Font_0x72},
+#else
+  // character: 'r' == ''
+  {0x72, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 's'
+  {0x73, &Font_0x73},
+#else
+  // character: 's' == ''
+  {0x73, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 't'
+  {0x74, &Font_0x74},
+#else
+  // character: 't' == ''
+  {0x74, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'u'
+  {0x75, &Font_0x75},
+#else
+  // character: 'u' == ''
+  {0x75, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'v'
+  {0x76, &Font_0x76},
+#else
+  // character: 'v' == ''
+  {0x76, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'w'
+  {0x77, &Font_0x77},
+#else
+  // character: 'w' == ''
+  {0x77, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'x'
+  {0x78, &Font_0x78},
+#else
+  // character: 'x' == ''
+  {0x78, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'y'
+  {0x79, &Font_0x79},
+#else
+  // character: 'y' == ''
+  {0x79, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'z'
+  {0x7a, &Font_0x7a},
+#else
+  // character: 'z' == ''
+  {0x7a, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '{'
+  {0x7b, &Font_0x7b},
+#else
+  // character: '{' == ''
+  {0x7b, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '|'
+  {0x7c, &Font_0x7c},
+#else
+  // character: '|' == ''
+  {0x7c, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '}'
+  {0x7d, &Font_0x7d},
+#else
+  // character: '}' == ''
+  {0x7d, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '~'
+  {0x7e, &Font_0x7e}
+#else
+  // character: '~' == ''
+  {0x7e, &Font_0x}
+#endif
+
+};
+
+
+//const tFont Font = { 95, Font_array };
+
+const tChar* GetFontFixedSys8_14(uint8_t ASCII)
+{
+ //  return (const tChar*)&Font_array[ASCII - 0x20];
+   if((uint8_t)(ASCII - 0x20) >= (sizeof(Font_array) / sizeof(Font_array[0])))
+      ASCII = FONT_DEFAULT_CHAR;
+   return &Font_array[ASCII - 0x20];
+}
+
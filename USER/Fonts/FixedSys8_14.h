@@ -1,17 +1,18 @@
-/**
-*  @file   FixedSys8_14.h
-*  @author Rob Gee
-*  @date   November 2017
-*  @brief  Include file for courier new 8x14
-*/
-
-#ifndef FIXEDSYS8_14_H
-#define FIXEDSYS8_14_H
-
-
-
-/*-- Exported Functions ------------------------------------------------------*/
-const tChar* GetFontFixedSys8_14(uint8_t ASCII);
-
-
-#endif
+/**
+*  @file   FixedSys8_14.h
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Include file for courier new 8x14
+*/
+
+#ifndef FIXEDSYS8_14_H
+#define FIXEDSYS8_14_H
+
+
+
+/*-- Exported Functions ------------------------------------------------------*/
+const tChar* GetFontFixedSys8_14(uint8_t ASCII);
+extern const tPackedFont PackedFixedSys8_14;
+
+
+#endif
@@ -1,2714 +1,2716 @@
-
-/*******************************************************************************
-* font
-* filename: unsaved
-* name: Font
-* family: Nokia Large
-* size: 12
-* style: Bold
-* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
-* antialiasing: no
-* type: proportional
-* encoding: ASMO-708
-* unicode bom: no
-*
-* preset name: Monochrome_TB
-* data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
-* conversion type: Monochrome, Edge 128
-* bits per pixel: 1
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: yes
-*******************************************************************************/
-
-#include <stdint.h>
-#include "fonts.h"
-
-/*
- typedef struct {
-     long int code;
-     const tImage *image;
-     } tChar;
- typedef struct {
-     int length;
-     const tChar *chars;
-     } tFont;
-*/
-
-
-
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x20[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x20 = { image_data_Font_0x20,
-    2, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x21[13] = {
-    0x00, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x00, 
-    0x60, 
-    0x60, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x21 = { image_data_Font_0x21,
-    3, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x22[13] = {
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x22 = { image_data_Font_0x22,
-    5, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x23[13] = {
-    0x00, 
-    0x24, 
-    0x24, 
-    0xfe, 
-    0x24, 
-    0x24, 
-    0xfe, 
-    0x48, 
-    0x48, 
-    0x48, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x23 = { image_data_Font_0x23,
-    8, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x24[13] = {
-    0x20, 
-    0x78, 
-    0xc0, 
-    0xc0, 
-    0xe0, 
-    0x70, 
-    0x38, 
-    0x18, 
-    0x18, 
-    0xf0, 
-    0x20, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x24 = { image_data_Font_0x24,
-    6, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x25[26] = {
-    0x00, 0x00, 
-    0x62, 0x00, 
-    0x96, 0x00, 
-    0x94, 0x00, 
-    0x9c, 0x00, 
-    0x6b, 0x00, 
-    0x1c, 0x80, 
-    0x14, 0x80, 
-    0x34, 0x80, 
-    0x23, 0x00, 
-    0x00, 0x00, 
-    0x00, 0x00, 
-    0x00, 0x00
-};
-static const tImage Font_0x25 = { image_data_Font_0x25,
-    10, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x26[13] = {
-    0x00, 
-    0x38, 
-    0x6c, 
-    0x6c, 
-    0x38, 
-    0x79, 
-    0xdb, 
-    0xce, 
-    0xc6, 
-    0x7b, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x26 = { image_data_Font_0x26,
-    8, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x27[13] = {
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x27 = { image_data_Font_0x27,
-    3, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x28[13] = {
-    0x60, 
-    0x40, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0x40, 
-    0x60, 
-    0x00
-};
-static const tImage Font_0x28 = { image_data_Font_0x28,
-    4, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x29[13] = {
-    0x60, 
-    0x20, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x20, 
-    0x60, 
-    0x00
-};
-static const tImage Font_0x29 = { image_data_Font_0x29,
-    4, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x2a[13] = {
-    0x00, 
-    0x20, 
-    0xf8, 
-    0x20, 
-    0xf8, 
-    0x20, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x2a = { image_data_Font_0x2a,
-    6, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x2b[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x30, 
-    0x30, 
-    0xfc, 
-    0xfc, 
-    0x30, 
-    0x30, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x2b = { image_data_Font_0x2b,
-    6, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x2c[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x60, 
-    0x40, 
-    0xc0, 
-    0x80, 
-    0x00
-};
-static const tImage Font_0x2c = { image_data_Font_0x2c,
-    3, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x2d[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0xe0, 
-    0xe0, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x2d = { image_data_Font_0x2d,
-    4, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x2e[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0xc0, 
-    0xc0, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x2e = { image_data_Font_0x2e,
-    3, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x2f[13] = {
-    0x10, 
-    0x10, 
-    0x10, 
-    0x20, 
-    0x20, 
-    0x20, 
-    0x40, 
-    0x40, 
-    0x40, 
-    0x80, 
-    0x80, 
-    0x80, 
-    0x00
-};
-static const tImage Font_0x2f = { image_data_Font_0x2f,
-    4, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x30[13] = {
-    0x00, 
-    0x78, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0x78, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x30 = { image_data_Font_0x30,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x31[13] = {
-    0x00, 
-    0x60, 
-    0xe0, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0xf0, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x31 = { image_data_Font_0x31,
-    5, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x32[13] = {
-    0x00, 
-    0xf0, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x30, 
-    0x60, 
-    0xe0, 
-    0xc0, 
-    0xf8, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x32 = { image_data_Font_0x32,
-    6, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x33[13] = {
-    0x00, 
-    0xf0, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x60, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0xf0, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x33 = { image_data_Font_0x33,
-    6, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x34[13] = {
-    0x00, 
-    0x18, 
-    0x38, 
-    0x38, 
-    0x58, 
-    0x58, 
-    0xd8, 
-    0xfc, 
-    0x18, 
-    0x18, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x34 = { image_data_Font_0x34,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x35[13] = {
-    0x00, 
-    0xf8, 
-    0xc0, 
-    0xc0, 
-    0xf0, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0x18, 
-    0xf0, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x35 = { image_data_Font_0x35,
-    6, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x36[13] = {
-    0x00, 
-    0x38, 
-    0x60, 
-    0xc0, 
-    0xf8, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0x78, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x36 = { image_data_Font_0x36,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x37[13] = {
-    0x00, 
-    0xf8, 
-    0x18, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x37 = { image_data_Font_0x37,
-    6, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x38[13] = {
-    0x00, 
-    0x78, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0x78, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0x78, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x38 = { image_data_Font_0x38,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x39[13] = {
-    0x00, 
-    0x78, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0x7c, 
-    0x0c, 
-    0x18, 
-    0x70, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x39 = { image_data_Font_0x39,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x3a[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x60, 
-    0x60, 
-    0x00, 
-    0x00, 
-    0x60, 
-    0x60, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x3a = { image_data_Font_0x3a,
-    3, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x3b[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x60, 
-    0x60, 
-    0x00, 
-    0x00, 
-    0x60, 
-    0x40, 
-    0xc0, 
-    0x80, 
-    0x00
-};
-static const tImage Font_0x3b = { image_data_Font_0x3b,
-    3, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x3c[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x0c, 
-    0x7c, 
-    0x80, 
-    0x70, 
-    0x1c, 
-    0x04, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x3c = { image_data_Font_0x3c,
-    6, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x3d[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0xfc, 
-    0xfc, 
-    0x00, 
-    0xfc, 
-    0xfc, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x3d = { image_data_Font_0x3d,
-    6, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x3e[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0xc0, 
-    0xf8, 
-    0x1c, 
-    0x38, 
-    0xe0, 
-    0x80, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x3e = { image_data_Font_0x3e,
-    6, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x3f[13] = {
-    0x00, 
-    0x70, 
-    0x18, 
-    0x18, 
-    0x38, 
-    0x70, 
-    0x60, 
-    0x00, 
-    0x60, 
-    0x60, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x3f = { image_data_Font_0x3f,
-    5, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x40[26] = {
-    0x00, 0x00, 
-    0x1f, 0x00, 
-    0x61, 0x80, 
-    0x4f, 0xc0, 
-    0x8a, 0x40, 
-    0x92, 0x40, 
-    0x92, 0x40, 
-    0x96, 0x40, 
-    0x4f, 0x80, 
-    0x60, 0x00, 
-    0x1f, 0x00, 
-    0x00, 0x00, 
-    0x00, 0x00
-};
-static const tImage Font_0x40 = { image_data_Font_0x40,
-    10, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x41[13] = {
-    0x00, 
-    0x70, 
-    0x70, 
-    0x58, 
-    0x58, 
-    0x58, 
-    0xd8, 
-    0xfc, 
-    0xcc, 
-    0xcc, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x41 = { image_data_Font_0x41,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x42[13] = {
-    0x00, 
-    0xf8, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xf8, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xf8, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x42 = { image_data_Font_0x42,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x43[13] = {
-    0x00, 
-    0x70, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0x70, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x43 = { image_data_Font_0x43,
-    5, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x44[13] = {
-    0x00, 
-    0xf8, 
-    0xd8, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xd8, 
-    0xf0, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x44 = { image_data_Font_0x44,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x45[13] = {
-    0x00, 
-    0xf0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xf0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xf0, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x45 = { image_data_Font_0x45,
-    5, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x46[13] = {
-    0x00, 
-    0xf0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xf0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x46 = { image_data_Font_0x46,
-    5, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x47[13] = {
-    0x00, 
-    0x3c, 
-    0x60, 
-    0xc0, 
-    0xc0, 
-    0xdc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0x74, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x47 = { image_data_Font_0x47,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x48[13] = {
-    0x00, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xfc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x48 = { image_data_Font_0x48,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x49[13] = {
-    0x00, 
-    0xf0, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0xf0, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x49 = { image_data_Font_0x49,
-    4, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x4a[13] = {
-    0x00, 
-    0xf0, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0xc0, 
-    0x00
-};
-static const tImage Font_0x4a = { image_data_Font_0x4a,
-    4, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x4b[13] = {
-    0x00, 
-    0xcc, 
-    0xd8, 
-    0xd8, 
-    0xf0, 
-    0xf0, 
-    0xf8, 
-    0xd8, 
-    0xdc, 
-    0xcc, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x4b = { image_data_Font_0x4b,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x4c[13] = {
-    0x00, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xf0, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x4c = { image_data_Font_0x4c,
-    5, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x4d[26] = {
-    0x00, 0x00, 
-    0xc3, 0x00, 
-    0xe7, 0x00, 
-    0xe7, 0x00, 
-    0xff, 0x00, 
-    0xdb, 0x00, 
-    0xdb, 0x00, 
-    0xc3, 0x00, 
-    0xc3, 0x00, 
-    0xc3, 0x00, 
-    0x00, 0x00, 
-    0x00, 0x00, 
-    0x00, 0x00
-};
-static const tImage Font_0x4d = { image_data_Font_0x4d,
-    9, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x4e[13] = {
-    0x00, 
-    0xc6, 
-    0xe6, 
-    0xe6, 
-    0xf6, 
-    0xd6, 
-    0xde, 
-    0xce, 
-    0xce, 
-    0xc6, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x4e = { image_data_Font_0x4e,
-    8, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x4f[13] = {
-    0x00, 
-    0x78, 
-    0x48, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0x48, 
-    0x78, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x4f = { image_data_Font_0x4f,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x50[13] = {
-    0x00, 
-    0xf0, 
-    0xd8, 
-    0xd8, 
-    0xd8, 
-    0xd8, 
-    0xf0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x50 = { image_data_Font_0x50,
-    6, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x51[13] = {
-    0x00, 
-    0x78, 
-    0x48, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0x48, 
-    0x78, 
-    0x30, 
-    0x18, 
-    0x00
-};
-static const tImage Font_0x51 = { image_data_Font_0x51,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x52[13] = {
-    0x00, 
-    0xf8, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xf8, 
-    0xd8, 
-    0xd8, 
-    0xcc, 
-    0xcc, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x52 = { image_data_Font_0x52,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x53[13] = {
-    0x00, 
-    0x78, 
-    0xc0, 
-    0xc0, 
-    0xe0, 
-    0x70, 
-    0x38, 
-    0x18, 
-    0x18, 
-    0xf0, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x53 = { image_data_Font_0x53,
-    6, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x54[13] = {
-    0x00, 
-    0xfc, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x54 = { image_data_Font_0x54,
-    6, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x55[13] = {
-    0x00, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0x78, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x55 = { image_data_Font_0x55,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x56[13] = {
-    0x00, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0x6c, 
-    0x68, 
-    0x68, 
-    0x68, 
-    0x38, 
-    0x38, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x56 = { image_data_Font_0x56,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x57[26] = {
-    0x00, 0x00, 
-    0xcc, 0xc0, 
-    0xcc, 0xc0, 
-    0xce, 0xc0, 
-    0xde, 0xc0, 
-    0xde, 0x80, 
-    0x52, 0x80, 
-    0x52, 0x80, 
-    0x73, 0x80, 
-    0x73, 0x80, 
-    0x00, 0x00, 
-    0x00, 0x00, 
-    0x00, 0x00
-};
-static const tImage Font_0x57 = { image_data_Font_0x57,
-    11, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x58[13] = {
-    0x00, 
-    0xcc, 
-    0xe8, 
-    0x78, 
-    0x70, 
-    0x30, 
-    0x38, 
-    0x78, 
-    0x5c, 
-    0xcc, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x58 = { image_data_Font_0x58,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x59[13] = {
-    0x00, 
-    0xd8, 
-    0xd8, 
-    0xd0, 
-    0xd0, 
-    0x70, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x59 = { image_data_Font_0x59,
-    6, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x5a[13] = {
-    0x00, 
-    0xf8, 
-    0x18, 
-    0x30, 
-    0x30, 
-    0x70, 
-    0x60, 
-    0x60, 
-    0xc0, 
-    0xf8, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x5a = { image_data_Font_0x5a,
-    6, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x5b[13] = {
-    0xe0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xe0, 
-    0x00
-};
-static const tImage Font_0x5b = { image_data_Font_0x5b,
-    4, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x5c[13] = {
-    0x80, 
-    0x80, 
-    0x80, 
-    0x40, 
-    0x40, 
-    0x40, 
-    0x20, 
-    0x20, 
-    0x20, 
-    0x10, 
-    0x10, 
-    0x10, 
-    0x00
-};
-static const tImage Font_0x5c = { image_data_Font_0x5c,
-    4, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x5d[13] = {
-    0x70, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x30, 
-    0x70, 
-    0x00
-};
-static const tImage Font_0x5d = { image_data_Font_0x5d,
-    4, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x5e[13] = {
-    0x00, 
-    0x20, 
-    0x70, 
-    0x78, 
-    0xc8, 
-    0xcc, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x5e = { image_data_Font_0x5e,
-    6, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x5f[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0xf0, 
-    0x00
-};
-static const tImage Font_0x5f = { image_data_Font_0x5f,
-    4, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x60[13] = {
-    0x00, 
-    0xc0, 
-    0x60, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x60 = { image_data_Font_0x60,
-    4, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x61[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x70, 
-    0x18, 
-    0x18, 
-    0x78, 
-    0xd8, 
-    0xd8, 
-    0xe8, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x61 = { image_data_Font_0x61,
-    6, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x62[13] = {
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xf8, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xb8, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x62 = { image_data_Font_0x62,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x63[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x70, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0x70, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x63 = { image_data_Font_0x63,
-    5, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x64[13] = {
-    0x0c, 
-    0x0c, 
-    0x0c, 
-    0x7c, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0x74, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x64 = { image_data_Font_0x64,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x65[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x70, 
-    0xd8, 
-    0xd8, 
-    0xf8, 
-    0xc0, 
-    0xc0, 
-    0x78, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x65 = { image_data_Font_0x65,
-    6, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x66[13] = {
-    0x30, 
-    0x60, 
-    0x60, 
-    0xf0, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x66 = { image_data_Font_0x66,
-    4, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x67[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x74, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0x7c, 
-    0x0c, 
-    0xf8, 
-    0x00
-};
-static const tImage Font_0x67 = { image_data_Font_0x67,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x68[13] = {
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xf8, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x68 = { image_data_Font_0x68,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x69[13] = {
-    0xc0, 
-    0xc0, 
-    0x00, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x69 = { image_data_Font_0x69,
-    3, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x6a[13] = {
-    0xc0, 
-    0xc0, 
-    0x00, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0x80, 
-    0x00
-};
-static const tImage Font_0x6a = { image_data_Font_0x6a,
-    3, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x6b[13] = {
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xd8, 
-    0xd8, 
-    0xf0, 
-    0xf0, 
-    0xf0, 
-    0xd8, 
-    0xd8, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x6b = { image_data_Font_0x6b,
-    6, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x6c[13] = {
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x6c = { image_data_Font_0x6c,
-    3, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x6d[26] = {
-    0x00, 0x00, 
-    0x00, 0x00, 
-    0x00, 0x00, 
-    0xbb, 0x80, 
-    0xcc, 0xc0, 
-    0xcc, 0xc0, 
-    0xcc, 0xc0, 
-    0xcc, 0xc0, 
-    0xcc, 0xc0, 
-    0xcc, 0xc0, 
-    0x00, 0x00, 
-    0x00, 0x00, 
-    0x00, 0x00
-};
-static const tImage Font_0x6d = { image_data_Font_0x6d,
-    11, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x6e[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0xb8, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x6e = { image_data_Font_0x6e,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x6f[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x78, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0x78, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x6f = { image_data_Font_0x6f,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x70[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0xb8, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xf8, 
-    0xc0, 
-    0xc0, 
-    0x00
-};
-static const tImage Font_0x70 = { image_data_Font_0x70,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x71[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x74, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0x7c, 
-    0x0c, 
-    0x0c, 
-    0x00
-};
-static const tImage Font_0x71 = { image_data_Font_0x71,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x72[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0xa0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x72 = { image_data_Font_0x72,
-    4, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x73[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x70, 
-    0xc0, 
-    0xc0, 
-    0x70, 
-    0x30, 
-    0x30, 
-    0xe0, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x73 = { image_data_Font_0x73,
-    5, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x74[13] = {
-    0x00, 
-    0x40, 
-    0xc0, 
-    0xe0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xc0, 
-    0xe0, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x74 = { image_data_Font_0x74,
-    4, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x75[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0xcc, 
-    0x74, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x75 = { image_data_Font_0x75,
-    7, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x76[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0xd8, 
-    0xd8, 
-    0xd8, 
-    0xd0, 
-    0x50, 
-    0x70, 
-    0x70, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x76 = { image_data_Font_0x76,
-    6, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x77[26] = {
-    0x00, 0x00, 
-    0x00, 0x00, 
-    0x00, 0x00, 
-    0xcd, 0x80, 
-    0xdd, 0x80, 
-    0xd5, 0x80, 
-    0xd5, 0x00, 
-    0x55, 0x00, 
-    0x77, 0x00, 
-    0x67, 0x00, 
-    0x00, 0x00, 
-    0x00, 0x00, 
-    0x00, 0x00
-};
-static const tImage Font_0x77 = { image_data_Font_0x77,
-    10, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x78[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0xd8, 
-    0x70, 
-    0x70, 
-    0x30, 
-    0x70, 
-    0x78, 
-    0xd8, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x78 = { image_data_Font_0x78,
-    6, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x79[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0xd8, 
-    0xd8, 
-    0xd8, 
-    0xd0, 
-    0x50, 
-    0x70, 
-    0x70, 
-    0x20, 
-    0xe0, 
-    0x00
-};
-static const tImage Font_0x79 = { image_data_Font_0x79,
-    6, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x7a[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0xf8, 
-    0x38, 
-    0x30, 
-    0x70, 
-    0x60, 
-    0xe0, 
-    0xf8, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x7a = { image_data_Font_0x7a,
-    6, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x7b[13] = {
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0xc0, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x00
-};
-static const tImage Font_0x7b = { image_data_Font_0x7b,
-    4, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x7c[13] = {
-    0x40, 
-    0x40, 
-    0x40, 
-    0x40, 
-    0x40, 
-    0x40, 
-    0x40, 
-    0x40, 
-    0x40, 
-    0x40, 
-    0x40, 
-    0x40, 
-    0x00
-};
-static const tImage Font_0x7c = { image_data_Font_0x7c,
-    3, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x7d[13] = {
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x30, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x60, 
-    0x00
-};
-static const tImage Font_0x7d = { image_data_Font_0x7d,
-    4, 13, 8};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_Font_0x7e[13] = {
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x60, 
-    0xfc, 
-    0x9c, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00, 
-    0x00
-};
-static const tImage Font_0x7e = { image_data_Font_0x7e,
-    6, 13, 8};
-#endif
-
-
-static const tChar Font_array[] = {
-
-#if (0x0 == 0x0)
-  // character: ' '
-  {0x20, &Font_0x20},
-#else
-  // character: ' ' == ''
-  {0x20, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '!'
-  {0x21, &Font_0x21},
-#else
-  // character: '!' == ''
-  {0x21, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '"'
-  {0x22, &Font_0x22},
-#else
-  // character: '"' == ''
-  {0x22, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '#'
-  {0x23, &Font_0x23},
-#else
-  // character: '#' == ''
-  {0x23, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '$'
-  {0x24, &Font_0x24},
-#else
-  // character: '$' == ''
-  {0x24, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '%'
-  {0x25, &Font_0x25},
-#else
-  // character: '%' == ''
-  {0x25, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '&'
-  {0x26, &Font_0x26},
-#else
-  // character: '&' == ''
-  {0x26, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '''
-  {0x27, &Font_0x27},
-#else
-  // character: ''' == ''
-  {0x27, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '('
-  {0x28, &Font_0x28},
-#else
-  // character: '(' == ''
-  {0x28, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ')'
-  {0x29, &Font_0x29},
-#else
-  // character: ')' == ''
-  {0x29, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '*'
-  {0x2a, &Font_0x2a},
-#else
-  // character: '*' == ''
-  {0x2a, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '+'
-  {0x2b, &Font_0x2b},
-#else
-  // character: '+' == ''
-  {0x2b, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ','
-  {0x2c, &Font_0x2c},
-#else
-  // character: ',' == ''
-  {0x2c, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '-'
-  {0x2d, &Font_0x2d},
-#else
-  // character: '-' == ''
-  {0x2d, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '.'
-  {0x2e, &Font_0x2e},
-#else
-  // character: '.' == ''
-  {0x2e, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '/'
-  {0x2f, &Font_0x2f},
-#else
-  // character: '/' == ''
-  {0x2f, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '0'
-  {0x30, &Font_0x30},
-#else
-  // character: '0' == ''
-  {0x30, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '1'
-  {0x31, &Font_0x31},
-#else
-  // character: '1' == ''
-  {0x31, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '2'
-  {0x32, &Font_0x32},
-#else
-  // character: '2' == ''
-  {0x32, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '3'
-  {0x33, &Font_0x33},
-#else
-  // character: '3' == ''
-  {0x33, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '4'
-  {0x34, &Font_0x34},
-#else
-  // character: '4' == ''
-  {0x34, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '5'
-  {0x35, &Font_0x35},
-#else
-  // character: '5' == ''
-  {0x35, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '6'
-  {0x36, &Font_0x36},
-#else
-  // character: '6' == ''
-  {0x36, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '7'
-  {0x37, &Font_0x37},
-#else
-  // character: '7' == ''
-  {0x37, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '8'
-  {0x38, &Font_0x38},
-#else
-  // character: '8' == ''
-  {0x38, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '9'
-  {0x39, &Font_0x39},
-#else
-  // character: '9' == ''
-  {0x39, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ':'
-  {0x3a, &Font_0x3a},
-#else
-  // character: ':' == ''
-  {0x3a, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ';'
-  {0x3b, &Font_0x3b},
-#else
-  // character: ';' == ''
-  {0x3b, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '<'
-  {0x3c, &Font_0x3c},
-#else
-  // character: '<' == ''
-  {0x3c, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '='
-  {0x3d, &Font_0x3d},
-#else
-  // character: '=' == ''
-  {0x3d, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '>'
-  {0x3e, &Font_0x3e},
-#else
-  // character: '>' == ''
-  {0x3e, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '?'
-  {0x3f, &Font_0x3f},
-#else
-  // character: '?' == ''
-  {0x3f, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\x0040'
-  {0x40, &Font_0x40},
-#else
-  // character: '\x0040' == ''
-  {0x40, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'A'
-  {0x41, &Font_0x41},
-#else
-  // character: 'A' == ''
-  {0x41, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'B'
-  {0x42, &Font_0x42},
-#else
-  // character: 'B' == ''
-  {0x42, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'C'
-  {0x43, &Font_0x43},
-#else
-  // character: 'C' == ''
-  {0x43, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'D'
-  {0x44, &Font_0x44},
-#else
-  // character: 'D' == ''
-  {0x44, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'E'
-  {0x45, &Font_0x45},
-#else
-  // character: 'E' == ''
-  {0x45, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'F'
-  {0x46, &Font_0x46},
-#else
-  // character: 'F' == ''
-  {0x46, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'G'
-  {0x47, &Font_0x47},
-#else
-  // character: 'G' == ''
-  {0x47, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'H'
-  {0x48, &Font_0x48},
-#else
-  // character: 'H' == ''
-  {0x48, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'I'
-  {0x49, &Font_0x49},
-#else
-  // character: 'I' == ''
-  {0x49, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'J'
-  {0x4a, &Font_0x4a},
-#else
-  // character: 'J' == ''
-  {0x4a, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'K'
-  {0x4b, &Font_0x4b},
-#else
-  // character: 'K' == ''
-  {0x4b, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'L'
-  {0x4c, &Font_0x4c},
-#else
-  // character: 'L' == ''
-  {0x4c, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'M'
-  {0x4d, &Font_0x4d},
-#else
-  // character: 'M' == ''
-  {0x4d, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'N'
-  {0x4e, &Font_0x4e},
-#else
-  // character: 'N' == ''
-  {0x4e, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'O'
-  {0x4f, &Font_0x4f},
-#else
-  // character: 'O' == ''
-  {0x4f, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'P'
-  {0x50, &Font_0x50},
-#else
-  // character: 'P' == ''
-  {0x50, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Q'
-  {0x51, &Font_0x51},
-#else
-  // character: 'Q' == ''
-  {0x51, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'R'
-  {0x52, &Font_0x52},
-#else
-  // character: 'R' == ''
-  {0x52, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'S'
-  {0x53, &Font_0x53},
-#else
-  // character: 'S' == ''
-  {0x53, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'T'
-  {0x54, &Font_0x54},
-#else
-  // character: 'T' == ''
-  {0x54, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'U'
-  {0x55, &Font_0x55},
-#else
-  // character: 'U' == ''
-  {0x55, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'V'
-  {0x56, &Font_0x56},
-#else
-  // character: 'V' == ''
-  {0x56, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'W'
-  {0x57, &Font_0x57},
-#else
-  // character: 'W' == ''
-  {0x57, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'X'
-  {0x58, &Font_0x58},
-#else
-  // character: 'X' == ''
-  {0x58, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Y'
-  {0x59, &Font_0x59},
-#else
-  // character: 'Y' == ''
-  {0x59, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Z'
-  {0x5a, &Font_0x5a},
-#else
-  // character: 'Z' == ''
-  {0x5a, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '['
-  {0x5b, &Font_0x5b},
-#else
-  // character: '[' == ''
-  {0x5b, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\'
-  {0x5c, &Font_0x5c},
-#else
-  // character: '\' == ''
-  {0x5c, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ']'
-  {0x5d, &Font_0x5d},
-#else
-  // character: ']' == ''
-  {0x5d, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '^'
-  {0x5e, &Font_0x5e},
-#else
-  // character: '^' == ''
-  {0x5e, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '_'
-  {0x5f, &Font_0x5f},
-#else
-  // character: '_' == ''
-  {0x5f, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '`'
-  {0x60, &Font_0x60},
-#else
-  // character: '`' == ''
-  {0x60, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'a'
-  {0x61, &Font_0x61},
-#else
-  // character: 'a' == ''
-  {0x61, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'b'
-  {0x62, &Font_0x62},
-#else
-  // character: 'b' == ''
-  {0x62, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'c'
-  {0x63, &Font_0x63},
-#else
-  // character: 'c' == ''
-  {0x63, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'd'
-  {0x64, &Font_0x64},
-#else
-  // character: 'd' == ''
-  {0x64, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'e'
-  {0x65, &Font_0x65},
-#else
-  // character: 'e' == ''
-  {0x65, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'f'
-  {0x66, &Font_0x66},
-#else
-  // character: 'f' == ''
-  {0x66, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'g'
-  {0x67, &Font_0x67},
-#else
-  // character: 'g' == ''
-  {0x67, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'h'
-  {0x68, &Font_0x68},
-#else
-  // character: 'h' == ''
-  {0x68, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'i'
-  {0x69, &Font_0x69},
-#else
-  // character: 'i' == ''
-  {0x69, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'j'
-  {0x6a, &Font_0x6a},
-#else
-  // character: 'j' == ''
-  {0x6a, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'k'
-  {0x6b, &Font_0x6b},
-#else
-  // character: 'k' == ''
-  {0x6b, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'l'
-  {0x6c, &Font_0x6c},
-#else
-  // character: 'l' == ''
-  {0x6c, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'm'
-  {0x6d, &Font_0x6d},
-#else
-  // character: 'm' == ''
-  {0x6d, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'n'
-  {0x6e, &Font_0x6e},
-#else
-  // character: 'n' == ''
-  {0x6e, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'o'
-  {0x6f, &Font_0x6f},
-#else
-  // character: 'o' == ''
-  {0x6f, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'p'
-  {0x70, &Font_0x70},
-#else
-  // character: 'p' == ''
-  {0x70, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'q'
-  {0x71, &Font_0x71},
-#else
-  // character: 'q' == ''
-  {0x71, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'r'
-  {0x72, &Font_0x72},
-#else
-  // character: 'r' == ''
-  {0x72, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 's'
-  {0x73, &Font_0x73},
-#else
-  // character: 's' == ''
-  {0x73, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 't'
-  {0x74, &Font_0x74},
-#else
-  // character: 't' == ''
-  {0x74, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'u'
-  {0x75, &Font_0x75},
-#else
-  // character: 'u' == ''
-  {0x75, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'v'
-  {0x76, &Font_0x76},
-#else
-  // character: 'v' == ''
-  {0x76, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'w'
-  {0x77, &Font_0x77},
-#else
-  // character: 'w' == ''
-  {0x77, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'x'
-  {0x78, &Font_0x78},
-#else
-  // character: 'x' == ''
-  {0x78, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'y'
-  {0x79, &Font_0x79},
-#else
-  // character: 'y' == ''
-  {0x79, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'z'
-  {0x7a, &Font_0x7a},
-#else
-  // character: 'z' == ''
-  {0x7a, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '{'
-  {0x7b, &Font_0x7b},
-#else
-  // character: '{' == ''
-  {0x7b, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '|'
-  {0x7c, &Font_0x7c},
-#else
-  // character: '|' == ''
-  {0x7c, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '}'
-  {0x7d, &Font_0x7d},
-#else
-  // character: '}' == ''
-  {0x7d, &Font_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '~'
-  {0x7e, &Font_0x7e}
-#else
-  // character: '~' == ''
-  {0x7e, &Font_0x}
-#endif
-
-};
-
-const tChar* GetFontNokiaLargex_13(uint8_t ASCII)
-{
- //  return (const tChar*)&Font_array[ASCII - 0x20];
-   return &Font_array[ASCII - 0x20];
-}
-
+
+/*******************************************************************************
+* font
+* filename: unsaved
+* name: Font
+* family: Nokia Large
+* size: 12
+* style: Bold
+* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+* antialiasing: no
+* type: proportional
+* encoding: ASMO-708
+* unicode bom: no
+*
+* preset name: Monochrome_TB
+* data block size: 8 bit(s), uint8_t
+* RLE compression enabled: no
+* conversion type: Monochrome, Edge 128
+* bits per pixel: 1
+*
+* preprocess:
+*  main scan direction: top_to_bottom
+*  line scan direction: forward
+*  inverse: yes
+*******************************************************************************/
+
+#include <stdint.h>
+#include "fonts.h"
+
+/*
+ typedef struct {
+     long int code;
+     const tImage *image;
+     } tChar;
+ typedef struct {
+     int length;
+     const tChar *chars;
+     } tFont;
+*/
+
+
+
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x20[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x20 = { image_data_Font_0x20,
+    2, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x21[13] = {
+    0x00, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x00, 
+    0x60, 
+    0x60, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x21 = { image_data_Font_0x21,
+    3, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x22[13] = {
+    0xf0, 
+    0xf0, 
+    0xf0, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x22 = { image_data_Font_0x22,
+    5, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x23[13] = {
+    0x00, 
+    0x24, 
+    0x24, 
+    0xfe, 
+    0x24, 
+    0x24, 
+    0xfe, 
+    0x48, 
+    0x48, 
+    0x48, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x23 = { image_data_Font_0x23,
+    8, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x24[13] = {
+    0x20, 
+    0x78, 
+    0xc0, 
+    0xc0, 
+    0xe0, 
+    0x70, 
+    0x38, 
+    0x18, 
+    0x18, 
+    0xf0, 
+    0x20, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x24 = { image_data_Font_0x24,
+    6, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x25[26] = {
+    0x00, 0x00, 
+    0x62, 0x00, 
+    0x96, 0x00, 
+    0x94, 0x00, 
+    0x9c, 0x00, 
+    0x6b, 0x00, 
+    0x1c, 0x80, 
+    0x14, 0x80, 
+    0x34, 0x80, 
+    0x23, 0x00, 
+    0x00, 0x00, 
+    0x00, 0x00, 
+    0x00, 0x00
+};
+static const tImage Font_0x25 = { image_data_Font_0x25,
+    10, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x26[13] = {
+    0x00, 
+    0x38, 
+    0x6c, 
+    0x6c, 
+    0x38, 
+    0x79, 
+    0xdb, 
+    0xce, 
+    0xc6, 
+    0x7b, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x26 = { image_data_Font_0x26,
+    8, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x27[13] = {
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x27 = { image_data_Font_0x27,
+    3, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x28[13] = {
+    0x60, 
+    0x40, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0x40, 
+    0x60, 
+    0x00
+};
+static const tImage Font_0x28 = { image_data_Font_0x28,
+    4, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x29[13] = {
+    0x60, 
+    0x20, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x20, 
+    0x60, 
+    0x00
+};
+static const tImage Font_0x29 = { image_data_Font_0x29,
+    4, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x2a[13] = {
+    0x00, 
+    0x20, 
+    0xf8, 
+    0x20, 
+    0xf8, 
+    0x20, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x2a = { image_data_Font_0x2a,
+    6, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x2b[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x30, 
+    0x30, 
+    0xfc, 
+    0xfc, 
+    0x30, 
+    0x30, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x2b = { image_data_Font_0x2b,
+    6, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x2c[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x60, 
+    0x40, 
+    0xc0, 
+    0x80, 
+    0x00
+};
+static const tImage Font_0x2c = { image_data_Font_0x2c,
+    3, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x2d[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0xe0, 
+    0xe0, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x2d = { image_data_Font_0x2d,
+    4, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x2e[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0xc0, 
+    0xc0, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x2e = { image_data_Font_0x2e,
+    3, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x2f[13] = {
+    0x10, 
+    0x10, 
+    0x10, 
+    0x20, 
+    0x20, 
+    0x20, 
+    0x40, 
+    0x40, 
+    0x40, 
+    0x80, 
+    0x80, 
+    0x80, 
+    0x00
+};
+static const tImage Font_0x2f = { image_data_Font_0x2f,
+    4, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x30[13] = {
+    0x00, 
+    0x78, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0x78, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x30 = { image_data_Font_0x30,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x31[13] = {
+    0x00, 
+    0x60, 
+    0xe0, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0xf0, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x31 = { image_data_Font_0x31,
+    5, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x32[13] = {
+    0x00, 
+    0xf0, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x30, 
+    0x60, 
+    0xe0, 
+    0xc0, 
+    0xf8, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x32 = { image_data_Font_0x32,
+    6, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x33[13] = {
+    0x00, 
+    0xf0, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x60, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0xf0, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x33 = { image_data_Font_0x33,
+    6, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x34[13] = {
+    0x00, 
+    0x18, 
+    0x38, 
+    0x38, 
+    0x58, 
+    0x58, 
+    0xd8, 
+    0xfc, 
+    0x18, 
+    0x18, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x34 = { image_data_Font_0x34,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x35[13] = {
+    0x00, 
+    0xf8, 
+    0xc0, 
+    0xc0, 
+    0xf0, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0x18, 
+    0xf0, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x35 = { image_data_Font_0x35,
+    6, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x36[13] = {
+    0x00, 
+    0x38, 
+    0x60, 
+    0xc0, 
+    0xf8, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0x78, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x36 = { image_data_Font_0x36,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x37[13] = {
+    0x00, 
+    0xf8, 
+    0x18, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x37 = { image_data_Font_0x37,
+    6, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x38[13] = {
+    0x00, 
+    0x78, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0x78, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0x78, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x38 = { image_data_Font_0x38,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x39[13] = {
+    0x00, 
+    0x78, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0x7c, 
+    0x0c, 
+    0x18, 
+    0x70, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x39 = { image_data_Font_0x39,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x3a[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x60, 
+    0x60, 
+    0x00, 
+    0x00, 
+    0x60, 
+    0x60, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x3a = { image_data_Font_0x3a,
+    3, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x3b[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x60, 
+    0x60, 
+    0x00, 
+    0x00, 
+    0x60, 
+    0x40, 
+    0xc0, 
+    0x80, 
+    0x00
+};
+static const tImage Font_0x3b = { image_data_Font_0x3b,
+    3, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x3c[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x0c, 
+    0x7c, 
+    0x80, 
+    0x70, 
+    0x1c, 
+    0x04, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x3c = { image_data_Font_0x3c,
+    6, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x3d[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0xfc, 
+    0xfc, 
+    0x00, 
+    0xfc, 
+    0xfc, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x3d = { image_data_Font_0x3d,
+    6, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x3e[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0xc0, 
+    0xf8, 
+    0x1c, 
+    0x38, 
+    0xe0, 
+    0x80, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x3e = { image_data_Font_0x3e,
+    6, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x3f[13] = {
+    0x00, 
+    0x70, 
+    0x18, 
+    0x18, 
+    0x38, 
+    0x70, 
+    0x60, 
+    0x00, 
+    0x60, 
+    0x60, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x3f = { image_data_Font_0x3f,
+    5, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x40[26] = {
+    0x00, 0x00, 
+    0x1f, 0x00, 
+    0x61, 0x80, 
+    0x4f, 0xc0, 
+    0x8a, 0x40, 
+    0x92, 0x40, 
+    0x92, 0x40, 
+    0x96, 0x40, 
+    0x4f, 0x80, 
+    0x60, 0x00, 
+    0x1f, 0x00, 
+    0x00, 0x00, 
+    0x00, 0x00
+};
+static const tImage Font_0x40 = { image_data_Font_0x40,
+    10, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x41[13] = {
+    0x00, 
+    0x70, 
+    0x70, 
+    0x58, 
+    0x58, 
+    0x58, 
+    0xd8, 
+    0xfc, 
+    0xcc, 
+    0xcc, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x41 = { image_data_Font_0x41,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x42[13] = {
+    0x00, 
+    0xf8, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xf8, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xf8, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x42 = { image_data_Font_0x42,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x43[13] = {
+    0x00, 
+    0x70, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0x70, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x43 = { image_data_Font_0x43,
+    5, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x44[13] = {
+    0x00, 
+    0xf8, 
+    0xd8, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xd8, 
+    0xf0, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x44 = { image_data_Font_0x44,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x45[13] = {
+    0x00, 
+    0xf0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xf0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xf0, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x45 = { image_data_Font_0x45,
+    5, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x46[13] = {
+    0x00, 
+    0xf0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xf0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x46 = { image_data_Font_0x46,
+    5, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x47[13] = {
+    0x00, 
+    0x3c, 
+    0x60, 
+    0xc0, 
+    0xc0, 
+    0xdc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0x74, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x47 = { image_data_Font_0x47,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x48[13] = {
+    0x00, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xfc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x48 = { image_data_Font_0x48,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x49[13] = {
+    0x00, 
+    0xf0, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0xf0, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x49 = { image_data_Font_0x49,
+    4, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x4a[13] = {
+    0x00, 
+    0xf0, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0xc0, 
+    0x00
+};
+static const tImage Font_0x4a = { image_data_Font_0x4a,
+    4, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x4b[13] = {
+    0x00, 
+    0xcc, 
+    0xd8, 
+    0xd8, 
+    0xf0, 
+    0xf0, 
+    0xf8, 
+    0xd8, 
+    0xdc, 
+    0xcc, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x4b = { image_data_Font_0x4b,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x4c[13] = {
+    0x00, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xf0, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x4c = { image_data_Font_0x4c,
+    5, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x4d[26] = {
+    0x00, 0x00, 
+    0xc3, 0x00, 
+    0xe7, 0x00, 
+    0xe7, 0x00, 
+    0xff, 0x00, 
+    0xdb, 0x00, 
+    0xdb, 0x00, 
+    0xc3, 0x00, 
+    0xc3, 0x00, 
+    0xc3, 0x00, 
+    0x00, 0x00, 
+    0x00, 0x00, 
+    0x00, 0x00
+};
+static const tImage Font_0x4d = { image_data_Font_0x4d,
+    9, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x4e[13] = {
+    0x00, 
+    0xc6, 
+    0xe6, 
+    0xe6, 
+    0xf6, 
+    0xd6, 
+    0xde, 
+    0xce, 
+    0xce, 
+    0xc6, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x4e = { image_data_Font_0x4e,
+    8, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x4f[13] = {
+    0x00, 
+    0x78, 
+    0x48, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0x48, 
+    0x78, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x4f = { image_data_Font_0x4f,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x50[13] = {
+    0x00, 
+    0xf0, 
+    0xd8, 
+    0xd8, 
+    0xd8, 
+    0xd8, 
+    0xf0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x50 = { image_data_Font_0x50,
+    6, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x51[13] = {
+    0x00, 
+    0x78, 
+    0x48, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0x48, 
+    0x78, 
+    0x30, 
+    0x18, 
+    0x00
+};
+static const tImage Font_0x51 = { image_data_Font_0x51,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x52[13] = {
+    0x00, 
+    0xf8, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xf8, 
+    0xd8, 
+    0xd8, 
+    0xcc, 
+    0xcc, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x52 = { image_data_Font_0x52,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x53[13] = {
+    0x00, 
+    0x78, 
+    0xc0, 
+    0xc0, 
+    0xe0, 
+    0x70, 
+    0x38, 
+    0x18, 
+    0x18, 
+    0xf0, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x53 = { image_data_Font_0x53,
+    6, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x54[13] = {
+    0x00, 
+    0xfc, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x54 = { image_data_Font_0x54,
+    6, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x55[13] = {
+    0x00, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0x78, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x55 = { image_data_Font_0x55,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x56[13] = {
+    0x00, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0x6c, 
+    0x68, 
+    0x68, 
+    0x68, 
+    0x38, 
+    0x38, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x56 = { image_data_Font_0x56,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x57[26] = {
+    0x00, 0x00, 
+    0xcc, 0xc0, 
+    0xcc, 0xc0, 
+    0xce, 0xc0, 
+    0xde, 0xc0, 
+    0xde, 0x80, 
+    0x52, 0x80, 
+    0x52, 0x80, 
+    0x73, 0x80, 
+    0x73, 0x80, 
+    0x00, 0x00, 
+    0x00, 0x00, 
+    0x00, 0x00
+};
+static const tImage Font_0x57 = { image_data_Font_0x57,
+    11, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x58[13] = {
+    0x00, 
+    0xcc, 
+    0xe8, 
+    0x78, 
+    0x70, 
+    0x30, 
+    0x38, 
+    0x78, 
+    0x5c, 
+    0xcc, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x58 = { image_data_Font_0x58,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x59[13] = {
+    0x00, 
+    0xd8, 
+    0xd8, 
+    0xd0, 
+    0xd0, 
+    0x70, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x59 = { image_data_Font_0x59,
+    6, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x5a[13] = {
+    0x00, 
+    0xf8, 
+    0x18, 
+    0x30, 
+    0x30, 
+    0x70, 
+    0x60, 
+    0x60, 
+    0xc0, 
+    0xf8, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x5a = { image_data_Font_0x5a,
+    6, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x5b[13] = {
+    0xe0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xe0, 
+    0x00
+};
+static const tImage Font_0x5b = { image_data_Font_0x5b,
+    4, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x5c[13] = {
+    0x80, 
+    0x80, 
+    0x80, 
+    0x40, 
+    0x40, 
+    0x40, 
+    0x20, 
+    0x20, 
+    0x20, 
+    0x10, 
+    0x10, 
+    0x10, 
+    0x00
+};
+static const tImage Font_0x5c = { image_data_Font_0x5c,
+    4, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x5d[13] = {
+    0x70, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x30, 
+    0x70, 
+    0x00
+};
+static const tImage Font_0x5d = { image_data_Font_0x5d,
+    4, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x5e[13] = {
+    0x00, 
+    0x20, 
+    0x70, 
+    0x78, 
+    0xc8, 
+    0xcc, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x5e = { image_data_Font_0x5e,
+    6, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x5f[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0xf0, 
+    0x00
+};
+static const tImage Font_0x5f = { image_data_Font_0x5f,
+    4, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x60[13] = {
+    0x00, 
+    0xc0, 
+    0x60, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x60 = { image_data_Font_0x60,
+    4, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x61[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x70, 
+    0x18, 
+    0x18, 
+    0x78, 
+    0xd8, 
+    0xd8, 
+    0xe8, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x61 = { image_data_Font_0x61,
+    6, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x62[13] = {
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xf8, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xb8, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x62 = { image_data_Font_0x62,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x63[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x70, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0x70, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x63 = { image_data_Font_0x63,
+    5, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x64[13] = {
+    0x0c, 
+    0x0c, 
+    0x0c, 
+    0x7c, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0x74, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x64 = { image_data_Font_0x64,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x65[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x70, 
+    0xd8, 
+    0xd8, 
+    0xf8, 
+    0xc0, 
+    0xc0, 
+    0x78, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x65 = { image_data_Font_0x65,
+    6, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x66[13] = {
+    0x30, 
+    0x60, 
+    0x60, 
+    0xf0, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x66 = { image_data_Font_0x66,
+    4, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x67[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x74, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0x7c, 
+    0x0c, 
+    0xf8, 
+    0x00
+};
+static const tImage Font_0x67 = { image_data_Font_0x67,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x68[13] = {
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xf8, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x68 = { image_data_Font_0x68,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x69[13] = {
+    0xc0, 
+    0xc0, 
+    0x00, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x69 = { image_data_Font_0x69,
+    3, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x6a[13] = {
+    0xc0, 
+    0xc0, 
+    0x00, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0x80, 
+    0x00
+};
+static const tImage Font_0x6a = { image_data_Font_0x6a,
+    3, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x6b[13] = {
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xd8, 
+    0xd8, 
+    0xf0, 
+    0xf0, 
+    0xf0, 
+    0xd8, 
+    0xd8, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x6b = { image_data_Font_0x6b,
+    6, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x6c[13] = {
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x6c = { image_data_Font_0x6c,
+    3, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x6d[26] = {
+    0x00, 0x00, 
+    0x00, 0x00, 
+    0x00, 0x00, 
+    0xbb, 0x80, 
+    0xcc, 0xc0, 
+    0xcc, 0xc0, 
+    0xcc, 0xc0, 
+    0xcc, 0xc0, 
+    0xcc, 0xc0, 
+    0xcc, 0xc0, 
+    0x00, 0x00, 
+    0x00, 0x00, 
+    0x00, 0x00
+};
+static const tImage Font_0x6d = { image_data_Font_0x6d,
+    11, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x6e[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0xb8, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x6e = { image_data_Font_0x6e,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x6f[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x78, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0x78, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x6f = { image_data_Font_0x6f,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x70[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0xb8, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xf8, 
+    0xc0, 
+    0xc0, 
+    0x00
+};
+static const tImage Font_0x70 = { image_data_Font_0x70,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x71[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x74, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0x7c, 
+    0x0c, 
+    0x0c, 
+    0x00
+};
+static const tImage Font_0x71 = { image_data_Font_0x71,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x72[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0xa0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x72 = { image_data_Font_0x72,
+    4, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x73[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x70, 
+    0xc0, 
+    0xc0, 
+    0x70, 
+    0x30, 
+    0x30, 
+    0xe0, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x73 = { image_data_Font_0x73,
+    5, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x74[13] = {
+    0x00, 
+    0x40, 
+    0xc0, 
+    0xe0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xc0, 
+    0xe0, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x74 = { image_data_Font_0x74,
+    4, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x75[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0xcc, 
+    0x74, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x75 = { image_data_Font_0x75,
+    7, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x76[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0xd8, 
+    0xd8, 
+    0xd8, 
+    0xd0, 
+    0x50, 
+    0x70, 
+    0x70, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x76 = { image_data_Font_0x76,
+    6, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x77[26] = {
+    0x00, 0x00, 
+    0x00, 0x00, 
+    0x00, 0x00, 
+    0xcd, 0x80, 
+    0xdd, 0x80, 
+    0xd5, 0x80, 
+    0xd5, 0x00, 
+    0x55, 0x00, 
+    0x77, 0x00, 
+    0x67, 0x00, 
+    0x00, 0x00, 
+    0x00, 0x00, 
+    0x00, 0x00
+};
+static const tImage Font_0x77 = { image_data_Font_0x77,
+    10, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x78[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0xd8, 
+    0x70, 
+    0x70, 
+    0x30, 
+    0x70, 
+    0x78, 
+    0xd8, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x78 = { image_data_Font_0x78,
+    6, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x79[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0xd8, 
+    0xd8, 
+    0xd8, 
+    0xd0, 
+    0x50, 
+    0x70, 
+    0x70, 
+    0x20, 
+    0xe0, 
+    0x00
+};
+static const tImage Font_0x79 = { image_data_Font_0x79,
+    6, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x7a[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0xf8, 
+    0x38, 
+    0x30, 
+    0x70, 
+    0x60, 
+    0xe0, 
+    0xf8, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x7a = { image_data_Font_0x7a,
+    6, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x7b[13] = {
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0xc0, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x00
+};
+static const tImage Font_0x7b = { image_data_Font_0x7b,
+    4, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x7c[13] = {
+    0x40, 
+    0x40, 
+    0x40, 
+    0x40, 
+    0x40, 
+    0x40, 
+    0x40, 
+    0x40, 
+    0x40, 
+    0x40, 
+    0x40, 
+    0x40, 
+    0x00
+};
+static const tImage Font_0x7c = { image_data_Font_0x7c,
+    3, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x7d[13] = {
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x30, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x60, 
+    0x00
+};
+static const tImage Font_0x7d = { image_data_Font_0x7d,
+    4, 13, 8};
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_Font_0x7e[13] = {
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x60, 
+    0xfc, 
+    0x9c, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00, 
+    0x00
+};
+static const tImage Font_0x7e = { image_data_Font_0x7e,
+    6, 13, 8};
+#endif
+
+
+static const tChar Font_array[] = {
+
+#if (0x0 == 0x0)
+  // character: ' '
+  {0x20, &Font_0x20},
+#else
+  // character: ' ' == ''
+  {0x20, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '!'
+  {0x21, &Font_0x21},
+#else
+  // character: '!' == ''
+  {0x21, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '"'
+  {0x22, &Font_0x22},
+#else
+  // character: '"' == ''
+  {0x22, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '#'
+  {0x23, &Font_0x23},
+#else
+  // character: '#' == ''
+  {0x23, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '$'
+  {0x24, &Font_0x24},
+#else
+  // character: '$' == ''
+  {0x24, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '%'
+  {0x25, &Font_0x25},
+#else
+  // character: '%' == ''
+  {0x25, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '&'
+  {0x26, &Font_0x26},
+#else
+  // character: '&' == ''
+  {0x26, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '''
+  {0x27, &Font_0x27},
+#else
+  // character: ''' == ''
+  {0x27, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '('
+  {0x28, &Font_0x28},
+#else
+  // character: '(' == ''
+  {0x28, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: ')'
+  {0x29, &Font_0x29},
+#else
+  // character: ')' == ''
+  {0x29, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '*'
+  {0x2a, &Font_0x2a},
+#else
+  // character: '*' == ''
+  {0x2a, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '+'
+  {0x2b, &Font_0x2b},
+#else
+  // character: '+' == ''
+  {0x2b, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: ','
+  {0x2c, &Font_0x2c},
+#else
+  // character: ',' == ''
+  {0x2c, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '-'
+  {0x2d, &Font_0x2d},
+#else
+  // character: '-' == ''
+  {0x2d, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '.'
+  {0x2e, &Font_0x2e},
+#else
+  // character: '.' == ''
+  {0x2e, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '/'
+  {0x2f, &Font_0x2f},
+#else
+  // character: '/' == ''
+  {0x2f, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '0'
+  {0x30, &Font_0x30},
+#else
+  // character: '0' == ''
+  {0x30, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '1'
+  {0x31, &Font_0x31},
+#else
+  // character: '1' == ''
+  {0x31, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '2'
+  {0x32, &Font_0x32},
+#else
+  // character: '2' == ''
+  {0x32, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '3'
+  {0x33, &Font_0x33},
+#else
+  // character: '3' == ''
+  {0x33, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '4'
+  {0x34, &Font_0x34},
+#else
+  // character: '4' == ''
+  {0x34, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '5'
+  {0x35, &Font_0x35},
+#else
+  // character: '5' == ''
+  {0x35, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '6'
+  {0x36, &Font_0x36},
+#else
+  // character: '6' == ''
+  {0x36, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '7'
+  {0x37, &Font_0x37},
+#else
+  // character: '7' == ''
+  {0x37, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '8'
+  {0x38, &Font_0x38},
+#else
+  // character: '8' == ''
+  {0x38, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '9'
+  {0x39, &Font_0x39},
+#else
+  // character: '9' == ''
+  {0x39, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: ':'
+  {0x3a, &Font_0x3a},
+#else
+  // character: ':' == ''
+  {0x3a, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: ';'
+  {0x3b, &Font_0x3b},
+#else
+  // character: ';' == ''
+  {0x3b, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '<'
+  {0x3c, &Font_0x3c},
+#else
+  // character: '<' == ''
+  {0x3c, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '='
+  {0x3d, &Font_0x3d},
+#else
+  // character: '=' == ''
+  {0x3d, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '>'
+  {0x3e, &Font_0x3e},
+#else
+  // character: '>' == ''
+  {0x3e, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '?'
+  {0x3f, &Font_0x3f},
+#else
+  // character: '?' == ''
+  {0x3f, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '\x0040'
+  {0x40, &Font_0x40},
+#else
+  // character: '\x0040' == ''
+  {0x40, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'A'
+  {0x41, &Font_0x41},
+#else
+  // character: 'A' == ''
+  {0x41, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'B'
+  {0x42, &Font_0x42},
+#else
+  // character: 'B' == ''
+  {0x42, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'C'
+  {0x43, &Font_0x43},
+#else
+  // character: 'C' == ''
+  {0x43, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'D'
+  {0x44, &Font_0x44},
+#else
+  // character: 'D' == ''
+  {0x44, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'E'
+  {0x45, &Font_0x45},
+#else
+  // character: 'E' == ''
+  {0x45, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'F'
+  {0x46, &Font_0x46},
+#else
+  // character: 'F' == ''
+  {0x46, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'G'
+  {0x47, &Font_0x47},
+#else
+  // character: 'G' == ''
+  {0x47, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'H'
+  {0x48, &Font_0x48},
+#else
+  // character: 'H' == ''
+  {0x48, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'I'
+  {0x49, &Font_0x49},
+#else
+  // character: 'I' == ''
+  {0x49, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'J'
+  {0x4a, &Font_0x4a},
+#else
+  // character: 'J' == ''
+  {0x4a, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'K'
+  {0x4b, &Font_0x4b},
+#else
+  // character: 'K' == ''
+  {0x4b, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'L'
+  {0x4c, &Font_0x4c},
+#else
+  // character: 'L' == ''
+  {0x4c, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'M'
+  {0x4d, &Font_0x4d},
+#else
+  // character: 'M' == ''
+  {0x4d, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'N'
+  {0x4e, &Font_0x4e},
+#else
+  // character: 'N' == ''
+  {0x4e, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'O'
+  {0x4f, &Font_0x4f},
+#else
+  // character: 'O' == ''
+  {0x4f, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'P'
+  {0x50, &Font_0x50},
+#else
+  // character: 'P' == ''
+  {0x50, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'Q'
+  {0x51, &Font_0x51},
+#else
+  // character: 'Q' == ''
+  {0x51, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'R'
+  {0x52, &Font_0x52},
+#else
+  // character: 'R' == ''
+  {0x52, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'S'
+  {0x53, &Font_0x53},
+#else
+  // character: 'S' == ''
+  {0x53, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'T'
+  {0x54, &Font_0x54},
+#else
+  // character: 'T' == ''
+  {0x54, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'U'
+  {0x55, &Font_0x55},
+#else
+  // character: 'U' == ''
+  {0x55, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'V'
+  {0x56, &Font_0x56},
+#else
+  // character: 'V' == ''
+  {0x56, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'W'
+  {0x57, &Font_0x57},
+#else
+  // character: 'W' == ''
+  {0x57, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'X'
+  {0x58, &Font_0x58},
+#else
+  // character: 'X' == ''
+  {0x58, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'Y'
+  {0x59, &Font_0x59},
+#else
+  // character: 'Y' == ''
+  {0x59, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'Z'
+  {0x5a, &Font_0x5a},
+#else
+  // character: 'Z' == ''
+  {0x5a, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '['
+  {0x5b, &Font_0x5b},
+#else
+  // character: '[' == ''
+  {0x5b, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '\'
+  {0x5c, &Font_0x5c},
+#else
+  // character: '\' == ''
+  {0x5c, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: ']'
+  {0x5d, &Font_0x5d},
+#else
+  // character: ']' == ''
+  {0x5d, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '^'
+  {0x5e, &Font_0x5e},
+#else
+  // character: '^' == ''
+  {0x5e, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '_'
+  {0x5f, &Font_0x5f},
+#else
+  // character: '_' == ''
+  {0x5f, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '`'
+  {0x60, &Font_0x60},
+#else
+  // character: '`' == ''
+  {0x60, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'a'
+  {0x61, &Font_0x61},
+#else
+  // character: 'a' == ''
+  {0x61, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'b'
+  {0x62, &Font_0x62},
+#else
+  // character: 'b' == ''
+  {0x62, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'c'
+  {0x63, &Font_0x63},
+#else
+  // character: 'c' == ''
+  {0x63, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'd'
+  {0x64, &Font_0x64},
+#else
+  // character: 'd' == ''
+  {0x64, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'e'
+  {0x65, &Font_0x65},
+#else
+  // character: 'e' == ''
+  {0x65, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'f'
+  {0x66, &Font_0x66},
+#else
+  // character: 'f' == ''
+  {0x66, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'g'
+  {0x67, &Font_0x67},
+#else
+  // character: 'g' == ''
+  {0x67, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'h'
+  {0x68, &Font_0x68},
+#else
+  // character: 'h' == ''
+  {0x68, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'i'
+  {0x69, &Font_0x69},
+#else
+  // character: 'i' == ''
+  {0x69, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'j'
+  {0x6a, &Font_0x6a},
+#else
+  // character: 'j' == ''
+  {0x6a, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'k'
+  {0x6b, &Font_0x6b},
+#else
+  // character: 'k' == ''
+  {0x6b, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'l'
+  {0x6c, &Font_0x6c},
+#else
+  // character: 'l' == ''
+  {0x6c, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'm'
+  {0x6d, &Font_0x6d},
+#else
+  // character: 'm' == ''
+  {0x6d, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'n'
+  {0x6e, &Font_0x6e},
+#else
+  // character: 'n' == ''
+  {0x6e, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'o'
+  {0x6f, &Font_0x6f},
+#else
+  // character: 'o' == ''
+  {0x6f, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'p'
+  {0x70, &Font_0x70},
+#else
+  // character: 'p' == ''
+  {0x70, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'q'
+  {0x71, &Font_0x71},
+#else
+  // character: 'q' == ''
+  {0x71, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'r'
+  {0x72, &Font_0x72},
+#else
+  // character: 'r' == ''
+  {0x72, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 's'
+  {0x73, &Font_0x73},
+#else
+  // character: 's' == ''
+  {0x73, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 't'
+  {0x74, &Font_0x74},
+#else
+  // character: 't' == ''
+  {0x74, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'u'
+  {0x75, &Font_0x75},
+#else
+  // character: 'u' == ''
+  {0x75, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'v'
+  {0x76, &Font_0x76},
+#else
+  // character: 'v' == ''
+  {0x76, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'w'
+  {0x77, &Font_0x77},
+#else
+  // character: 'w' == ''
+  {0x77, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'x'
+  {0x78, &Font_0x78},
+#else
+  // character: 'x' == ''
+  {0x78, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'y'
+  {0x79, &Font_0x79},
+#else
+  // character: 'y' == ''
+  {0x79, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'z'
+  {0x7a, &Font_0x7a},
+#else
+  // character: 'z' == ''
+  {0x7a, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '{'
+  {0x7b, &Font_0x7b},
+#else
+  // character: '{' == ''
+  {0x7b, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '|'
+  {0x7c, &Font_0x7c},
+#else
+  // character: '|' == ''
+  {0x7c, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '}'
+  {0x7d, &Font_0x7d},
+#else
+  // character: '}' == ''
+  {0x7d, &Font_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '~'
+  {0x7e, &Font_0x7e}
+#else
+  // character: '~' == ''
+  {0x7e, &Font_0x}
+#endif
+
+};
+
+const tChar* GetFontNokiaLargex_13(uint8_t ASCII)
+{
+ //  return (const tChar*)&Font_array[ASCII - 0x20];
+   if((uint8_t)(ASCII - 0x20) >= (sizeof(Font_array) / sizeof(Font_array[0])))
+      ASCII = FONT_DEFAULT_CHAR;
+   return &Font_array[ASCII - 0x20];
+}
+
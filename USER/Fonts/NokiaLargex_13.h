@@ -1,18 +1,19 @@
-/**
-*  @file   NokiaLargex_13.h
-*  @author Rob Gee
-*  @date   November 2017
-*  @brief  Include file for courier new 8x14
-*/
-
-#ifndef __NOKIALARGEX_13_H
-#define __NOKIALARGEX_13_H
-
-const tChar* GetFontNokiaLargex_13(uint8_t ASCII);
-
-
-#endif /*__NOKIALARGEX_13_H */
-
-
-
-
+/**
+*  @file   NokiaLargex_13.h
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Include file for courier new 8x14
+*/
+
+#ifndef __NOKIALARGEX_13_H
+#define __NOKIALARGEX_13_H
+
+const tChar* GetFontNokiaLargex_13(uint8_t ASCII);
+extern const tPackedFont PackedNokiaLargex_13;
+
+
+#endif /*__NOKIALARGEX_13_H */
+
+
+
+
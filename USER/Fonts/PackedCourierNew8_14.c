@@ -0,0 +1,157 @@
+/**
+*  @file   PackedCourierNew8_14.c
+*  @brief  Packed font generated by Tools/fontpack.py from CourierNew8_14.c,
+*          do not edit
+*          PackedCourierNew8_14: 95 glyphs
+*             tImage font   2850 bytes (1330 bitmap, 1520 tImage + tChar)
+*             packed font   1639 bytes (1330 bits, 95 widths, 190 offsets, 0 kerning)
+*             saved         1211 bytes, 42%
+*/
+
+#include <stdint.h>
+#include "fonts.h"
+
+static const uint8_t PackedCourierNew8_14_bits[1330] = {
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x08,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x24, 0x24, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x24, 0x7e, 0x24,
+   0x24, 0x7e, 0x24, 0x48, 0x48, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x24,
+   0x20, 0x18, 0x04, 0x24, 0x38, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x18,
+   0x24, 0x24, 0x18, 0x3e, 0x0c, 0x12, 0x12, 0x0c, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x1c, 0x20, 0x20, 0x30, 0x4c, 0x48, 0x36, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x04, 0x04, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x10, 0x10,
+   0x10, 0x10, 0x10, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x10, 0x10, 0x7c,
+   0x10, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x08, 0x08, 0x08, 0x7f, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x10, 0x30, 0x20,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x04, 0x04, 0x08, 0x08,
+   0x10, 0x10, 0x20, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x42,
+   0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+   0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3e, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x38, 0x44, 0x04, 0x08, 0x08, 0x10, 0x20, 0x44, 0x7c, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x38, 0x44, 0x04, 0x04, 0x18, 0x04, 0x04, 0x44, 0x38,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x14, 0x14, 0x24, 0x24, 0x7e, 0x04,
+   0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x20, 0x20, 0x3c, 0x02,
+   0x02, 0x02, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x20,
+   0x20, 0x3c, 0x22, 0x22, 0x22, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e,
+   0x42, 0x02, 0x04, 0x04, 0x04, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x3e, 0x02, 0x04, 0x78,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00,
+   0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,
+   0x00, 0x00, 0x18, 0x10, 0x30, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+   0x0c, 0x10, 0x60, 0x10, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x60, 0x18, 0x04, 0x03, 0x04, 0x18, 0x60, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x04, 0x04, 0x08, 0x10, 0x00, 0x18,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x22, 0x42, 0x4e, 0x52, 0x52, 0x4e,
+   0x40, 0x22, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x18, 0x18, 0x24,
+   0x24, 0x3c, 0x42, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x22,
+   0x22, 0x3c, 0x22, 0x22, 0x22, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x1a, 0x26, 0x40, 0x40, 0x40, 0x40, 0x22, 0x1c, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x78, 0x24, 0x22, 0x22, 0x22, 0x22, 0x24, 0x78, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x7e, 0x22, 0x24, 0x3c, 0x24, 0x20, 0x22, 0x7e,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x22, 0x2a, 0x38, 0x28, 0x20,
+   0x20, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x26, 0x40, 0x40,
+   0x4f, 0x42, 0x22, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x22,
+   0x22, 0x3e, 0x22, 0x22, 0x22, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x3e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3e, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x3f, 0x04, 0x04, 0x04, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x77, 0x24, 0x28, 0x30, 0x38, 0x24, 0x22, 0x73,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x20, 0x20, 0x20, 0x22, 0x22,
+   0x22, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x63, 0x55, 0x55,
+   0x55, 0x49, 0x41, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x32,
+   0x32, 0x2a, 0x2a, 0x2a, 0x26, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x1c, 0x22, 0x41, 0x41, 0x41, 0x41, 0x22, 0x1c, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x7c, 0x22, 0x22, 0x22, 0x3c, 0x20, 0x20, 0x78, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x1c, 0x22, 0x41, 0x41, 0x41, 0x41, 0x22, 0x1c,
+   0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x22, 0x22, 0x22, 0x3c, 0x24,
+   0x22, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x46, 0x40, 0x3c,
+   0x02, 0x02, 0x62, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x49,
+   0x49, 0x08, 0x08, 0x08, 0x08, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x77, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1c, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0xe7, 0x42, 0x24, 0x24, 0x24, 0x18, 0x18, 0x18, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0xe3, 0x41, 0x49, 0x49, 0x55, 0x55, 0x55, 0x22,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x22, 0x14, 0x08, 0x08, 0x14,
+   0x22, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x22, 0x14, 0x14,
+   0x08, 0x08, 0x08, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x42,
+   0x04, 0x08, 0x10, 0x22, 0x42, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1c, 0x00, 0x00,
+   0x40, 0x20, 0x20, 0x20, 0x10, 0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x00,
+   0x00, 0x00, 0x00, 0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x38, 0x00, 0x00, 0x00, 0x10, 0x10, 0x28, 0x44, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x10, 0x08, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x3c, 0x42, 0x3e, 0x42, 0x46, 0x3b, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0xc0, 0x40, 0x40, 0x5c, 0x62, 0x42, 0x42, 0x62, 0xdc, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x46, 0x40, 0x40, 0x42, 0x3c,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x02, 0x02, 0x3a, 0x46, 0x42, 0x42,
+   0x42, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x42,
+   0x7e, 0x40, 0x40, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x10,
+   0x7e, 0x10, 0x10, 0x10, 0x10, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x3b, 0x46, 0x42, 0x42, 0x46, 0x3a, 0x02, 0x02, 0x3c, 0x00,
+   0x00, 0x60, 0x20, 0x20, 0x2c, 0x32, 0x22, 0x22, 0x22, 0x77, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x38, 0x08, 0x08, 0x08, 0x08, 0x7f,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x7c, 0x04, 0x04, 0x04,
+   0x04, 0x04, 0x04, 0x04, 0x78, 0x00, 0x00, 0x60, 0x20, 0x20, 0x2e, 0x28,
+   0x30, 0x28, 0x24, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x08, 0x08, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0xd2, 0x6d, 0x49, 0x49, 0x49, 0xed, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x6c, 0x32, 0x22, 0x22, 0x22, 0x77, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x3c,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x32, 0x22, 0x22,
+   0x22, 0x3c, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x46,
+   0x42, 0x42, 0x46, 0x3a, 0x02, 0x02, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x6e, 0x30, 0x20, 0x20, 0x20, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x3e, 0x42, 0x3c, 0x02, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x20, 0x20, 0x7e, 0x20, 0x20, 0x20, 0x22, 0x1c, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x22, 0x22, 0x22, 0x26, 0x1b,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x42, 0x24, 0x24,
+   0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x41,
+   0x49, 0x55, 0x55, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x66, 0x24, 0x18, 0x18, 0x24, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x77, 0x22, 0x22, 0x14, 0x14, 0x08, 0x08, 0x10, 0x38, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x3e, 0x24, 0x08, 0x10, 0x22, 0x3e, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x04, 0x08, 0x08, 0x08, 0x08, 0x10, 0x08, 0x08, 0x08,
+   0x08, 0x04, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+   0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x10, 0x10, 0x10,
+   0x08, 0x10, 0x10, 0x10, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x32, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+   };
+
+static const uint8_t PackedCourierNew8_14_widths[95] = {
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+    8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8
+   };
+
+static const uint16_t PackedCourierNew8_14_offsets[95] = {
+       0,   112,   224,   336,   448,   560,   672,   784,   896,  1008,
+    1120,  1232,  1344,  1456,  1568,  1680,  1792,  1904,  2016,  2128,
+    2240,  2352,  2464,  2576,  2688,  2800,  2912,  3024,  3136,  3248,
+    3360,  3472,  3584,  3696,  3808,  3920,  4032,  4144,  4256,  4368,
+    4480,  4592,  4704,  4816,  4928,  5040,  5152,  5264,  5376,  5488,
+    5600,  5712,  5824,  5936,  6048,  6160,  6272,  6384,  6496,  6608,
+    6720,  6832,  6944,  7056,  7168,  7280,  7392,  7504,  7616,  7728,
+    7840,  7952,  8064,  8176,  8288,  8400,  8512,  8624,  8736,  8848,
+    8960,  9072,  9184,  9296,  9408,  9520,  9632,  9744,  9856,  9968,
+   10080, 10192, 10304, 10416, 10528
+   };
+
+const tPackedFont PackedCourierNew8_14 = {
+   0x20, 0x7e, 14, 8,
+   PackedCourierNew8_14_widths,
+   PackedCourierNew8_14_offsets,
+   PackedCourierNew8_14_bits,
+   0, 0,
+   0x3f
+   };
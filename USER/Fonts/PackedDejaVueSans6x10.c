@@ -0,0 +1,106 @@
+/**
+*  @file   PackedDejaVueSans6x10.c
+*  @brief  Packed font generated by Tools/fontpack.py from DejaVueSans6x10.c,
+*          do not edit
+*          PackedDejaVueSans6x10: 95 glyphs
+*             tImage font   2470 bytes (950 bitmap, 1520 tImage + tChar)
+*             packed font   1023 bytes (714 bits, 95 widths, 190 offsets, 0 kerning)
+*             saved         1447 bytes, 58%
+*/
+
+#include <stdint.h>
+#include "fonts.h"
+
+static const uint8_t PackedDejaVueSans6x10_bits[714] = {
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x41, 0x04,
+   0x00, 0x40, 0x00, 0x00, 0xa2, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+   0x29, 0xf5, 0x3e, 0x51, 0x40, 0x00, 0x00, 0x43, 0xd4, 0x70, 0x71, 0x5e,
+   0x10, 0x00, 0x38, 0xa3, 0xa3, 0x17, 0x14, 0x70, 0x00, 0x00, 0xe2, 0x0c,
+   0x55, 0x34, 0x8d, 0x00, 0x00, 0x04, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00,
+   0x10, 0x82, 0x08, 0x20, 0x82, 0x08, 0x10, 0x02, 0x08, 0x10, 0x41, 0x04,
+   0x10, 0x82, 0x00, 0x01, 0x53, 0x8e, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x10, 0x47, 0xc4, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+   0x20, 0x80, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0x08, 0x21, 0x04, 0x20, 0x84, 0x00,
+   0x00, 0xe4, 0x51, 0x55, 0x14, 0x4e, 0x00, 0x00, 0x1c, 0x10, 0x41, 0x04,
+   0x11, 0xf0, 0x00, 0x00, 0xe4, 0x41, 0x0c, 0x62, 0x1f, 0x00, 0x00, 0x0e,
+   0x44, 0x13, 0x81, 0x44, 0xe0, 0x00, 0x00, 0x21, 0x8a, 0x69, 0xf0, 0x82,
+   0x00, 0x00, 0x1e, 0x41, 0xe0, 0x41, 0x05, 0xe0, 0x00, 0x00, 0xf6, 0x10,
+   0x79, 0x14, 0x4e, 0x00, 0x00, 0x1f, 0x0c, 0x20, 0x84, 0x10, 0x80, 0x00,
+   0x00, 0xe4, 0x51, 0x39, 0x14, 0x4e, 0x00, 0x00, 0x0e, 0x45, 0x13, 0xc1,
+   0x0d, 0xe0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+   0x00, 0x80, 0x00, 0x00, 0x82, 0x08, 0x00, 0x00, 0x4e, 0x40, 0xe0, 0x40,
+   0x00, 0x00, 0x00, 0x03, 0xe0, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e,
+   0x04, 0xe4, 0x00, 0x00, 0x00, 0x1e, 0x08, 0x42, 0x08, 0x00, 0x80, 0x00,
+   0x00, 0xe2, 0x57, 0x55, 0x55, 0x57, 0x20, 0x60, 0x04, 0x10, 0xa2, 0x8e,
+   0x45, 0x10, 0x00, 0x01, 0xe4, 0x51, 0x79, 0x14, 0x5e, 0x00, 0x00, 0x0f,
+   0x65, 0x04, 0x10, 0x64, 0xf0, 0x00, 0x01, 0xe4, 0xd1, 0x45, 0x14, 0xde,
+   0x00, 0x00, 0x1f, 0x41, 0x07, 0xd0, 0x41, 0xf0, 0x00, 0x01, 0xf4, 0x10,
+   0x7d, 0x04, 0x10, 0x00, 0x00, 0x0e, 0x65, 0x04, 0xd1, 0x64, 0xf0, 0x00,
+   0x01, 0x14, 0x51, 0x7d, 0x14, 0x51, 0x00, 0x00, 0x1f, 0x10, 0x41, 0x04,
+   0x11, 0xf0, 0x00, 0x00, 0xe0, 0x82, 0x08, 0x24, 0x8c, 0x00, 0x00, 0x11,
+   0x49, 0x46, 0x14, 0x49, 0x10, 0x00, 0x01, 0x04, 0x10, 0x41, 0x04, 0x1f,
+   0x00, 0x00, 0x11, 0x6d, 0xb5, 0x51, 0x45, 0x10, 0x00, 0x01, 0x16, 0x59,
+   0x55, 0x34, 0xd1, 0x00, 0x00, 0x0e, 0x45, 0x14, 0x51, 0x44, 0xe0, 0x00,
+   0x01, 0xe4, 0x51, 0x79, 0x04, 0x10, 0x00, 0x00, 0x0e, 0x45, 0x14, 0x51,
+   0x44, 0xe0, 0xc0, 0x00, 0xf1, 0x12, 0x27, 0x89, 0x91, 0x21, 0x00, 0x00,
+   0x03, 0x91, 0x40, 0xe0, 0x51, 0x38, 0x00, 0x00, 0x7c, 0x41, 0x04, 0x10,
+   0x41, 0x00, 0x00, 0x04, 0x51, 0x45, 0x14, 0x51, 0x38, 0x00, 0x00, 0x45,
+   0x12, 0x8a, 0x28, 0x41, 0x00, 0x00, 0x08, 0x6d, 0xb5, 0xe4, 0x92, 0x48,
+   0x00, 0x00, 0x44, 0xa2, 0x84, 0x28, 0xa4, 0x40, 0x00, 0x04, 0x4a, 0x28,
+   0x41, 0x04, 0x10, 0x00, 0x00, 0x7c, 0x20, 0x84, 0x20, 0x87, 0xc0, 0x00,
+   0xc2, 0x08, 0x20, 0x82, 0x08, 0x20, 0xc0, 0x00, 0x40, 0x82, 0x04, 0x10,
+   0x20, 0x81, 0x00, 0xc1, 0x04, 0x10, 0x41, 0x04, 0x10, 0xc0, 0x00, 0x21,
+   0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x0f, 0xd0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+   0x13, 0xd1, 0x7c, 0x00, 0x10, 0x41, 0x07, 0x91, 0x45, 0x17, 0x80, 0x00,
+   0x00, 0x00, 0x39, 0x04, 0x10, 0x38, 0x00, 0x01, 0x04, 0x13, 0xd1, 0x45,
+   0x13, 0xc0, 0x00, 0x00, 0x00, 0x39, 0x17, 0xd0, 0x3c, 0x00, 0x06, 0x20,
+   0x87, 0x88, 0x20, 0x82, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x14, 0x51, 0x3c,
+   0x13, 0x90, 0x41, 0x07, 0x91, 0x45, 0x14, 0x40, 0x00, 0x40, 0x00, 0x30,
+   0x41, 0x04, 0x7c, 0x00, 0x04, 0x00, 0x07, 0x04, 0x10, 0x41, 0x04, 0x61,
+   0x04, 0x10, 0x49, 0x47, 0x12, 0x44, 0x00, 0x38, 0x20, 0x82, 0x08, 0x20,
+   0x81, 0x80, 0x00, 0x00, 0x00, 0x7d, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00,
+   0x07, 0x91, 0x45, 0x14, 0x40, 0x00, 0x00, 0x00, 0x39, 0x14, 0x51, 0x38,
+   0x00, 0x00, 0x00, 0x07, 0x91, 0x45, 0x17, 0x90, 0x40, 0x00, 0x00, 0x3d,
+   0x14, 0x51, 0x3c, 0x10, 0x40, 0x00, 0x03, 0xc9, 0x20, 0x82, 0x00, 0x00,
+   0x00, 0x00, 0x3d, 0x03, 0xc1, 0x78, 0x00, 0x00, 0x20, 0x87, 0x88, 0x20,
+   0x83, 0x80, 0x00, 0x00, 0x00, 0x45, 0x14, 0x51, 0x3c, 0x00, 0x00, 0x00,
+   0x04, 0x4a, 0x28, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x45, 0x52, 0x8a, 0x28,
+   0x00, 0x00, 0x00, 0x06, 0xca, 0x10, 0xa6, 0xc0, 0x00, 0x00, 0x00, 0x44,
+   0xa2, 0x84, 0x10, 0x46, 0x00, 0x00, 0x07, 0xc2, 0x10, 0x87, 0xc0, 0x00,
+   0x61, 0x04, 0x11, 0x81, 0x04, 0x10, 0x60, 0x04, 0x10, 0x41, 0x04, 0x10,
+   0x41, 0x04, 0x10, 0xc1, 0x04, 0x10, 0x31, 0x04, 0x10, 0xc0, 0x00, 0x00,
+   0x00, 0x1c, 0x0c, 0x00, 0x00, 0x00
+   };
+
+static const uint8_t PackedDejaVueSans6x10_widths[95] = {
+    6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+    6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+    6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+    6,  6,  7,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+    6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+    6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6
+   };
+
+static const uint16_t PackedDejaVueSans6x10_offsets[95] = {
+       0,    60,   120,   180,   240,   300,   360,   420,   480,   540,
+     600,   660,   720,   780,   840,   900,   960,  1020,  1080,  1140,
+    1200,  1260,  1320,  1380,  1440,  1500,  1560,  1620,  1680,  1740,
+    1800,  1860,  1920,  1980,  2040,  2100,  2160,  2220,  2280,  2340,
+    2400,  2460,  2520,  2580,  2640,  2700,  2760,  2820,  2880,  2940,
+    3000,  3070,  3130,  3190,  3250,  3310,  3370,  3430,  3490,  3550,
+    3610,  3670,  3730,  3790,  3850,  3910,  3970,  4030,  4090,  4150,
+    4210,  4270,  4330,  4390,  4450,  4510,  4570,  4630,  4690,  4750,
+    4810,  4870,  4930,  4990,  5050,  5110,  5170,  5230,  5290,  5350,
+    5410,  5470,  5530,  5590,  5650
+   };
+
+const tPackedFont PackedDejaVueSans6x10 = {
+   0x20, 0x7e, 10, 7,
+   PackedDejaVueSans6x10_widths,
+   PackedDejaVueSans6x10_offsets,
+   PackedDejaVueSans6x10_bits,
+   0, 0,
+   0x3f
+   };
@@ -0,0 +1,121 @@
+/**
+*  @file   PackedNokiaLargex_13.c
+*  @brief  Packed font generated by Tools/fontpack.py from NokiaLargex_13.c,
+*          do not edit
+*          PackedNokiaLargex_13: 95 glyphs
+*             tImage font   2833 bytes (1313 bitmap, 1520 tImage + tChar)
+*             packed font   1206 bytes (897 bits, 95 widths, 190 offsets, 0 kerning)
+*             saved         1627 bytes, 57%
+*/
+
+#include <stdint.h>
+#include "fonts.h"
+
+static const uint8_t PackedNokiaLargex_13_bits[897] = {
+   0x00, 0x00, 0x00, 0x03, 0x6d, 0xb6, 0x1b, 0x00, 0x7b, 0xde, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x3f, 0x89, 0x09, 0x3f, 0x92,
+   0x12, 0x12, 0x00, 0x00, 0x00, 0x08, 0x7b, 0x0c, 0x38, 0x70, 0xe1, 0x86,
+   0xf0, 0x80, 0x00, 0x00, 0x18, 0x89, 0x62, 0x50, 0x9c, 0x1a, 0xc1, 0xc8,
+   0x52, 0x34, 0x88, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1b, 0x1b, 0x0e,
+   0x1e, 0x76, 0xf3, 0xb1, 0x9e, 0xc0, 0x00, 0x00, 0x36, 0xc0, 0x00, 0x00,
+   0x00, 0x32, 0x66, 0x66, 0x66, 0x66, 0x23, 0x03, 0x11, 0x99, 0x99, 0x99,
+   0x99, 0x30, 0x00, 0x47, 0xc4, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x18, 0x67, 0xff, 0x98, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x03, 0x5a, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0xd8, 0x00, 0x22, 0x24, 0x44, 0x88, 0x91, 0x10, 0x00, 0x1e, 0x66, 0xcd,
+   0x9b, 0x36, 0x6c, 0xd9, 0x9e, 0x00, 0x00, 0x00, 0x0c, 0xe3, 0x18, 0xc6,
+   0x31, 0x9e, 0x00, 0x00, 0x07, 0x83, 0x0c, 0x31, 0x8c, 0x71, 0x87, 0xc0,
+   0x00, 0x00, 0x1e, 0x0c, 0x30, 0xcc, 0x0c, 0x30, 0xde, 0x00, 0x00, 0x00,
+   0x06, 0x1c, 0x38, 0xb1, 0x66, 0xcf, 0xc3, 0x06, 0x00, 0x00, 0x00, 0x0f,
+   0xb0, 0xc3, 0xc1, 0x86, 0x18, 0x6f, 0x00, 0x00, 0x00, 0x07, 0x18, 0x60,
+   0xf9, 0x9b, 0x36, 0x6c, 0xcf, 0x00, 0x00, 0x00, 0x07, 0xc3, 0x18, 0x61,
+   0x8c, 0x30, 0xc3, 0x00, 0x00, 0x00, 0x07, 0x99, 0xb3, 0x66, 0x79, 0x9b,
+   0x36, 0x67, 0x80, 0x00, 0x00, 0x00, 0xf3, 0x36, 0x6c, 0xd9, 0x9f, 0x06,
+   0x18, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x0d, 0x80, 0x00, 0x01, 0xb0,
+   0x1a, 0xd0, 0x00, 0x00, 0x01, 0xbf, 0x03, 0x83, 0x82, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x01, 0xff, 0xe0, 0x7f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x01,
+   0x87, 0xc3, 0x9d, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x70, 0xc6, 0x77, 0x30,
+   0x0c, 0x60, 0x00, 0x00, 0x00, 0x7c, 0x61, 0x93, 0xf8, 0xa6, 0x49, 0x92,
+   0x65, 0x94, 0xf9, 0x80, 0x1f, 0x00, 0x00, 0x00, 0x03, 0x87, 0x0b, 0x16,
+   0x2c, 0xd9, 0xfb, 0x36, 0x60, 0x00, 0x00, 0x00, 0xf9, 0x9b, 0x36, 0x6f,
+   0x99, 0xb3, 0x66, 0xf8, 0x00, 0x00, 0x00, 0x3b, 0x18, 0xc6, 0x31, 0x8c,
+   0x38, 0x00, 0x00, 0x0f, 0x9b, 0x33, 0x66, 0xcd, 0x9b, 0x36, 0xcf, 0x00,
+   0x00, 0x00, 0x07, 0xb1, 0x8c, 0x7b, 0x18, 0xc7, 0x80, 0x00, 0x03, 0xd8,
+   0xc6, 0x3d, 0x8c, 0x63, 0x00, 0x00, 0x00, 0x1e, 0x61, 0x83, 0x06, 0xec,
+   0xd9, 0xb3, 0x3a, 0x00, 0x00, 0x00, 0x0c, 0xd9, 0xb3, 0x66, 0xfd, 0x9b,
+   0x36, 0x6c, 0xc0, 0x00, 0x00, 0x0f, 0x66, 0x66, 0x66, 0x6f, 0x00, 0x00,
+   0xf6, 0x66, 0x66, 0x66, 0x66, 0xc0, 0x01, 0x9b, 0x66, 0xcf, 0x1e, 0x3e,
+   0x6c, 0xdd, 0x98, 0x00, 0x00, 0x00, 0xc6, 0x31, 0x8c, 0x63, 0x18, 0xf0,
+   0x00, 0x00, 0x06, 0x1b, 0x9d, 0xce, 0xff, 0x6d, 0xb6, 0xd8, 0x6c, 0x36,
+   0x18, 0x00, 0x00, 0x00, 0x00, 0x63, 0x73, 0x73, 0x7b, 0x6b, 0x6f, 0x67,
+   0x67, 0x63, 0x00, 0x00, 0x00, 0x00, 0x78, 0x93, 0x36, 0x6c, 0xd9, 0xb3,
+   0x24, 0x78, 0x00, 0x00, 0x00, 0x3c, 0xdb, 0x6d, 0xb6, 0xf3, 0x0c, 0x30,
+   0x00, 0x00, 0x00, 0x3c, 0x49, 0x9b, 0x36, 0x6c, 0xd9, 0x92, 0x3c, 0x30,
+   0x30, 0x00, 0x0f, 0x99, 0xb3, 0x66, 0xf9, 0xb3, 0x66, 0x6c, 0xc0, 0x00,
+   0x00, 0x01, 0xec, 0x30, 0xe1, 0xc3, 0x86, 0x1b, 0xc0, 0x00, 0x00, 0x0f,
+   0xcc, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x00, 0x00, 0x00, 0x19, 0xb3, 0x66,
+   0xcd, 0x9b, 0x36, 0x6c, 0xcf, 0x00, 0x00, 0x00, 0x03, 0x36, 0x6c, 0xcd,
+   0x9a, 0x34, 0x68, 0x70, 0xe0, 0x00, 0x00, 0x00, 0x06, 0x66, 0xcc, 0xd9,
+   0xdb, 0x7b, 0x6f, 0x45, 0x28, 0xa5, 0x1c, 0xe3, 0x9c, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0xcd, 0xd1, 0xe3, 0x83, 0x07, 0x1e, 0x2e, 0xcc, 0x00, 0x00,
+   0x00, 0x36, 0xdb, 0x4d, 0x1c, 0x61, 0x86, 0x18, 0x00, 0x00, 0x00, 0xf8,
+   0x63, 0x0c, 0x71, 0x86, 0x30, 0xf8, 0x00, 0x00, 0xec, 0xcc, 0xcc, 0xcc,
+   0xcc, 0xce, 0x08, 0x88, 0x44, 0x42, 0x22, 0x11, 0x10, 0x73, 0x33, 0x33,
+   0x33, 0x33, 0x37, 0x00, 0x08, 0x71, 0xec, 0xb3, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x31, 0x80, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x07, 0x06, 0x19, 0xed, 0xb6, 0xe8, 0x00, 0x00,
+   0xc1, 0x83, 0x07, 0xcc, 0xd9, 0xb3, 0x66, 0xcd, 0x70, 0x00, 0x00, 0x00,
+   0x00, 0x1d, 0x8c, 0x63, 0x18, 0x70, 0x00, 0x00, 0xc1, 0x83, 0x3e, 0xcd,
+   0x9b, 0x36, 0x6c, 0xce, 0x80, 0x00, 0x00, 0x00, 0x00, 0x39, 0xb6, 0xdf,
+   0x61, 0x83, 0xc0, 0x00, 0x01, 0xb3, 0x7b, 0x33, 0x33, 0x30, 0x00, 0x00,
+   0x00, 0x01, 0xd6, 0x6c, 0xd9, 0xb3, 0x66, 0x7c, 0x1b, 0xe0, 0x0c, 0x18,
+   0x30, 0x7c, 0xcd, 0x9b, 0x36, 0x6c, 0xd9, 0x80, 0x00, 0x01, 0xb0, 0xdb,
+   0x6d, 0xb0, 0x03, 0x61, 0xb6, 0xdb, 0x6d, 0x06, 0x18, 0x61, 0xb6, 0xde,
+   0x79, 0xe6, 0xdb, 0x00, 0x00, 0x1b, 0x6d, 0xb6, 0xdb, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x17, 0x73, 0x33, 0x66, 0x6c, 0xcd, 0x99, 0xb3, 0x36, 0x66,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe6, 0x6c, 0xd9, 0xb3, 0x66,
+   0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xcd, 0x9b, 0x36, 0x6c, 0xcf,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x99, 0xb3, 0x66, 0xcd, 0x9b, 0xe6,
+   0x0c, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x36, 0x6c, 0xd9, 0xb3, 0x3e, 0x0c,
+   0x18, 0x00, 0x00, 0x56, 0x66, 0x66, 0x60, 0x00, 0x00, 0x00, 0x76, 0x30,
+   0xe3, 0x1b, 0x80, 0x00, 0x01, 0x33, 0xb3, 0x33, 0x33, 0x80, 0x00, 0x00,
+   0x00, 0x19, 0xb3, 0x66, 0xcd, 0x9b, 0x33, 0xa0, 0x00, 0x00, 0x00, 0x00,
+   0x1b, 0x6d, 0xb6, 0x8a, 0x38, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+   0x6d, 0xbb, 0x6a, 0xda, 0xa2, 0xa8, 0xee, 0x33, 0x80, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x1b, 0x38, 0xe1, 0x8e, 0x3d, 0xb0, 0x00, 0x00, 0x00, 0x00,
+   0x6d, 0xb6, 0xda, 0x28, 0xe3, 0x84, 0x70, 0x00, 0x00, 0x01, 0xf1, 0xc6,
+   0x38, 0xc7, 0x1f, 0x00, 0x00, 0x0c, 0xcc, 0xcd, 0x8c, 0xcc, 0xcc, 0xc0,
+   0x92, 0x49, 0x24, 0x92, 0x41, 0x99, 0x99, 0x8d, 0x99, 0x99, 0x98, 0x00,
+   0x00, 0x00, 0x18, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x00
+   };
+
+static const uint8_t PackedNokiaLargex_13_widths[95] = {
+    2,  3,  5,  8,  6, 10,  8,  3,  4,  4,  6,  6,  3,  4,  3,  4,
+    7,  5,  6,  6,  7,  6,  7,  6,  7,  7,  3,  3,  6,  6,  6,  5,
+   10,  7,  7,  5,  7,  5,  5,  7,  7,  4,  4,  7,  5,  9,  8,  7,
+    6,  7,  7,  6,  6,  7,  7, 11,  7,  6,  6,  4,  4,  4,  6,  4,
+    4,  6,  7,  5,  7,  6,  4,  7,  7,  3,  3,  6,  3, 11,  7,  7,
+    7,  7,  4,  5,  4,  7,  6, 10,  6,  6,  6,  4,  3,  4,  6
+   };
+
+static const uint16_t PackedNokiaLargex_13_offsets[95] = {
+       0,    26,    65,   130,   234,   312,   442,   546,   585,   637,
+     689,   767,   845,   884,   936,   975,  1027,  1118,  1183,  1261,
+    1339,  1430,  1508,  1599,  1677,  1768,  1859,  1898,  1937,  2015,
+    2093,  2171,  2236,  2366,  2457,  2548,  2613,  2704,  2769,  2834,
+    2925,  3016,  3068,  3120,  3211,  3276,  3393,  3497,  3588,  3666,
+    3757,  3848,  3926,  4004,  4095,  4186,  4329,  4420,  4498,  4576,
+    4628,  4680,  4732,  4810,  4862,  4914,  4992,  5083,  5148,  5239,
+    5317,  5369,  5460,  5551,  5590,  5629,  5707,  5746,  5889,  5980,
+    6071,  6162,  6253,  6305,  6370,  6422,  6513,  6591,  6721,  6799,
+    6877,  6955,  7007,  7046,  7098
+   };
+
+const tPackedFont PackedNokiaLargex_13 = {
+   0x20, 0x7e, 13, 11,
+   PackedNokiaLargex_13_widths,
+   PackedNokiaLargex_13_offsets,
+   PackedNokiaLargex_13_bits,
+   0, 0,
+   0x3f
+   };
@@ -1,40 +1,69 @@
-/**
-*  @file   fonts.h
-*  @author Rob Gee
-*  @date   November 2017
-*  @brief  Include file for bit mapped fonts
-*/
-
-#ifndef FONTS_H
-#define FONTS_H
-
-#include "graphics.h"
-
-
-/*-- Types -------------------------------------------------------------------*/
-
-typedef struct 
-{
-   long int code;
-   const tImage *image;
-} tChar;
-
-typedef struct
-{
-   int length;
-   const tChar *chars;
-} tFont;
-
-/* Exported types -----------------------------------------------------------*/
-typedef enum {MIN_FONT = 0, FIXEDSYS_8_14 = 0, 
-             COURIER_NEW8_14, NOKIALARGEX_13, DEJAVUESANS6_10, MAX_FONT} fontselect_t;
-
-
-#include "FixedSys8_14.h"
-//#include "Terminal6_8.h"
-#include "CourierNew8_14.h"
-#include "NokiaLargex_13.h"
-#include "DejaVueSans6x10.h"
-//#include "AsciiLib.h"
-
-#endif
+/**
+*  @file   fonts.h
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Include file for bit mapped fonts
+*/
+
+#ifndef FONTS_H
+#define FONTS_H
+
+#include "Graphics.h"
+
+
+/*-- Constants ---------------------------------------------------------------*/
+#define FONT_DEFAULT_CHAR  '?'   /* drawn in place of codes a font does not have */
+
+/*-- Types -------------------------------------------------------------------*/
+
+typedef struct 
+{
+   long int code;
+   const tImage *image;
+} tChar;
+
+typedef struct
+{
+   int length;
+   const tChar *chars;
+} tFont;
+
+/* Kerning pair, adjust is added to the advance of first before second */
+typedef struct
+{
+   uint8_t first;
+   uint8_t second;
+   int8_t  adjust;
+} tKernPair;
+
+/* Packed font, made by Tools/fontpack.py from a tImage font. Every glyph is
+   in one bit stream, rows width pixels long with no padding. Glyph of code c
+   is widths[c - first] wide and starts offsets[c - first] bits into bits.
+   Every glyph is height rows, max_width is the widest */
+typedef struct
+{
+   uint8_t first;             /* first and last character codes   */
+   uint8_t last;
+   uint8_t height;
+   uint8_t max_width;
+   const uint8_t* widths;
+   const uint16_t* offsets;
+   const uint8_t* bits;
+   const tKernPair* kern;     /* sorted by first then second, or 0 */
+   uint8_t n_kern;
+   uint8_t default_char;      /* drawn for codes outside first to last */
+} tPackedFont;
+
+/* Exported types -----------------------------------------------------------*/
+typedef enum {MIN_FONT = 0, FIXEDSYS_8_14 = 0, 
+             COURIER_NEW8_14, NOKIALARGEX_13, DEJAVUESANS6_10, MAX_FONT} fontselect_t;
+
+
+#include "FixedSys8_14.h"
+//#include "Terminal6_8.h"
+#include "CourierNew8_14.h"
+#include "NokiaLargex_13.h"
+#include "DejaVueSans6x10.h"
+//#include "AsciiLib.h"
+
+#endif
@@ -1,158 +1,444 @@
-/**
-*  @file   GraphText.c
-*  @author Rob Gee
-*  @date   November 2017
-*  @brief  Text rending API for 1 bit depth graphics
-*/
-
-/***** Include files  *********************************************/
-#include "stm32f10x.h"
-#include "Graphics.h"
-#include "GraphText.h" 
-#include <string.h>
-#include <stdlib.h>
-
-/***** Constants  *************************************************/
-
-
-/***** Types      *************************************************/
-
-/***** Storage    *************************************************/
-
-const tChar* (*GetFontChar)(u8);
-
-// Access function for fonts
-/***** Local prototypes    ****************************************/
-
-
-/***** Exported functions  ****************************************/
-
-/**
-*  @fn         SetFont
-*  @param[IN]  font selection (fontselect_t)
-*  @brief      Simple starfield simulatiuon
-*/
-void SetFont(fontselect_t font)
-{
-   switch (font)
-   {
-      case FIXEDSYS_8_14:
-         GetFontChar = &GetFontFixedSys8_14;
-      break;
-
-      case NOKIALARGEX_13:
-          GetFontChar = &GetFontNokiaLargex_13;
-      break;
-
-      case COURIER_NEW8_14:
-         GetFontChar = &GetFontCourier_new8_14;
-      break;
-      
-      case DEJAVUESANS6_10:
-         GetFontChar = &GetFontDejaVueSans6x10;
-      break;
-
-      default:
-         GetFontChar = &GetFontFixedSys8_14;
-      break;
-   }
-}
-
-/**
-*  @fn         GPutChar
-*  @param[IN]  ASCII code
-*  @param[IN]  action - selects plot action
-*     @arg     0 - clear
-*     @arg     1 - set
-*     @arg     2 - OR
-*  @return     number of pixels written in X direction
-*  @brief      Renders single character
-*/
-uint16_t GPutChar(uint8_t ASCI, uint8_t action)
-{
-   const tChar* fontch_p;
-   fontch_p = GetFontChar(ASCI);
-   return PutBitmap((tImage*)fontch_p->image, action);
-}
-
-/**
-*  @fn         PutText
-*  @param[IN]  pointer to string to be printed
-*  @param[IN]  action - selects plot action
-*     @arg     0 - clear
-*     @arg     1 - set
-*     @arg     2 - OR
-*  @return     Number of pixels written in X direction
-*  @brief      Renders single character
-*/
-uint16_t PutText(uint8_t *str, uint8_t action)
-{
-   uint16_t x_pixels = 0;
- 
-   while(*str != 0)
-   {
-      x_pixels += GPutChar(*str++, action);
-   }
-
-   return x_pixels;
-}
-
-
-/**
-*  @fn         PutInt16
-*  @param[IN]  number to be printed
-*  @param[IN]  action - selects plot action
-*     @arg     0 - clear
-*     @arg     1 - set
-*  @brief      Returns pixel width written
-*/
-uint16_t PutInt16(uint16_t val, uint8_t action)
-{
-   uint8_t str[6];
-   uint16_t i;
-   for (i = 0; i < 5; i++)
-   {
-      str[4-i] = (uint8_t)((val % 10) + '0');
-      val /= 10;
-   }
-   str[5] = 0;
-   return PutText(str, action);
-}
-
-/**
-*  @fn         GetTextLen
-*  @param[IN]  pointer to string
-*  @brief      Returns length of string in pixels, for currently selected font
-*/
-uint16_t GetTextLen(uint8_t *str)
-{
-   uint16_t x_pixels = 0;
-   const tChar* fontch_p;
-   
-   while(*str != 0)
-   {
-      fontch_p = GetFontChar(*str++);
-      x_pixels += fontch_p->image->width;
-   }
-   
-   return x_pixels;
-}
-
-/**
-*  @fn         GetTextHeight
-*  @param[IN]  pointer to string
-*  @brief      Returns height of currently selected font
-*/
-uint16_t GetTextHeight(uint8_t *str)
-{
-   const tChar* fontch_p = GetFontChar(*str); 
-   uint16_t y_pixels = fontch_p->image->height;
-   
-   return y_pixels;
-}
-
-
-
-
-
-
+/**
+*  @file   GraphText.c
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Text rending API for 1 bit depth graphics
+*/
+
+/***** Include files  *********************************************/
+#include "stm32f10x.h"
+#include "Graphics.h"
+#include "GraphText.h" 
+#include "Instrument.h"
+#include <string.h>
+#include <stdlib.h>
+
+/***** Constants  *************************************************/
+#define TEXT_RUN_LEN    16U      /* glyphs drawn by each PutBitRun() */
+#define TEXT_MEASURE    0xFFU    /* layoutText() action, measure only */
+
+
+/***** Types      *************************************************/
+
+/***** Storage    *************************************************/
+
+static const tPackedFont* pFont = &PackedFixedSys8_14;
+
+/***** Local prototypes    ****************************************/
+static __INLINE uint8_t glyphIndex(uint8_t code);
+static uint16_t putChars(const uint8_t* str, uint16_t n_chars, uint8_t action);
+static uint8_t layoutText(const tClipRect* p_box, const uint8_t* str, tTextAlign align,
+                          tTextWrap wrap, uint8_t action, tClipRect* p_bounds);
+static const uint8_t* breakLine(const uint8_t* str, uint16_t box_width, tTextWrap wrap,
+                                uint16_t* p_n_chars, uint16_t* p_width);
+static void getGlyph(uint8_t code, tBitImage* p_glyph);
+static int8_t getKern(uint8_t first, uint8_t second);
+
+
+/***** Exported functions  ****************************************/
+
+/**
+*  @fn         SetFont
+*  @param[IN]  font selection (fontselect_t)
+*  @brief      Simple starfield simulatiuon
+*/
+void SetFont(fontselect_t font)
+{
+   switch (font)
+   {
+      case FIXEDSYS_8_14:
+         pFont = &PackedFixedSys8_14;
+      break;
+
+      case NOKIALARGEX_13:
+          pFont = &PackedNokiaLargex_13;
+      break;
+
+      case COURIER_NEW8_14:
+         pFont = &PackedCourierNew8_14;
+      break;
+      
+      case DEJAVUESANS6_10:
+         pFont = &PackedDejaVueSans6x10;
+      break;
+
+      default:
+         pFont = &PackedFixedSys8_14;
+      break;
+   }
+}
+
+/**
+*  @fn         GPutChar
+*  @param[IN]  ASCII code
+*  @param[IN]  action - selects plot action
+*     @arg     0 - clear
+*     @arg     1 - set
+*     @arg     2 - OR
+*     @arg     3 - XOR
+*  @return     number of pixels written in X direction
+*  @brief      Renders single character
+*/
+uint16_t GPutChar(uint8_t ASCI, uint8_t action)
+{
+   tBitImage glyph;
+
+   getGlyph(ASCI, &glyph);
+   return PutBitRun(&glyph, 1, action);
+}
+
+/**
+*  @fn         PutText
+*  @param[IN]  pointer to string to be printed
+*  @param[IN]  action - selects plot action
+*     @arg     0 - clear
+*     @arg     1 - set
+*     @arg     2 - OR
+*     @arg     3 - XOR
+*  @return     Number of pixels written in X direction
+*  @brief      Renders string at the cursor
+*/
+uint16_t PutText(uint8_t *str, uint8_t action)
+{
+   uint16_t x_pixels;
+   INSTR_START(INSTR_PUT_TEXT);
+
+   x_pixels = putChars(str, (uint16_t)strlen((char*)str), action);
+
+   INSTR_STOP(INSTR_PUT_TEXT);
+   return x_pixels;
+}
+
+/**
+*  @fn         PutTextBox
+*  @param[IN]  box, inclusive coordinates
+*  @param[IN]  pointer to string to be printed, '\n' starts a new line
+*  @param[IN]  align - position of each line across the box
+*  @param[IN]  wrap - how lines wider than the box are broken
+*  @param[IN]  action - selects plot action, as PutText
+*  @param[OUT] bounding box of the text, may be 0. Unchanged if no lines fit
+*  @return     Number of lines drawn
+*  @brief      Breaks string into lines that fit the box, then renders them
+*              top down from the top of the box. Each line is measured once.
+*              Lines that do not fit below the box are dropped
+*/
+uint8_t PutTextBox(const tClipRect* pBox, uint8_t *str, tTextAlign align, tTextWrap wrap,
+                   uint8_t action, tClipRect* pBounds)
+{
+   uint8_t n_lines;
+   INSTR_START(INSTR_PUT_TEXT);
+
+   n_lines = layoutText(pBox, str, align, wrap, action, pBounds);
+
+   INSTR_STOP(INSTR_PUT_TEXT);
+   return n_lines;
+}
+
+/**
+*  @fn         MeasureTextBox
+*  @param[IN]  box, inclusive coordinates
+*  @param[IN]  pointer to string
+*  @param[IN]  align - position of each line across the box
+*  @param[IN]  wrap - how lines wider than the box are broken
+*  @param[OUT] bounding box PutTextBox() would draw, may be 0
+*  @return     Number of lines PutTextBox() would draw
+*/
+uint8_t MeasureTextBox(const tClipRect* pBox, uint8_t *str, tTextAlign align, tTextWrap wrap,
+                       tClipRect* pBounds)
+{
+   return layoutText(pBox, str, align, wrap, TEXT_MEASURE, pBounds);
+}
+
+
+/**
+*  @fn         PutInt16
+*  @param[IN]  number to be printed
+*  @param[IN]  action - selects plot action
+*     @arg     0 - clear
+*     @arg     1 - set
+*  @brief      Returns pixel width written
+*/
+uint16_t PutInt16(uint16_t val, uint8_t action)
+{
+   uint8_t str[6];
+   uint16_t i;
+   for (i = 0; i < 5; i++)
+   {
+      str[4-i] = (uint8_t)((val % 10) + '0');
+      val /= 10;
+   }
+   str[5] = 0;
+   return PutText(str, action);
+}
+
+/**
+*  @fn         GetTextLen
+*  @param[IN]  pointer to string
+*  @brief      Returns length of string in pixels, for currently selected font,
+*              from the font width table
+*/
+uint16_t GetTextLen(uint8_t *str)
+{
+   uint16_t x_pixels = 0;
+   
+   while(*str != 0)
+   {
+      x_pixels += pFont->widths[glyphIndex(*str)];
+      if(pFont->kern != 0)
+         x_pixels += getKern(str[0], str[1]);
+      str++;
+   }
+   
+   return x_pixels;
+}
+
+/**
+*  @fn         GetTextHeight
+*  @param[IN]  pointer to string
+*  @brief      Returns height of currently selected font
+*/
+uint16_t GetTextHeight(uint8_t *str)
+{
+   (void)str;
+   return pFont->height;
+}
+
+/***** Local    functions  ****************************************/
+
+/**
+*  @fn         putChars
+*  @param[IN]  pointer to characters
+*  @param[IN]  number of characters
+*  @param[IN]  action - selects plot action
+*  @return     Number of pixels written in X direction
+*  @brief      Renders characters at the cursor, glyphs are passed to
+*              PutBitRun in groups so each frame buffer row is written once
+*              per group. A kerning pair ends the group and moves the cursor
+*/
+static uint16_t putChars(const uint8_t* str, uint16_t n_chars, uint8_t action)
+{
+   uint16_t x_pixels = 0;
+   tBitImage glyphs[TEXT_RUN_LEN];
+   const tGraphCtx* p_screen;
+   uint8_t n;
+   int8_t kern = 0;
+
+   while(n_chars != 0)
+   {
+      for(n = 0; (n < TEXT_RUN_LEN) && (n_chars != 0) && (kern == 0); n++, n_chars--)
+      {
+         getGlyph(*str, &glyphs[n]);
+         if((pFont->kern != 0) && (n_chars > 1U))
+            kern = getKern(str[0], str[1]);
+         str++;
+      }
+      x_pixels += PutBitRun(glyphs, n, action);
+      if(kern != 0)
+      {
+         p_screen = GraphGetScreen();
+         GotoXY((uint16_t)(p_screen->x_draw + kern), p_screen->y_draw);
+         x_pixels += kern;
+         kern = 0;
+      }
+   }
+   return x_pixels;
+}
+
+/**
+*  @fn         layoutText
+*  @param[IN]  box, inclusive coordinates
+*  @param[IN]  pointer to string
+*  @param[IN]  align
+*  @param[IN]  wrap
+*  @param[IN]  action - selects plot action, TEXT_MEASURE to draw nothing
+*  @param[OUT] bounding box of lines, may be 0
+*  @return     Number of lines that fit the box
+*  @brief      Common part of PutTextBox() and MeasureTextBox()
+*/
+static uint8_t layoutText(const tClipRect* p_box, const uint8_t* str, tTextAlign align,
+                          tTextWrap wrap, uint8_t action, tClipRect* p_bounds)
+{
+   uint16_t box_width = p_box->x2 - p_box->x1 + 1U;
+   uint16_t y = p_box->y1;
+   uint16_t x;
+   uint16_t n_chars;
+   uint16_t width;
+   uint16_t x_min = 0xFFFF;
+   uint16_t x_max = 0;
+   uint8_t n_lines = 0;
+   const uint8_t* p_next;
+
+   while((*str != 0) && (((uint32_t)y + pFont->height - 1U) <= p_box->y2))
+   {
+      p_next = breakLine(str, box_width, wrap, &n_chars, &width);
+
+      x = p_box->x1;
+      if(width < box_width)
+      {
+         if(align == TEXT_ALIGN_CENTRE)
+            x += (box_width - width) / 2U;
+         else if(align == TEXT_ALIGN_RIGHT)
+            x += box_width - width;
+      }
+
+      if(action != TEXT_MEASURE)
+      {
+         GotoXY(x, y);
+         putChars(str, n_chars, action);
+      }
+
+      /* Empty lines are counted a pixel wide, at their aligned position */
+      if(x > p_box->x2)
+         x = p_box->x2;
+      if(x < x_min)
+         x_min = x;
+      if((x + width) > x_max)
+         x_max = x + width;
+      if(x >= x_max)
+         x_max = x + 1U;
+
+      n_lines++;
+      y += pFont->height;
+      str = p_next;
+   }
+
+   if((n_lines != 0) && (p_bounds != 0))
+   {
+      p_bounds->x1 = x_min;
+      p_bounds->y1 = p_box->y1;
+      p_bounds->x2 = x_max - 1U;
+      p_bounds->y2 = y - 1U;
+   }
+   return n_lines;
+}
+
+/**
+*  @fn         breakLine
+*  @param[IN]  pointer to start of line
+*  @param[IN]  width of box, pixels
+*  @param[IN]  wrap
+*  @param[OUT] number of characters to draw
+*  @param[OUT] width of those characters, pixels
+*  @return     start of next line
+*  @brief      Finds the end of a line: a '\n', the end of the string, or for
+*              wrapped text the last space or character that fits the box.
+*              Spaces where a line is wrapped are not drawn. Unwrapped lines
+*              are cut after the last whole character that fits
+*/
+static const uint8_t* breakLine(const uint8_t* str, uint16_t box_width, tTextWrap wrap,
+                                uint16_t* p_n_chars, uint16_t* p_width)
+{
+   const uint8_t* p = str;
+   const uint8_t* p_space = 0;
+   uint16_t width = 0;
+   uint16_t space_width = 0;
+   uint16_t char_width;
+
+   while((*p != 0) && (*p != '\n'))
+   {
+      char_width = pFont->widths[glyphIndex(*p)];
+      if((p != str) && (pFont->kern != 0))
+         char_width += getKern(p[-1], p[0]);
+
+      if((width + char_width) > box_width)
+      {
+         if(wrap == TEXT_WRAP_NONE)
+         {
+            /* Cut, skip rest of line */
+            *p_n_chars = p - str;
+            *p_width = width;
+            while((*p != 0) && (*p != '\n'))
+               p++;
+            return (*p == '\n') ? p + 1 : p;
+         }
+         if((wrap == TEXT_WRAP_WORD) && (p_space != 0))
+         {
+            *p_n_chars = p_space - str;
+            *p_width = space_width;
+            p = p_space;
+         }
+         else
+         {
+            /* Always take a character, even if it is wider than the box */
+            if(p == str)
+            {
+               width = char_width;
+               p++;
+            }
+            *p_n_chars = p - str;
+            *p_width = width;
+         }
+         while(*p == ' ')
+            p++;
+         return p;
+      }
+
+      if((*p == ' ') && (p != str) && (p[-1] != ' '))
+      {
+         p_space = p;
+         space_width = width;
+      }
+      width += char_width;
+      p++;
+   }
+
+   *p_n_chars = p - str;
+   *p_width = width;
+   return (*p == '\n') ? p + 1 : p;
+}
+
+/**
+*  @fn         glyphIndex
+*  @param[IN]  character code
+*  @return     index into tables of current font, of the default character
+*              if the font does not have code
+*/
+static __INLINE uint8_t glyphIndex(uint8_t code)
+{
+   uint8_t i = code - pFont->first;
+
+   if(i > (uint8_t)(pFont->last - pFont->first))
+      i = pFont->default_char - pFont->first;
+   return i;
+}
+
+/**
+*  @fn         getGlyph
+*  @param[IN]  character code
+*  @param[OUT] glyph of current font, as a bit image
+*/
+static void getGlyph(uint8_t code, tBitImage* p_glyph)
+{
+   uint8_t i = glyphIndex(code);
+
+   p_glyph->bits = pFont->bits;
+   p_glyph->offset = pFont->offsets[i];
+   p_glyph->pitch = pFont->widths[i];
+   p_glyph->width = pFont->widths[i];
+   p_glyph->height = pFont->height;
+}
+
+/**
+*  @fn         getKern
+*  @param[IN]  character code
+*  @param[IN]  following character code
+*  @return     adjustment to advance of first character, pixels
+*/
+static int8_t getKern(uint8_t first, uint8_t second)
+{
+   const tKernPair* p_pair = pFont->kern;
+   uint8_t i;
+
+   for(i = 0; (i < pFont->n_kern) && (p_pair->first <= first); i++, p_pair++)
+   {
+      if((p_pair->first == first) && (p_pair->second == second))
+         return p_pair->adjust;
+   }
+   return 0;
+}
+
+
+
+
+
+
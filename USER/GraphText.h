@@ -1,46 +1,55 @@
-/**
-*  @file   GraphText.h
-*  @author Rob Gee
-*  @date   November 2017
-*  @brief  Include file for Text rendering API
-*/
-
-#ifndef __GRAPHTEXT_H 
-#define __GRAPHTEXT_H
-
-/* Includes ------------------------------------------------------------------*/
-#include "fonts.h"
-
-/* Private define ------------------------------------------------------------*/
-#define DISP_ORIENTATION  90  /* angle 0 90 */ 
-#define LEFT_RIGHT         0
-#define TOP_BOTTOM         1
-#define FILL_DIRECTION  LEFT_RIGHT
-//#define FILL_DIRECTION  TOP_BOTTOM
-
-#if  ( DISP_ORIENTATION == 90 ) || ( DISP_ORIENTATION == 270 )
-
-#define  MAX_X  320
-#define  MAX_Y  240   
-
-#elif  ( DISP_ORIENTATION == 0 ) || ( DISP_ORIENTATION == 180 )
-
-#define  MAX_X  240
-#define  MAX_Y  320   
-
-#endif
-
-void SetFont(fontselect_t font);
-uint16_t GPutChar(uint8_t ASCI, uint8_t action);
-uint16_t PutText(uint8_t *str, uint8_t action);
-uint16_t PutInt16(uint16_t val, uint8_t action);
-uint16_t GetTextLen(uint8_t *str);
-uint16_t GetTextHeight(uint8_t *str);
-
-
-#endif   /* __GRAPHTEXT_H   */
-
-
-
-
-
+/**
+*  @file   GraphText.h
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Include file for Text rendering API
+*/
+
+#ifndef __GRAPHTEXT_H 
+#define __GRAPHTEXT_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.h"
+
+/* Private define ------------------------------------------------------------*/
+#define DISP_ORIENTATION  90  /* angle 0 90 */ 
+#define LEFT_RIGHT         0
+#define TOP_BOTTOM         1
+#define FILL_DIRECTION  LEFT_RIGHT
+//#define FILL_DIRECTION  TOP_BOTTOM
+
+#if  ( DISP_ORIENTATION == 90 ) || ( DISP_ORIENTATION == 270 )
+
+#define  MAX_X  320
+#define  MAX_Y  240   
+
+#elif  ( DISP_ORIENTATION == 0 ) || ( DISP_ORIENTATION == 180 )
+
+#define  MAX_X  240
+#define  MAX_Y  320   
+
+#endif
+
+typedef enum {TEXT_ALIGN_LEFT = 0, TEXT_ALIGN_CENTRE, TEXT_ALIGN_RIGHT} tTextAlign;
+typedef enum {TEXT_WRAP_NONE = 0,      /* lines are cut at the box edge    */
+              TEXT_WRAP_WORD,          /* break at spaces where possible   */
+              TEXT_WRAP_CHAR} tTextWrap;
+
+void SetFont(fontselect_t font);
+uint16_t GPutChar(uint8_t ASCI, uint8_t action);
+uint16_t PutText(uint8_t *str, uint8_t action);
+uint16_t PutInt16(uint16_t val, uint8_t action);
+uint16_t GetTextLen(uint8_t *str);
+uint16_t GetTextHeight(uint8_t *str);
+uint8_t PutTextBox(const tClipRect* pBox, uint8_t *str, tTextAlign align, tTextWrap wrap,
+                   uint8_t action, tClipRect* pBounds);
+uint8_t MeasureTextBox(const tClipRect* pBox, uint8_t *str, tTextAlign align, tTextWrap wrap,
+                       tClipRect* pBounds);
+
+
+#endif   /* __GRAPHTEXT_H   */
+
+
+
+
+
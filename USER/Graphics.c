@@ -1,559 +1,2268 @@
-/**
-*  @file   Video.c
-*  @author Rob Gee
-*  @date   November 2017
-*  @brief  compositite video signal generator, for STM32
-*/
-
-/***** Include files  *********************************************/
-#include <stm32f10x.h>
-#include <string.h>
-#include "bsp.h"
-#include "Video.h"
-#include "Graphics.h"
-
-/***** Constants  *************************************************/
-#define TIMING_TEST
-
-/***** Types      *************************************************/
-
-/***** Storage    *************************************************/
-static volatile uint8_t vBlankActive = 0;
-
-static struct
-{
-   uint8_t *pBuff;    /* pointer to frame buffer  */
-   uint16_t x_draw;
-   uint16_t y_draw;
-   uint8_t  bit_pos;
-} GraphCtx;
-
-
-/***** Local prototypes    ****************************************/
-static void VblankCallback(uint8_t event);
-static void PutHline(uint16_t x, uint16_t y, uint16_t len, uint8_t action);
-static void plot8points(uint16_t cx, uint16_t cy, uint16_t x, uint16_t y, uint16_t Action);
-static void plot4points(uint16_t cx, uint16_t cy, uint16_t x, uint16_t y, uint16_t Action);
-
-
-/***** Exported functions  ****************************************/
-/**
-*  @fn     graphicsInit
-*  @brief  Initialises graphics system
-*/
-void GraphicsInit(void)
-{
-   VideoInit();
-   setVerticalBlankingCallback(VblankCallback);
-}
-
-/**
-*  @fn     GraphicsTick
-*  @brief  Called every tick for graphical object animation and update
-*/
-void GraphicsTick(void)
-{
-   if(vBlankActive != 0)
-   {
-      /* Carry out FrameBuffer updates */
-   }
-}
-
-
-/**
-*  @fn        PutPixel
-*  @param[IN] x coordinate
-*  @param[IN] y coordinate
-*  @param[IN] action, 1 = set, 0 = clear
-*  @brief     Sets pixel at specified location
-*/
-void PutPixel(uint16_t x, uint16_t y, uint8_t action)
-{
-   /* X Byte index and bit mask */
-   uint16_t x_index = x >> 3U; 
-   uint16_t bit_pos = x & 7;
-   uint8_t  mask = (0x80 >> bit_pos);
-   
-   if (action == 1)
-   {
-      FrameBuff[y][x_index] |= mask;
-   }
-   else if (action == 0)
-   {
-      FrameBuff[y][x_index] &= ~mask;
-   }
-}
-
-
-/**
-*  @fn        PutLine
-*  @param[IN] x coordinate, 1st point
-*  @param[IN] y coordinate, 1st point
-*  @param[IN] x coordinate, 2nd point
-*  @param[IN] y coordinate, 2nd point
-*  @param[IN] action, 1 = set, 0 = clear
-*  @brief     Draws line between specified points
-              x2 >= x1
-*/
-void PutLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t action)
-{
-   /* Bressenhans algorithm works by traversing the longest difference on a pixel
-    by pixel basis, using a roll over counter to determine when to increment the 
-    counter for the short difference
-   */
-   uint16_t rollcount;
-   uint16_t Xstep, Ystep;
-   uint16_t Xstart, Ystart;
-   int16_t inc = 1;
-   uint16_t count;
-   
-   /* Establish if we are going to have to decrement on rollover */
-   if(x2 > x1)
-   {
-      Xstep = x2 - x1;
-   }
-   else
-   {
-      Xstep = x1 - x2;
-      inc = 0 - inc;
-   }
-   if(y2 > y1)
-   {
-      Ystep = y2 - y1;
-   }
-   else
-   {
-      Ystep = y1 - y2;
-      inc = 0 - inc;
-   }
-
-   if (Xstep > Ystep)
-   {
-      if (x2 > x1)
-         Xstart = x1;
-      else
-         Xstart = x2;
-
-      if(y2 > y1)
-      {
-         if(inc == -1)
-            Ystart = y2;
-         else
-            Ystart = y1;
-      }
-      else
-      {
-         if(inc == -1)
-            Ystart = y1;
-         else
-            Ystart = y2;
-      }
-      PutPixel(Xstart, Ystart, action);      // draw the first pixel on its own,
-
-      // X increment larger, so traverse in X direction
-      rollcount = Xstep >> 1;
-      count = Xstep;
-      while(count--)
-      {
-         rollcount += Ystep;
-         if (rollcount >= Xstep)
-         {
-             rollcount -= Xstep;
-             Ystart += inc;
-         }
-         Xstart++;
-         PutPixel(Xstart, Ystart, action);
-      }
-   }
-   else
-   {
-      if (y2 > y1)
-         Ystart = y1;
-      else
-         Ystart = y2;
-
-      if(x2 > x1)
-      {
-         if(inc == -1)
-            Xstart = x2;
-         else
-            Xstart = x1;
-      }
-      else
-      {
-         if(inc == -1)
-            Xstart = x1;
-         else
-            Xstart = x2;
-      }
-
-      rollcount = Ystep >> 1;
-      count = Ystep;
-      while(count--)
-      {
-         rollcount += Xstep;
-         if (rollcount >= Ystep)
-         {
-             rollcount -= Ystep;
-             Xstart += inc;
-         }
-         Ystart++;
-         PutPixel(Xstart, Ystart, action);
-      }
-   }
-}
-
-/**
-*  @fn        PutVline
-*  @param[IN] x coordinate
-*  @param[IN] y coordinate
-*  @param[IN] length of line
-*  @param[IN] action, 1 = set, 0 = clear
-*  @brief     Draws vertical line starting from specified point
-*/
-void PutVline(uint16_t x, uint16_t y, uint16_t len, uint8_t action)
-{
-   /* To do a vertical line just work identify start byte then increment by NUM_X_BYTES each time */
-   uint16_t x_index = x >> 3U; 
-   uint16_t bit_pos = x & 7;
-   uint8_t  mask = (0x80 >> bit_pos);
-   uint8_t *pFrameBuff = &FrameBuff[y][x_index];
-
-   if(action == 0)
-   {
-      mask = ~mask;
-   }
-
-   while(len-- > 0)
-   {
-      if(action == 1)
-         *pFrameBuff |= mask;
-      else if(action == 0)
-         *pFrameBuff &= mask;
-      pFrameBuff += NUM_X_BYTES;
-   }
-
-}
-
-
-
-/**
-*  @fn        PutRectangle
-*  @param[IN] x coordinate, 1st point
-*  @param[IN] y coordinate, 1st point
-*  @param[IN] x coordinate, 2nd point
-*  @param[IN] y coordinate, 2nd point
-*  @param[IN] action, 1 = set, 0 = clear
-*  @brief     Draws rectangle between specified points
-*/
-void PutRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t action)
-{
-   PutHline(x1, y1, x2-x1+1, action);     /* top            */
-   PutVline(x1, y1+1, y2-y1-1, action);   /* left side      */
-   PutVline(x2, y1+1, y2-y1-1, action);   /* right side     */
-   PutHline(x1, y2,  x2-x1+1, action);    /* bottom         */
-}
-
-/**
-*  @fn        FillRectangle
-*  @param[IN] x coordinate, 1st point
-*  @param[IN] y coordinate, 1st point
-*  @param[IN] x coordinate, 2nd point
-*  @param[IN] y coordinate, 2nd point
-*  @param[IN] action, 1 = set, 0 = clear
-*  @brief     Fills rectangle between specified points
-*/
-void FillRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t action)
-{
-   uint16_t count = y2-y1+1;
-   uint16_t i;
-
-   for(i = 0; i < count; i++)
-   {
-      PutHline(x1, y1+i, x2-x1+1, action);  
-   }
-}
-
-/*****************************************************************************/
-/**
-*  @fn        PutCircle
-*  @param[IN] cx  - centre coordinate
-*  @param[IN] cy  - centre coordinate
-*  @param[IN] radius
-*  @param[IN] action, 1 = set, 0 = clear
-*  @brief     Sub-function for circle drawing
-*             It is based on Bressenhams circle algorithm, and adapted from 
-*             sample code given at http://en.wikipedia.org/wiki/Midpoint_circle_algorithm
-*/
-void PutCircle(uint16_t cx, uint16_t cy, uint16_t radius, uint16_t action)
-{
-   int16_t error = 0-radius;
-   int16_t x = radius;
-   int16_t y = 0;
-   
-   // The following while loop may altered to 'while (x > y)' for a
-   // performance benefit, as long as a call to 'plot4points' follows
-   // the body of the loop. This allows for the elimination of the
-   // '(x != y') test in 'plot8points', providing a further benefit.
-   //
-   // For the sake of clarity, this is not shown here.
-   while (x >= y)
-   {
-      plot8points(cx, cy, x, y, action);
-      
-      error += y;
-      ++y;
-      error += y;
-      
-      // The following test may be implemented in assembly language in
-      // most machines by testing the carry flag after adding 'y' to
-      // the value of 'error' in the previous step, since 'error'
-      // nominally has a negative value.
-      if (error >= 0)
-      {
-         --x;
-         error -= x;
-         error -= x;
-      }
-   }
-}
-
-/**
-*  @fn         PutBitmap
-*  @param[IN]  pointer to image data
-*  @param[IN]  action - selects plot action
-*     @arg     0 - clear
-*     @arg     1 - set
-*  @return     Number of pixels written in X direction
-*  @brief      Renders single character
-*/
-uint8_t PutBitmap(tImage* pImage, uint8_t action)
-{
-   
-   uint16_t n_fb;
-   uint16_t n_img;
-   uint16_t i_img;
-   uint16_t i_fb;
-   uint8_t* p_img = (uint8_t*)pImage->bitmap;
-    /* Return with pointer at next character location */
-   uint8_t* p_finish;
-   uint8_t mask;
-   uint16_t rows = pImage->height;
-
-   #ifdef TIMING_TEST
-   GPIO_ResetBits(LED_PORT, LED_PIN);
-   #endif
-
-   /* Work out how many frame buffer bytes we will be writing to */
-   n_fb = (GraphCtx.bit_pos + pImage->width +7) >> 3;
-   n_img = (pImage->width+7) >> 3;
-   p_finish = GraphCtx.pBuff + ((GraphCtx.bit_pos + pImage->width)>>3);
-
-   while(rows--)
-   {   
-      i_img = 0; i_fb = 0;
-      do
-      {
-         mask = 0;
-         if(i_fb != 0)
-         {
-            mask |= (p_img[i_img] << (8 - GraphCtx.bit_pos));  /* rightmost section of prev image byte */
-            i_img++;
-         }
- 
-         if(i_img < n_img)
-         {
-            mask |= p_img[i_img] >> GraphCtx.bit_pos;       /* leftmost section of image byte */
-         }       
-
-         if (action == GRAPH_SET) 
-            GraphCtx.pBuff[i_fb] |= mask;
-         else if (action == GRAPH_CLEAR)
-            GraphCtx.pBuff[i_fb] &= ~mask;
-   
-         i_fb++;
-
-      }
-      while(i_fb < n_fb);
-      p_img += n_img;                        /* next row in bit map      */
-      GraphCtx.pBuff += (NUM_X_PIXELS/8U);   /* next row in frame buffer */
-   }
-
-   GraphCtx.pBuff = p_finish;
-   GraphCtx.bit_pos = (GraphCtx.bit_pos + pImage->width) & 0x7;
-
-   #ifdef TIMING_TEST
-   GPIO_SetBits(LED_PORT, LED_PIN);
-   #endif
-
-   return pImage->width;
-}
-
-/**
-*  @fn         GotoXY
-*  @param[IN]  Xcoordinate
-*  @param[IN]  Ycoordinate
-*  @brief      Sets working location
-*/
-void GotoXY(uint16_t Xpos, uint16_t Ypos)
-{
-   GraphCtx.y_draw = Ypos;
-   GraphCtx.x_draw = Xpos;
-   GraphCtx.bit_pos = (uint8_t)(Xpos & 0x7);
-   GraphCtx.pBuff = &FrameBuff[Ypos][Xpos >> 3];
-}
-
-
-
-/*****************************************************************************/
-/**
-*  @fn        ClearScreen
-*  @brief     Clear frame buffer
-*/
-void ClearScreen(void)
-{
-   memset(FrameBuff, 0, sizeof(FrameBuff));
-}
-
-
-#pragma inline
-/*****************************************************************************/
-/**
-*  @fn        IsVblankActive
-*  @brief     Returns vertical blanking status
-*/
-uint8_t IsVblankActive(void)
-{
-   return vBlankActive;
-}
-
-#pragma no_inline
-
-/***** Local    functions  ****************************************/
-/**
-*  @fn        VblankCallback
-*  @param[IN] 1 for start of blanking interval, 0 for end
-*  @brief     Callback function for vertical blanking
-               Called at start and end of vertical blanking period
-*/
-static void VblankCallback(uint8_t event)
-{
-   vBlankActive = event;
-}
-
-
-
-/**
-*  @fn        PutHline
-*  @param[IN] x coordinate
-*  @param[IN] y coordinate
-*  @param[IN] length of line
-*  @param[IN] action, 1 = set, 0 = clear
-*  @brief     Draws horizontal line starting from specified point
-*/
-static void PutHline(uint16_t x, uint16_t y, uint16_t len, uint8_t action)
-{
-   /* To do a vertical line identify start byte then just keep filling the row */
-   uint16_t x_index = x >> 3U; 
-   uint16_t bit_pos = x & 7;
-   uint8_t  s_mask, e_mask;
-   uint8_t *pFrameBuff = &FrameBuff[y][x_index];
-
-   /* write non byte aligned pixels at start of line */
-   if(bit_pos > 0)
-   {
-      s_mask = 0xff >> bit_pos;
-      /* Special case for short lines */
-      if((bit_pos+len) < 8) 
-      {
-         s_mask &= 0xff << (8 - (bit_pos+len));
-         len = 0;
-      }
-      else
-      {
-         len -= (8 - bit_pos);
-      }
-
-      if (action == 1)
-         *pFrameBuff |= s_mask;
-      else if (action == 0)
-         *pFrameBuff &= ~s_mask;
-
-      pFrameBuff++;
-   }
-
-   while(len >= 8)
-   {
-      if(action == 1)
-         *pFrameBuff = 0xff;
-      else if (action == 0)
-         *pFrameBuff = 0;
-
-      len -= 8;
-      pFrameBuff++;
-   }
-
-   /* write non byte aligned pixels at end of line */
-   if (len > 0)
-   {
-//      pFrameBuff++;
-      e_mask = 0xff << (8 - len);
-      if(action == 1)
-         *pFrameBuff |= e_mask;
-      else if(action == 0)
-         *pFrameBuff &= ~e_mask;     
-   }
-}
-
-
-/**
-*  @fn        plot8points
-*  @param[IN] cx
-*  @param[IN] cy
-*  @param[IN] x
-*  @param[IN] y
-*  @param[IN] action, 1 = set, 0 = clear
-*  @brief     Sub-function for circle drawing
-*             Its is based on Bressenhams circle algorithm, and adapted from 
-*             sample code given at http://en.wikipedia.org/wiki/Midpoint_circle_algorithm
-*/
-static void plot8points(uint16_t cx, uint16_t cy, uint16_t x, uint16_t y, uint16_t action)
-{
-   plot4points(cx, cy, x, y, action);
-   if (x != y) 
-      plot4points(cx, cy, y, x, action);
-}
- 
-/**
-*  @fn        plot4points
-*  @param[IN] cx
-*  @param[IN] cy
-*  @param[IN] x
-*  @param[IN] y
-*  @param[IN] action, 1 = set, 0 = clear
-*  @brief     Sub-function for circle drawing
-*             Its is based on Bressenhams circle algorithm, and adapted from 
-*             sample code given at http://en.wikipedia.org/wiki/Midpoint_circle_algorithm
-*/
-static void plot4points(uint16_t cx, uint16_t cy, uint16_t x, uint16_t y, uint16_t action)
-{
-   // The '(x != 0 && y != 0)' test in the last line of this function
-   // may be omitted for a performance benefit if the radius of the
-   // circle is known to be non-zero.
-   PutPixel(cx + x, cy + y, action);
-   if (x != 0) 
-      PutPixel(cx - x, cy + y, action);
-   if (y != 0) 
-      PutPixel(cx + x, cy - y, action);
-   if (x != 0 && y != 0) 
-      PutPixel(cx - x, cy - y, action);
-}
-
-
-
-
-
-
-
-
-
+/**
+*  @file   Video.c
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  compositite video signal generator, for STM32
+*/
+
+/***** Include files  *********************************************/
+#include <stm32f10x.h>
+#include <string.h>
+#include "bsp.h"
+#include "Video.h"
+#include "Graphics.h"
+#include "Instrument.h"
+
+/***** Constants  *************************************************/
+#define TIMING_TEST
+
+/* Cohen-Sutherland outcodes */
+#define CLIP_LEFT          0x01U
+#define CLIP_RIGHT         0x02U
+#define CLIP_TOP           0x04U
+#define CLIP_BOTTOM        0x08U
+
+#define SIN_SCALE          16384L      /* SinTable values are sin * SIN_SCALE */
+
+#define EDGE_ONE           0x10000L    /* polygon edge x is 16.16 fixed point */
+#define EDGE_HALF          0x8000L
+
+/***** Types      *************************************************/
+/* Frame buffer rows are an odd number of bytes long, so bitmap rows are rarely
+   word aligned. The M3 handles unaligned LDR/STR, this stops the compiler
+   assuming alignment */
+typedef struct __attribute__((packed))
+{
+   uint32_t w;
+} tFbWord;
+
+#define FB_WORD(p)         (((tFbWord*)(p))->w)
+
+typedef struct
+{
+   int16_t y_top;          /* first row crossed            */
+   int16_t y_bottom;       /* row after last row crossed   */
+   int32_t x;              /* at centre of current row     */
+   int32_t dxdy;
+} tEdge;
+
+typedef struct
+{
+   int32_t cos_start;      /* direction of arc start and end, scaled by SIN_SCALE */
+   int32_t sin_start;
+   int32_t cos_end;
+   int32_t sin_end;
+   uint8_t reflex;         /* arc is more than 180 degrees */
+} tSector;
+
+/* Output of PutBitRunCtx, a row at a time */
+typedef struct
+{
+   uint8_t* p_row;         /* frame buffer byte at cursor     */
+   uint32_t acc;           /* pixels, left aligned            */
+   uint16_t i_byte;        /* byte to be written next         */
+   uint16_t i_first;       /* first and last visible bytes    */
+   uint16_t i_last;
+   uint8_t  n_acc;         /* pixels held in acc              */
+   uint8_t  s_mask;        /* visible pixels of first byte    */
+   uint8_t  e_mask;        /* visible pixels of last byte     */
+} tRun;
+
+/* Fill action as a byte operation, new = (old & keep) ^ put, where
+   keep = (~pattern & invert) | hold and put = pattern & solid */
+typedef struct
+{
+   uint8_t invert;
+   uint8_t hold;
+   uint8_t solid;
+} tFillOp;
+
+#ifdef GRAPH_SPRITE_CACHE
+typedef struct
+{
+   const tImage* pImage;
+   uint32_t* pShifted;     /* rows for alignment 0, then 1 ... 7, frame buffer byte order */
+   uint8_t built;          /* bit n set once alignment n has been shifted */
+} tSpriteCacheEntry;
+#endif
+
+/***** Storage    *************************************************/
+/* sin of 0 to 90 degrees */
+static const int16_t SinTable[91] = {
+       0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+    2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+    5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+    8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+   10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+   12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+   14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+   15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+   16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+   16384
+   };
+
+/* 8x8 Bayer ordered dither thresholds, pixel lit when threshold < level */
+static const uint8_t Bayer8[8][8] = {
+   { 0, 32,  8, 40,  2, 34, 10, 42},
+   {48, 16, 56, 24, 50, 18, 58, 26},
+   {12, 44,  4, 36, 14, 46,  6, 38},
+   {60, 28, 52, 20, 62, 30, 54, 22},
+   { 3, 35, 11, 43,  1, 33,  9, 41},
+   {51, 19, 59, 27, 49, 17, 57, 25},
+   {15, 47,  7, 39, 13, 45,  5, 37},
+   {63, 31, 55, 23, 61, 29, 53, 21}
+   };
+
+/* Indexed by action, GRAPH_CLEAR, GRAPH_SET, GRAPH_OR, GRAPH_XOR */
+static const tFillOp FillOps[4] = {
+      {0xFF, 0x00, 0x00}, {0x00, 0x00, 0xFF}, {0xFF, 0x00, 0xFF}, {0x00, 0xFF, 0xFF}
+      };
+
+static volatile uint8_t vBlankActive = 0;
+
+/* Target of the functions without a context, follows the draw buffer */
+static tGraphCtx ScreenCtx = {0, 0, 0, 0, GRAPH_CTX_SCREEN, {0, 0, 0xFFFFU, 0xFFFFU},
+                              0, 0, 0, 0, 0, {0}};
+
+#ifdef GRAPH_SPRITE_CACHE
+static uint32_t SpritePool[SPRITE_CACHE_BYTES / 4U];
+static tSpriteCacheEntry SpriteCache[SPRITE_CACHE_ENTRIES];
+static tSpriteCacheStats SpriteCacheStats;
+#endif
+
+
+/***** Local prototypes    ****************************************/
+static void VblankCallback(uint8_t event, uint8_t field);
+static __INLINE void plotByte(uint8_t* pFrameBuff, uint8_t mask, uint8_t action);
+static void plotPixel(tGraphCtx* pCtx, uint16_t x, uint16_t y, uint8_t action);
+static void syncScreen(tGraphCtx* pCtx);
+static void getClip(tGraphCtx* pCtx, tClipRect* p_clip);
+static __INLINE void markDirty(const tGraphCtx* pCtx, uint16_t y, uint16_t rows);
+static uint8_t isClipped(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const tClipRect* p_clip);
+static uint8_t outCode(int32_t x, int32_t y, const tClipRect* p_clip);
+static uint8_t clipLine(tGraphCtx* pCtx, uint16_t* p_x1, uint16_t* p_y1, uint16_t* p_x2, uint16_t* p_y2);
+static void PutHline(tGraphCtx* pCtx, uint16_t x, uint16_t y, uint16_t len, uint8_t action);
+static void putSpanClipped(tGraphCtx* pCtx, uint16_t x, uint16_t y, uint16_t len,
+                           uint8_t action, const uint8_t* p_pattern);
+static void fillRect(tGraphCtx* pCtx, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                     uint8_t action, const uint8_t* p_pattern);
+static __INLINE void fillByte(uint8_t* pFrameBuff, uint8_t keep, uint8_t put);
+static void fillBytes(uint8_t* pFrameBuff, uint16_t len, uint8_t keep, uint8_t put);
+static void plot8points(tGraphCtx* pCtx, uint16_t cx, uint16_t cy, uint16_t x, uint16_t y,
+                        uint16_t Action, void (*plot)(tGraphCtx*, uint16_t, uint16_t, uint8_t));
+static void plot4points(tGraphCtx* pCtx, uint16_t cx, uint16_t cy, uint16_t x, uint16_t y,
+                        uint16_t Action, void (*plot)(tGraphCtx*, uint16_t, uint16_t, uint8_t));
+static __INLINE uint32_t loadImageBits(const uint8_t* p_img, uint16_t n_img);
+static __INLINE void appendRun(tRun* p_run, uint32_t bits, uint8_t n_bits, uint8_t action);
+static __INLINE void flushRun(tRun* p_run, uint8_t action);
+static void putBitmapWords(const tGraphCtx* pCtx, const uint8_t* p_img, uint16_t n_img,
+                           uint8_t* p_fb, uint16_t rows, uint16_t n_words, uint8_t action);
+static void putBitmapBytes(tGraphCtx* pCtx, const tImage* pImage, const tClipRect* p_clip, uint8_t action);
+#ifdef GRAPH_SPRITE_CACHE
+static const uint32_t* getShiftedSprite(const tImage* pImage, uint8_t align);
+#endif
+static void fillConic(tGraphCtx* pCtx, uint16_t cx, uint16_t cy, uint16_t rx, uint16_t ry,
+                      const tSector* p_sector, uint8_t action);
+static void fillSectorRow(tGraphCtx* pCtx, int32_t cx, int32_t y, int32_t dy, int32_t half_width,
+                          const tSector* p_sector, uint8_t action);
+static void halfPlane(int32_t a, int32_t b, int32_t* p_lo, int32_t* p_hi);
+static void putSpan(tGraphCtx* pCtx, int32_t x1, int32_t x2, int32_t y, uint8_t action);
+static int32_t sinDeg(int16_t degrees);
+
+
+/***** Exported functions  ****************************************/
+/**
+*  @fn     graphicsInit
+*  @brief  Initialises graphics system
+*/
+void GraphicsInit(void)
+{
+   #ifdef INSTRUMENT
+   InstrInit();
+   #endif
+   VideoInit(VIDEO_RENDER_FRAME, VIDEO_STANDARD);
+   setVerticalBlankingCallback(VblankCallback);
+}
+
+/**
+*  @fn     GraphicsTick
+*  @brief  Called every tick for graphical object animation and update
+*/
+void GraphicsTick(void)
+{
+   static uint8_t committed = 0;
+
+   if(vBlankActive == 0)
+      committed = 0;
+   else if(committed == 0)
+   {
+      /* Carry out FrameBuffer updates, once at the start of each vertical blank */
+      committed = 1;
+      VideoCommitDirty();
+   }
+}
+
+/**
+*  @fn        GraphCtxInit
+*  @param[OUT] graphics context
+*  @param[IN] target buffer, top left pixel in MSB of first byte
+*  @param[IN] width, pixels
+*  @param[IN] height, pixels
+*  @param[IN] bytes from one row to the next, at least (width+7)/8
+*  @brief     Sets up context for drawing into an off-screen buffer, such
+*             as a RAM copy of a bitmap, with no clipping, solid fills and
+*             the cursor at the top left
+*/
+void GraphCtxInit(tGraphCtx* pCtx, uint8_t* pTarget, uint16_t width, uint16_t height, uint16_t stride)
+{
+   memset(pCtx, 0, sizeof(tGraphCtx));
+   pCtx->pTarget = pTarget;
+   pCtx->width = width;
+   pCtx->height = height;
+   pCtx->stride = stride;
+   pCtx->pBuff = pTarget;
+   ResetClipRectCtx(pCtx);
+}
+
+/**
+*  @fn        GraphGetScreen
+*  @return    context drawn into by the functions without a context argument
+*/
+tGraphCtx* GraphGetScreen(void)
+{
+   return &ScreenCtx;
+}
+
+
+/**
+*  @fn        PutPixelCtx
+*  @param[IN] graphics context
+*  @param[IN] x coordinate
+*  @param[IN] y coordinate
+*  @param[IN] action, 1 = set, 0 = clear, 2 = or, 3 = xor
+*  @brief     Sets pixel at specified location, if within clip rectangle
+*/
+void PutPixelCtx(tGraphCtx* pCtx, uint16_t x, uint16_t y, uint8_t action)
+{
+   tClipRect clip;
+
+   getClip(pCtx, &clip);
+   if((x >= clip.x1) && (x <= clip.x2) && (y >= clip.y1) && (y <= clip.y2))
+      plotPixel(pCtx, x, y, action);
+}
+
+/**
+*  @fn        SetClipRectCtx
+*  @param[IN] graphics context
+*  @param[IN] x coordinate, top left
+*  @param[IN] y coordinate, top left
+*  @param[IN] x coordinate, bottom right
+*  @param[IN] y coordinate, bottom right
+*  @brief     Restricts all drawing to rectangle, which is inclusive and
+*             further limited to the target
+*/
+void SetClipRectCtx(tGraphCtx* pCtx, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+   pCtx->clip.x1 = x1;
+   pCtx->clip.y1 = y1;
+   pCtx->clip.x2 = x2;
+   pCtx->clip.y2 = y2;
+}
+
+/**
+*  @fn        ResetClipRectCtx
+*  @param[IN] graphics context
+*  @brief     Allows drawing over the whole target, whatever its size
+*/
+void ResetClipRectCtx(tGraphCtx* pCtx)
+{
+   SetClipRectCtx(pCtx, 0, 0, 0xFFFFU, 0xFFFFU);
+}
+
+/**
+*  @fn        SetFillPatternCtx
+*  @param[IN] graphics context
+*  @param[IN] pointer to 8 pattern bytes, top row first, MSB leftmost, 0 for solid
+*  @brief     Sets the pattern used by the filled shapes, the pattern is copied
+*             and anchored to the screen so adjoining fills line up
+*/
+void SetFillPatternCtx(tGraphCtx* pCtx, const uint8_t* pPattern)
+{
+   if(pPattern == 0)
+   {
+      pCtx->pPattern = 0;
+      return;
+   }
+   memcpy(pCtx->pattern, pPattern, sizeof(pCtx->pattern));
+   pCtx->pPattern = pCtx->pattern;
+}
+
+/**
+*  @fn        SetFillDitherCtx
+*  @param[IN] graphics context
+*  @param[IN] grey level, 0 (clear) to GRAPH_DITHER_LEVELS-1 (solid)
+*  @brief     Sets an ordered dither fill pattern with level of 64 pixels lit
+*/
+void SetFillDitherCtx(tGraphCtx* pCtx, uint8_t level)
+{
+   uint8_t row, col;
+   uint8_t bits;
+
+   if(level >= (GRAPH_DITHER_LEVELS - 1U))
+   {
+      pCtx->pPattern = 0;
+      return;
+   }
+   for(row = 0; row < 8U; row++)
+   {
+      bits = 0;
+      for(col = 0; col < 8U; col++)
+      {
+         if(Bayer8[row][col] < level)
+            bits |= (0x80U >> col);
+      }
+      pCtx->pattern[row] = bits;
+   }
+   pCtx->pPattern = pCtx->pattern;
+}
+
+
+/**
+*  @fn        PutLineCtx
+*  @param[IN] graphics context
+*  @param[IN] x coordinate, 1st point
+*  @param[IN] y coordinate, 1st point
+*  @param[IN] x coordinate, 2nd point
+*  @param[IN] y coordinate, 2nd point
+*  @param[IN] action, 1 = set, 0 = clear, 2 = or, 3 = xor
+*  @brief     Draws line between specified points, clipped to the clip
+*             rectangle before drawing
+*/
+void PutLineCtx(tGraphCtx* pCtx, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t action)
+{
+   /* Bressenhans algorithm works by traversing the longest difference on a pixel
+    by pixel basis, using a roll over counter to determine when to increment the 
+    counter for the short difference
+   */
+   uint16_t rollcount;
+   uint16_t Xstep, Ystep;
+   uint16_t Xstart, Ystart;
+   int16_t inc = 1;
+   uint16_t count;
+   uint16_t stride;
+   uint8_t *pFrameBuff;
+   uint8_t bit, mask;
+   INSTR_START(INSTR_PUT_LINE);
+
+   if(clipLine(pCtx, &x1, &y1, &x2, &y2) == 0)
+   {
+      INSTR_STOP(INSTR_PUT_LINE);
+      return;
+   }
+   /* Screen context is sized to the video mode by clipLine() */
+   stride = pCtx->stride;
+   
+   /* Establish if we are going to have to decrement on rollover */
+   if(x2 > x1)
+   {
+      Xstep = x2 - x1;
+   }
+   else
+   {
+      Xstep = x1 - x2;
+      inc = 0 - inc;
+   }
+   if(y2 > y1)
+   {
+      Ystep = y2 - y1;
+   }
+   else
+   {
+      Ystep = y1 - y2;
+      inc = 0 - inc;
+   }
+
+   markDirty(pCtx, (y2 > y1) ? y1 : y2, Ystep + 1U);
+
+   if (Xstep > Ystep)
+   {
+      if (x2 > x1)
+         Xstart = x1;
+      else
+         Xstart = x2;
+
+      if(y2 > y1)
+      {
+         if(inc == -1)
+            Ystart = y2;
+         else
+            Ystart = y1;
+      }
+      else
+      {
+         if(inc == -1)
+            Ystart = y1;
+         else
+            Ystart = y2;
+      }
+      pFrameBuff = &pCtx->pTarget[(Ystart * stride) + (Xstart >> 3)];
+      bit = 0x80 >> (Xstart & 7);
+      mask = bit;                            // first pixel
+
+      // X increment larger, so traverse in X direction, collecting each
+      // run of pixels within a byte into a mask written in one go
+      rollcount = Xstep >> 1;
+      count = Xstep;
+      while(count--)
+      {
+         rollcount += Ystep;
+         if (rollcount >= Xstep)
+         {
+             rollcount -= Xstep;
+             plotByte(pFrameBuff, mask, action);
+             mask = 0;
+             if(inc > 0)
+                pFrameBuff += stride;
+             else
+                pFrameBuff -= stride;
+         }
+         bit >>= 1;
+         if(bit == 0)
+         {
+            if(mask != 0)
+               plotByte(pFrameBuff, mask, action);
+            mask = 0;
+            bit = 0x80;
+            pFrameBuff++;
+         }
+         mask |= bit;
+      }
+      plotByte(pFrameBuff, mask, action);
+   }
+   else
+   {
+      if (y2 > y1)
+         Ystart = y1;
+      else
+         Ystart = y2;
+
+      if(x2 > x1)
+      {
+         if(inc == -1)
+            Xstart = x2;
+         else
+            Xstart = x1;
+      }
+      else
+      {
+         if(inc == -1)
+            Xstart = x1;
+         else
+            Xstart = x2;
+      }
+
+      pFrameBuff = &pCtx->pTarget[(Ystart * stride) + (Xstart >> 3)];
+      bit = 0x80 >> (Xstart & 7);
+      plotByte(pFrameBuff, bit, action);     // draw the first pixel on its own
+
+      // Y increment larger, so traverse in Y direction stepping by row stride
+      rollcount = Ystep >> 1;
+      count = Ystep;
+      while(count--)
+      {
+         rollcount += Xstep;
+         if (rollcount >= Ystep)
+         {
+             rollcount -= Ystep;
+             if(inc > 0)
+             {
+                bit >>= 1;
+                if(bit == 0)
+                {
+                   bit = 0x80;
+                   pFrameBuff++;
+                }
+             }
+             else
+             {
+                bit <<= 1;
+                if(bit == 0)
+                {
+                   bit = 0x01;
+                   pFrameBuff--;
+                }
+             }
+         }
+         pFrameBuff += stride;
+         plotByte(pFrameBuff, bit, action);
+      }
+   }
+   INSTR_STOP(INSTR_PUT_LINE);
+}
+
+/**
+*  @fn        PutVlineCtx
+*  @param[IN] graphics context
+*  @param[IN] x coordinate
+*  @param[IN] y coordinate
+*  @param[IN] length of line
+*  @param[IN] action, 1 = set, 0 = clear, 2 = or, 3 = xor
+*  @brief     Draws vertical line starting from specified point
+*/
+void PutVlineCtx(tGraphCtx* pCtx, uint16_t x, uint16_t y, uint16_t len, uint8_t action)
+{
+   /* To do a vertical line just work identify start byte then increment by row stride each time */
+   uint16_t x_index = x >> 3U; 
+   uint16_t bit_pos = x & 7;
+   uint8_t  mask = (0x80 >> bit_pos);
+   uint8_t *pFrameBuff;
+   uint32_t y_end = (uint32_t)y + len;    /* exclusive */
+   tClipRect clip;
+
+   getClip(pCtx, &clip);
+   if((x < clip.x1) || (x > clip.x2))
+      return;
+   if(y < clip.y1)
+      y = clip.y1;
+   if(y_end > (clip.y2 + 1U))
+      y_end = clip.y2 + 1U;
+   if(y_end <= y)
+      return;
+   len = (uint16_t)(y_end - y);
+
+   pFrameBuff = &pCtx->pTarget[(y * pCtx->stride) + x_index];
+   markDirty(pCtx, y, len);
+
+   while(len-- > 0)
+   {
+      plotByte(pFrameBuff, mask, action);
+      pFrameBuff += pCtx->stride;
+   }
+
+}
+
+
+
+/**
+*  @fn        PutRectangleCtx
+*  @param[IN] graphics context
+*  @param[IN] x coordinate, 1st point
+*  @param[IN] y coordinate, 1st point
+*  @param[IN] x coordinate, 2nd point
+*  @param[IN] y coordinate, 2nd point
+*  @param[IN] action, 1 = set, 0 = clear, 2 = or, 3 = xor
+*  @brief     Draws rectangle between specified points
+*/
+void PutRectangleCtx(tGraphCtx* pCtx, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t action)
+{
+   PutHline(pCtx, x1, y1, x2-x1+1, action);     /* top            */
+   if(y2 > (y1+1))
+   {
+      PutVlineCtx(pCtx, x1, y1+1, y2-y1-1, action);   /* left side      */
+      if(x2 != x1)
+         PutVlineCtx(pCtx, x2, y1+1, y2-y1-1, action);   /* right side     */
+   }
+   if(y2 != y1)
+      PutHline(pCtx, x1, y2,  x2-x1+1, action);    /* bottom         */
+}
+
+/**
+*  @fn        FillRectangleCtx
+*  @param[IN] graphics context
+*  @param[IN] x coordinate, 1st point
+*  @param[IN] y coordinate, 1st point
+*  @param[IN] x coordinate, 2nd point
+*  @param[IN] y coordinate, 2nd point
+*  @param[IN] action, 1 = set, 0 = clear, 2 = or, 3 = xor
+*  @brief     Fills rectangle between specified points, clipped once, with
+*             the current fill pattern
+*/
+void FillRectangleCtx(tGraphCtx* pCtx, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t action)
+{
+   tClipRect clip;
+   INSTR_START(INSTR_FILL_RECT);
+
+   getClip(pCtx, &clip);
+   if(x1 < clip.x1)
+      x1 = clip.x1;
+   if(y1 < clip.y1)
+      y1 = clip.y1;
+   if(x2 > clip.x2)
+      x2 = clip.x2;
+   if(y2 > clip.y2)
+      y2 = clip.y2;
+
+   if((x1 <= x2) && (y1 <= y2))
+      fillRect(pCtx, x1, y1, x2, y2, action, pCtx->pPattern);
+   INSTR_STOP(INSTR_FILL_RECT);
+}
+
+/*****************************************************************************/
+/**
+*  @fn        PutCircleCtx
+*  @param[IN] graphics context
+*  @param[IN] cx  - centre coordinate
+*  @param[IN] cy  - centre coordinate
+*  @param[IN] radius
+*  @param[IN] action, 1 = set, 0 = clear, 2 = or, 3 = xor
+*  @brief     Draws circle outline, pixels are clipped only if the circle
+*             crosses the clip rectangle
+*             It is based on Bressenhams circle algorithm, and adapted from 
+*             sample code given at http://en.wikipedia.org/wiki/Midpoint_circle_algorithm
+*/
+void PutCircleCtx(tGraphCtx* pCtx, uint16_t cx, uint16_t cy, uint16_t radius, uint16_t action)
+{
+   int16_t error = 0-radius;
+   int16_t x = radius;
+   int16_t y = 0;
+   tClipRect clip;
+   void (*plot)(tGraphCtx*, uint16_t, uint16_t, uint8_t) = PutPixelCtx;
+
+   /* Clip once, pixels only need checking if circle crosses clip rectangle */
+   getClip(pCtx, &clip);
+   if(((int32_t)cx - radius > clip.x2) || ((int32_t)cx + radius < clip.x1) ||
+      ((int32_t)cy - radius > clip.y2) || ((int32_t)cy + radius < clip.y1))
+      return;
+   if(((int32_t)cx - radius >= clip.x1) && ((int32_t)cx + radius <= clip.x2) &&
+      ((int32_t)cy - radius >= clip.y1) && ((int32_t)cy + radius <= clip.y2))
+      plot = plotPixel;
+   
+   // The following while loop may altered to 'while (x > y)' for a
+   // performance benefit, as long as a call to 'plot4points' follows
+   // the body of the loop. This allows for the elimination of the
+   // '(x != y') test in 'plot8points', providing a further benefit.
+   //
+   // For the sake of clarity, this is not shown here.
+   while (x >= y)
+   {
+      plot8points(pCtx, cx, cy, x, y, action, plot);
+      
+      error += y;
+      ++y;
+      error += y;
+      
+      // The following test may be implemented in assembly language in
+      // most machines by testing the carry flag after adding 'y' to
+      // the value of 'error' in the previous step, since 'error'
+      // nominally has a negative value.
+      if (error >= 0)
+      {
+         --x;
+         error -= x;
+         error -= x;
+      }
+   }
+}
+
+/**
+*  @fn        FillCircleCtx
+*  @param[IN] graphics context
+*  @param[IN] cx  - centre coordinate
+*  @param[IN] cy  - centre coordinate
+*  @param[IN] radius, up to GRAPH_MAX_RADIUS
+*  @param[IN] action, 1 = set, 0 = clear, 2 = or, 3 = xor
+*  @brief     Draws filled circle as one horizontal span per row
+*/
+void FillCircleCtx(tGraphCtx* pCtx, uint16_t cx, uint16_t cy, uint16_t radius, uint8_t action)
+{
+   fillConic(pCtx, cx, cy, radius, radius, 0, action);
+}
+
+/**
+*  @fn        FillEllipseCtx
+*  @param[IN] graphics context
+*  @param[IN] cx  - centre coordinate
+*  @param[IN] cy  - centre coordinate
+*  @param[IN] horizontal radius, up to GRAPH_MAX_RADIUS
+*  @param[IN] vertical radius, up to GRAPH_MAX_RADIUS
+*  @param[IN] action, 1 = set, 0 = clear, 2 = or, 3 = xor
+*  @brief     Draws filled ellipse as one horizontal span per row
+*/
+void FillEllipseCtx(tGraphCtx* pCtx, uint16_t cx, uint16_t cy, uint16_t rx, uint16_t ry, uint8_t action)
+{
+   fillConic(pCtx, cx, cy, rx, ry, 0, action);
+}
+
+/**
+*  @fn        FillArcCtx
+*  @param[IN] graphics context
+*  @param[IN] cx  - centre coordinate
+*  @param[IN] cy  - centre coordinate
+*  @param[IN] radius, up to GRAPH_MAX_RADIUS
+*  @param[IN] start angle, degrees anticlockwise from 3 o'clock
+*  @param[IN] end angle, degrees anticlockwise from 3 o'clock
+*  @param[IN] action, 1 = set, 0 = clear, 2 = or, 3 = xor
+*  @brief     Draws filled sector of circle, anticlockwise from start to
+*             end angle, as at most two horizontal spans per row.
+*             Equal angles draw the whole circle
+*/
+void FillArcCtx(tGraphCtx* pCtx, uint16_t cx, uint16_t cy, uint16_t radius, uint16_t start, uint16_t end, uint8_t action)
+{
+   tSector sector;
+
+   start %= 360U;
+   end %= 360U;
+   if(start == end)
+   {
+      fillConic(pCtx, cx, cy, radius, radius, 0, action);
+      return;
+   }
+
+   sector.cos_start = sinDeg((int16_t)start + 90);
+   sector.sin_start = sinDeg((int16_t)start);
+   sector.cos_end = sinDeg((int16_t)end + 90);
+   sector.sin_end = sinDeg((int16_t)end);
+   sector.reflex = (uint8_t)(((end + 360U - start) % 360U) > 180U);
+   fillConic(pCtx, cx, cy, radius, radius, &sector, action);
+}
+
+/**
+*  @fn        FillPolygonCtx
+*  @param[IN] graphics context
+*  @param[IN] pointer to vertices, each within +/-GRAPH_MAX_COORD
+*  @param[IN] number of vertices, 3 to GRAPH_MAX_POLY_POINTS
+*  @param[IN] action, 1 = set, 0 = clear, 2 = or, 3 = xor
+*  @brief     Fills convex or concave polygon using the even-odd rule.
+*             Pixels are filled if their centre lies inside, so polygons
+*             sharing an edge neither overlap nor leave a gap
+*/
+void FillPolygonCtx(tGraphCtx* pCtx, const tPoint* pPoints, uint8_t n_points, uint8_t action)
+{
+   tEdge edges[GRAPH_MAX_POLY_POINTS];
+   tEdge edge;
+   tEdge* p_edge;
+   uint8_t active[GRAPH_MAX_POLY_POINTS];
+   int32_t x_cross[GRAPH_MAX_POLY_POINTS];
+   uint8_t n_edges = 0;
+   uint8_t n_active = 0;
+   uint8_t n_cross;
+   uint8_t next = 0;
+   uint8_t i, j;
+   const tPoint* p0;
+   const tPoint* p1;
+   int32_t y;
+   int32_t y_end = 0;
+   tClipRect clip;
+
+   if((n_points < 3U) || (n_points > GRAPH_MAX_POLY_POINTS))
+      return;
+
+   /* Edge table sorted by top row, horizontal edges never cross a row centre */
+   for(i = 0; i < n_points; i++)
+   {
+      p0 = &pPoints[i];
+      p1 = &pPoints[(i + 1U) % n_points];
+      if((p0->x > GRAPH_MAX_COORD) || (p0->x < -GRAPH_MAX_COORD) ||
+         (p0->y > GRAPH_MAX_COORD) || (p0->y < -GRAPH_MAX_COORD))
+         return;
+      if(p0->y == p1->y)
+         continue;
+      if(p0->y > p1->y)
+      {
+         p0 = p1;
+         p1 = &pPoints[i];
+      }
+      edge.y_top = p0->y;
+      edge.y_bottom = p1->y;
+      edge.dxdy = ((int32_t)(p1->x - p0->x) * EDGE_ONE) / (p1->y - p0->y);
+      edge.x = ((int32_t)p0->x * EDGE_ONE) + (edge.dxdy / 2);
+      if(edge.y_bottom > y_end)
+         y_end = edge.y_bottom;
+
+      for(j = n_edges; (j > 0) && (edges[j - 1U].y_top > edge.y_top); j--)
+         edges[j] = edges[j - 1U];
+      edges[j] = edge;
+      n_edges++;
+   }
+   if(n_edges == 0)
+      return;
+
+   getClip(pCtx, &clip);
+   y = edges[0].y_top;
+   if(y < clip.y1)
+      y = clip.y1;
+   if(y_end > ((int32_t)clip.y2 + 1))
+      y_end = (int32_t)clip.y2 + 1;
+
+   for(; y < y_end; y++)
+   {
+      /* Add edges reaching this row to active edge list, moving any that
+         started above the clip rectangle down to this row */
+      for(; (next < n_edges) && (edges[next].y_top <= y); next++)
+      {
+         if(edges[next].y_bottom > y)
+         {
+            edges[next].x += edges[next].dxdy * (y - edges[next].y_top);
+            active[n_active++] = next;
+         }
+      }
+
+      /* Sorted crossings of row centre, dropping finished edges */
+      n_cross = 0;
+      for(i = 0; i < n_active; )
+      {
+         p_edge = &edges[active[i]];
+         if(p_edge->y_bottom <= y)
+         {
+            active[i] = active[--n_active];
+            continue;
+         }
+         for(j = n_cross; (j > 0) && (x_cross[j - 1U] > p_edge->x); j--)
+            x_cross[j] = x_cross[j - 1U];
+         x_cross[j] = p_edge->x;
+         n_cross++;
+         p_edge->x += p_edge->dxdy;
+         i++;
+      }
+
+      /* Fill pixels whose centres lie between pairs of crossings */
+      for(i = 1; i < n_cross; i += 2)
+         putSpan(pCtx, (x_cross[i - 1U] + EDGE_HALF - 1) >> 16,
+                 ((x_cross[i] + EDGE_HALF - 1) >> 16) - 1, y, action);
+   }
+}
+
+/**
+*  @fn        FillTriangleCtx
+*  @param[IN] graphics context
+*  @param[IN] x coordinate, 1st point
+*  @param[IN] y coordinate, 1st point
+*  @param[IN] x coordinate, 2nd point
+*  @param[IN] y coordinate, 2nd point
+*  @param[IN] x coordinate, 3rd point
+*  @param[IN] y coordinate, 3rd point
+*  @param[IN] action, 1 = set, 0 = clear, 2 = or, 3 = xor
+*  @brief     Fills triangle
+*/
+void FillTriangleCtx(tGraphCtx* pCtx, int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t x3, int16_t y3, uint8_t action)
+{
+   tPoint points[3];
+
+   points[0].x = x1;
+   points[0].y = y1;
+   points[1].x = x2;
+   points[1].y = y2;
+   points[2].x = x3;
+   points[2].y = y3;
+   FillPolygonCtx(pCtx, points, 3, action);
+}
+
+/**
+*  @fn         PutBitmapCtx
+*  @param[IN]  graphics context
+*  @param[IN]  pointer to image data
+*  @param[IN]  action - selects plot action
+*     @arg     0 - clear
+*     @arg     1 - set
+*     @arg     2 - or
+*     @arg     3 - xor
+*  @return     Number of pixels written in X direction
+*  @brief      Renders image a 32 bit word per row, images up to 24 pixels wide
+*              take one read-modify-write per row at any alignment
+*/
+uint8_t PutBitmapCtx(tGraphCtx* pCtx, tImage* pImage, uint8_t action)
+{
+   const uint8_t* p_img = pImage->bitmap;
+   uint8_t* p_fb = pCtx->pBuff;
+   uint16_t stride = pCtx->stride;
+   uint16_t rows = pImage->height;
+   uint16_t n_img = (pImage->width + 7U) >> 3;
+   uint16_t n_words = (pCtx->bit_pos + pImage->width + 31U) >> 5;
+   uint8_t shift = pCtx->bit_pos;
+   uint32_t mask;
+   tClipRect clip;
+   INSTR_START(INSTR_PUT_BITMAP);
+
+   #ifdef TIMING_TEST
+   GPIO_ResetBits(LED_PORT, LED_PIN);
+   #endif
+
+   getClip(pCtx, &clip);
+   if((isClipped(pCtx->x_draw, pCtx->y_draw, pImage->width, rows, &clip) != 0) ||
+      ((p_fb + ((rows - 1U) * stride) + (n_words << 2)) > &pCtx->pTarget[pCtx->height * pCtx->stride]))
+   {
+      /* Not wholly within clip rectangle, or last row would read past end of buffer */
+      putBitmapBytes(pCtx, pImage, &clip, action);
+   }
+   else if(n_words == 1U)
+   {
+      markDirty(pCtx, pCtx->y_draw, rows);
+      /* Action resolved once, each loop is a single read-modify-write per row */
+      switch(action)
+      {
+         case GRAPH_CLEAR:
+            for(; rows != 0; rows--, p_img += n_img, p_fb += stride)
+            {
+               mask = __REV(loadImageBits(p_img, n_img) >> shift);
+               FB_WORD(p_fb) &= ~mask;
+            }
+            break;
+
+         case GRAPH_SET:
+         case GRAPH_OR:
+            for(; rows != 0; rows--, p_img += n_img, p_fb += stride)
+            {
+               mask = __REV(loadImageBits(p_img, n_img) >> shift);
+               FB_WORD(p_fb) |= mask;
+            }
+            break;
+
+         case GRAPH_XOR:
+            for(; rows != 0; rows--, p_img += n_img, p_fb += stride)
+            {
+               mask = __REV(loadImageBits(p_img, n_img) >> shift);
+               FB_WORD(p_fb) ^= mask;
+            }
+            break;
+
+         default:
+            break;
+      }
+   }
+   else
+   {
+      markDirty(pCtx, pCtx->y_draw, rows);
+      putBitmapWords(pCtx, p_img, n_img, p_fb, rows, n_words, action);
+   }
+
+   /* Return with pointer at next character location */
+   pCtx->pBuff += (pCtx->bit_pos + pImage->width) >> 3;
+   pCtx->bit_pos = (pCtx->bit_pos + pImage->width) & 0x7;
+   pCtx->x_draw += pImage->width;
+
+   #ifdef TIMING_TEST
+   GPIO_SetBits(LED_PORT, LED_PIN);
+   #endif
+
+   INSTR_STOP(INSTR_PUT_BITMAP);
+   return pImage->width;
+}
+
+#ifdef GRAPH_SPRITE_CACHE
+/**
+*  @fn         PutSpriteCtx
+*  @param[IN]  graphics context
+*  @param[IN]  pointer to image, must be const as copies are kept by address
+*  @param[IN]  action - selects plot action, as PutBitmap
+*  @return     Number of pixels written in X direction
+*  @brief      Renders image from a pre-shifted copy, shifted on first use
+*              at each alignment. Falls back to PutBitmap if sprite is too
+*              wide or cache is full
+*/
+uint8_t PutSpriteCtx(tGraphCtx* pCtx, const tImage* pImage, uint8_t action)
+{
+   const uint32_t* p_shifted = 0;
+   uint8_t* p_fb = pCtx->pBuff;
+   uint16_t stride = pCtx->stride;
+   uint16_t rows = pImage->height;
+   tClipRect clip;
+   INSTR_START(INSTR_PUT_BITMAP);
+
+   /* Must be wholly within clip rectangle, and word access of last row
+      must not run past end of buffer */
+   getClip(pCtx, &clip);
+   if((isClipped(pCtx->x_draw, pCtx->y_draw, pImage->width, rows, &clip) == 0) &&
+      ((p_fb + ((rows - 1U) * stride) + 4U) <= &pCtx->pTarget[pCtx->height * pCtx->stride]))
+      p_shifted = getShiftedSprite(pImage, pCtx->bit_pos);
+
+   if(p_shifted == 0)
+      return PutBitmapCtx(pCtx, (tImage*)pImage, action);
+
+   markDirty(pCtx, pCtx->y_draw, rows);
+
+   switch(action)
+   {
+      case GRAPH_CLEAR:
+         for(; rows != 0; rows--, p_fb += stride)
+            FB_WORD(p_fb) &= ~(*p_shifted++);
+         break;
+
+      case GRAPH_SET:
+      case GRAPH_OR:
+         for(; rows != 0; rows--, p_fb += stride)
+            FB_WORD(p_fb) |= *p_shifted++;
+         break;
+
+      case GRAPH_XOR:
+         for(; rows != 0; rows--, p_fb += stride)
+            FB_WORD(p_fb) ^= *p_shifted++;
+         break;
+
+      default:
+         break;
+   }
+
+   /* Return with pointer at next character location */
+   pCtx->pBuff += (pCtx->bit_pos + pImage->width) >> 3;
+   pCtx->bit_pos = (pCtx->bit_pos + pImage->width) & 0x7;
+   pCtx->x_draw += pImage->width;
+
+   INSTR_STOP(INSTR_PUT_BITMAP);
+   return pImage->width;
+}
+
+/**
+*  @fn         SpriteCacheFlush
+*  @brief      Discards all shifted sprites and clears the counters,
+*              eg. if sprite data has changed
+*/
+void SpriteCacheFlush(void)
+{
+   memset(SpriteCache, 0, sizeof(SpriteCache));
+   memset(&SpriteCacheStats, 0, sizeof(SpriteCacheStats));
+}
+
+/**
+*  @fn         SpriteCacheGetStats
+*  @param[OUT] cache hit and miss counts and space used
+*/
+void SpriteCacheGetStats(tSpriteCacheStats* pStats)
+{
+   *pStats = SpriteCacheStats;
+}
+#endif
+
+/**
+*  @fn         PutGlyphRunCtx
+*  @param[IN]  graphics context
+*  @param[IN]  pointers to images, drawn left to right from the cursor
+*  @param[IN]  number of images
+*  @param[IN]  action - selects plot action, as PutBitmap
+*  @return     Number of pixels written in X direction
+*  @brief      Renders a run of images, eg. the glyphs of a string, with
+*              PutBitRunCtx, GRAPH_RUN_LEN images at a time
+*/
+uint16_t PutGlyphRunCtx(tGraphCtx* pCtx, const tImage* const* pGlyphs, uint8_t n_glyphs, uint8_t action)
+{
+   tBitImage run[GRAPH_RUN_LEN];
+   uint16_t width = 0;
+   uint8_t  n;
+   uint8_t  i;
+
+   while(n_glyphs != 0)
+   {
+      n = (n_glyphs > GRAPH_RUN_LEN) ? GRAPH_RUN_LEN : n_glyphs;
+      for(i = 0; i < n; i++)
+      {
+         run[i].bits = pGlyphs[i]->bitmap;
+         run[i].offset = 0;
+         run[i].pitch = (pGlyphs[i]->width + 7U) & ~7U;
+         run[i].width = pGlyphs[i]->width;
+         run[i].height = pGlyphs[i]->height;
+      }
+      width += PutBitRunCtx(pCtx, run, n, action);
+      pGlyphs += n;
+      n_glyphs -= n;
+   }
+   return width;
+}
+
+/**
+*  @fn         PutBitRunCtx
+*  @param[IN]  graphics context
+*  @param[IN]  images, drawn left to right from the cursor
+*  @param[IN]  number of images
+*  @param[IN]  action - selects plot action, as PutBitmap
+*  @return     Number of pixels written in X direction
+*  @brief      Renders a run of images a row at a time. The images of each
+*              row are shifted through a 32 bit register and written out a
+*              byte at a time, so every frame buffer byte is written once.
+*              Rows and bytes outside the clip rectangle are skipped
+*/
+uint16_t PutBitRunCtx(tGraphCtx* pCtx, const tBitImage* pImages, uint8_t n_images, uint8_t action)
+{
+   uint16_t width = 0;
+   uint16_t rows = 0;
+   uint32_t x2, y1, y2;
+   uint32_t row;
+   uint32_t index;
+   uint16_t left;
+   uint8_t  n_bits;
+   uint8_t  shift;
+   uint8_t  i;
+   uint32_t bits;
+   const uint8_t* p_bits;
+   tRun run;
+   tClipRect clip;
+
+   for(i = 0; i < n_images; i++)
+   {
+      width += pImages[i].width;
+      if(pImages[i].height > rows)
+         rows = pImages[i].height;
+   }
+
+   /* Visible part of run */
+   getClip(pCtx, &clip);
+   x2 = (uint32_t)pCtx->x_draw + width - 1U;
+   y1 = pCtx->y_draw;
+   y2 = y1 + rows - 1U;
+   if(y1 < clip.y1)
+      y1 = clip.y1;
+   if(y2 > clip.y2)
+      y2 = clip.y2;
+   run.i_first = (pCtx->x_draw < clip.x1) ? (clip.x1 >> 3) : (pCtx->x_draw >> 3);
+   run.s_mask = (pCtx->x_draw < clip.x1) ? (0xFF >> (clip.x1 & 7U)) : 0xFF;
+   if(x2 > clip.x2)
+      x2 = clip.x2;
+   run.i_last = (uint16_t)(x2 >> 3);
+   run.e_mask = 0xFF << (7U - (x2 & 7U));
+   run.i_first -= pCtx->x_draw >> 3;
+   run.i_last -= pCtx->x_draw >> 3;
+
+   if((width != 0) && (rows != 0) && (y1 <= y2) &&
+      (x2 >= pCtx->x_draw) && (x2 >= clip.x1))
+   {
+      markDirty(pCtx, (uint16_t)y1, (uint16_t)(y2 - y1 + 1U));
+      run.p_row = pCtx->pBuff + ((y1 - pCtx->y_draw) * pCtx->stride);
+      for(row = y1 - pCtx->y_draw; row <= (y2 - pCtx->y_draw); row++, run.p_row += pCtx->stride)
+      {
+         /* Accumulator holds n_acc pixels left aligned, starting at cursor bit */
+         run.acc = 0;
+         run.n_acc = pCtx->bit_pos;
+         run.i_byte = 0;
+         for(i = 0; i < n_images; i++)
+         {
+            left = pImages[i].width;
+            if(row >= pImages[i].height)
+            {
+               /* Shorter image, blank row */
+               for(; left != 0; left -= n_bits)
+               {
+                  n_bits = (left > 24U) ? 24U : (uint8_t)left;
+                  appendRun(&run, 0, n_bits, action);
+               }
+               continue;
+            }
+
+            /* Up to 24 pixels at a time, so they fit beside a part byte */
+            index = pImages[i].offset + (row * pImages[i].pitch);
+            p_bits = &pImages[i].bits[index >> 3];
+            shift = (uint8_t)(index & 7U);
+            for(; left != 0; left -= n_bits, p_bits += 3)
+            {
+               n_bits = (left > 24U) ? 24U : (uint8_t)left;
+               bits = loadImageBits(p_bits, (shift + n_bits + 7U) >> 3) << shift;
+               appendRun(&run, bits & ~(0xFFFFFFFFUL >> n_bits), n_bits, action);
+            }
+         }
+         if(run.n_acc != 0)
+            flushRun(&run, action);
+      }
+   }
+
+   /* Return with pointer at next character location */
+   pCtx->pBuff += (pCtx->bit_pos + width) >> 3;
+   pCtx->bit_pos = (pCtx->bit_pos + width) & 0x7;
+   pCtx->x_draw += width;
+
+   return width;
+}
+
+
+/**
+*  @fn         GotoXYCtx
+*  @param[IN]  graphics context
+*  @param[IN]  Xcoordinate
+*  @param[IN]  Ycoordinate
+*  @brief      Sets working location
+*/
+void GotoXYCtx(tGraphCtx* pCtx, uint16_t Xpos, uint16_t Ypos)
+{
+   syncScreen(pCtx);
+   pCtx->y_draw = Ypos;
+   pCtx->x_draw = Xpos;
+   pCtx->bit_pos = (uint8_t)(Xpos & 0x7);
+   pCtx->pBuff = &pCtx->pTarget[(Ypos * pCtx->stride) + (Xpos >> 3)];
+}
+
+
+
+/*****************************************************************************/
+/**
+*  @fn        ClearScreen
+*  @brief     Clear frame buffer being drawn into
+*/
+void ClearScreen(void)
+{
+   INSTR_START(INSTR_CLEAR_SCREEN);
+   memset(pDrawBuff, 0, sizeof(FrameBuff));
+   VideoMarkDirty(0, pVideoMode->height);
+   INSTR_STOP(INSTR_CLEAR_SCREEN);
+}
+
+
+#pragma inline
+/*****************************************************************************/
+/**
+*  @fn        IsVblankActive
+*  @brief     Returns vertical blanking status
+*/
+uint8_t IsVblankActive(void)
+{
+   return vBlankActive;
+}
+
+#pragma no_inline
+
+/***** Screen context wrappers ************************************/
+/**
+*  @fn        PutPixel
+*  @brief     PutPixelCtx() on the screen
+*/
+void PutPixel(uint16_t x, uint16_t y, uint8_t action)
+{
+   PutPixelCtx(&ScreenCtx, x, y, action);
+}
+
+/**
+*  @fn        SetClipRect
+*  @brief     SetClipRectCtx() on the screen
+*/
+void SetClipRect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+   SetClipRectCtx(&ScreenCtx, x1, y1, x2, y2);
+}
+
+/**
+*  @fn        ResetClipRect
+*  @brief     ResetClipRectCtx() on the screen
+*/
+void ResetClipRect(void)
+{
+   ResetClipRectCtx(&ScreenCtx);
+}
+
+/**
+*  @fn        SetFillPattern
+*  @brief     SetFillPatternCtx() on the screen
+*/
+void SetFillPattern(const uint8_t* pPattern)
+{
+   SetFillPatternCtx(&ScreenCtx, pPattern);
+}
+
+/**
+*  @fn        SetFillDither
+*  @brief     SetFillDitherCtx() on the screen
+*/
+void SetFillDither(uint8_t level)
+{
+   SetFillDitherCtx(&ScreenCtx, level);
+}
+
+/**
+*  @fn        PutLine
+*  @brief     PutLineCtx() on the screen
+*/
+void PutLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t action)
+{
+   PutLineCtx(&ScreenCtx, x1, y1, x2, y2, action);
+}
+
+/**
+*  @fn        PutVline
+*  @brief     PutVlineCtx() on the screen
+*/
+void PutVline(uint16_t x, uint16_t y, uint16_t len, uint8_t action)
+{
+   PutVlineCtx(&ScreenCtx, x, y, len, action);
+}
+
+/**
+*  @fn        PutRectangle
+*  @brief     PutRectangleCtx() on the screen
+*/
+void PutRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t action)
+{
+   PutRectangleCtx(&ScreenCtx, x1, y1, x2, y2, action);
+}
+
+/**
+*  @fn        FillRectangle
+*  @brief     FillRectangleCtx() on the screen
+*/
+void FillRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t action)
+{
+   FillRectangleCtx(&ScreenCtx, x1, y1, x2, y2, action);
+}
+
+/**
+*  @fn        PutCircle
+*  @brief     PutCircleCtx() on the screen
+*/
+void PutCircle(uint16_t cx, uint16_t cy, uint16_t radius, uint16_t action)
+{
+   PutCircleCtx(&ScreenCtx, cx, cy, radius, action);
+}
+
+/**
+*  @fn        FillCircle
+*  @brief     FillCircleCtx() on the screen
+*/
+void FillCircle(uint16_t cx, uint16_t cy, uint16_t radius, uint8_t action)
+{
+   FillCircleCtx(&ScreenCtx, cx, cy, radius, action);
+}
+
+/**
+*  @fn        FillEllipse
+*  @brief     FillEllipseCtx() on the screen
+*/
+void FillEllipse(uint16_t cx, uint16_t cy, uint16_t rx, uint16_t ry, uint8_t action)
+{
+   FillEllipseCtx(&ScreenCtx, cx, cy, rx, ry, action);
+}
+
+/**
+*  @fn        FillArc
+*  @brief     FillArcCtx() on the screen
+*/
+void FillArc(uint16_t cx, uint16_t cy, uint16_t radius, uint16_t start, uint16_t end, uint8_t action)
+{
+   FillArcCtx(&ScreenCtx, cx, cy, radius, start, end, action);
+}
+
+/**
+*  @fn        FillPolygon
+*  @brief     FillPolygonCtx() on the screen
+*/
+void FillPolygon(const tPoint* pPoints, uint8_t n_points, uint8_t action)
+{
+   FillPolygonCtx(&ScreenCtx, pPoints, n_points, action);
+}
+
+/**
+*  @fn        FillTriangle
+*  @brief     FillTriangleCtx() on the screen
+*/
+void FillTriangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t x3, int16_t y3, uint8_t action)
+{
+   FillTriangleCtx(&ScreenCtx, x1, y1, x2, y2, x3, y3, action);
+}
+
+/**
+*  @fn        PutBitmap
+*  @brief     PutBitmapCtx() at the screen cursor
+*/
+uint8_t PutBitmap(tImage* pImage, uint8_t action)
+{
+   return PutBitmapCtx(&ScreenCtx, pImage, action);
+}
+
+#ifdef GRAPH_SPRITE_CACHE
+/**
+*  @fn        PutSprite
+*  @brief     PutSpriteCtx() at the screen cursor
+*/
+uint8_t PutSprite(const tImage* pImage, uint8_t action)
+{
+   return PutSpriteCtx(&ScreenCtx, pImage, action);
+}
+#endif
+
+/**
+*  @fn        PutGlyphRun
+*  @brief     PutGlyphRunCtx() at the screen cursor
+*/
+uint16_t PutGlyphRun(const tImage* const* pGlyphs, uint8_t n_glyphs, uint8_t action)
+{
+   return PutGlyphRunCtx(&ScreenCtx, pGlyphs, n_glyphs, action);
+}
+
+/**
+*  @fn        PutBitRun
+*  @brief     PutBitRunCtx() at the screen cursor
+*/
+uint16_t PutBitRun(const tBitImage* pImages, uint8_t n_images, uint8_t action)
+{
+   return PutBitRunCtx(&ScreenCtx, pImages, n_images, action);
+}
+
+/**
+*  @fn        GotoXY
+*  @brief     GotoXYCtx() on the screen
+*/
+void GotoXY(uint16_t Xpos, uint16_t Ypos)
+{
+   GotoXYCtx(&ScreenCtx, Xpos, Ypos);
+}
+
+/***** Local    functions  ****************************************/
+/**
+*  @fn        VblankCallback
+*  @param[IN] 1 for start of blanking interval, 0 for end
+*  @param[IN] field parity, 1 for odd field of interlaced modes
+*  @brief     Callback function for vertical blanking
+               Called at start and end of vertical blanking period
+*/
+static void VblankCallback(uint8_t event, uint8_t field)
+{
+   (void)field;
+   vBlankActive = event;
+}
+
+
+
+/**
+*  @fn        PutHline
+*  @param[IN] x coordinate
+*  @param[IN] y coordinate
+*  @param[IN] length of line
+*  @param[IN] action, 1 = set, 0 = clear, 2 = or, 3 = xor
+*  @brief     Draws horizontal line starting from specified point, always solid
+*/
+static void PutHline(tGraphCtx* pCtx, uint16_t x, uint16_t y, uint16_t len, uint8_t action)
+{
+   putSpanClipped(pCtx, x, y, len, action, 0);
+}
+
+/**
+*  @fn        putSpanClipped
+*  @param[IN] x coordinate
+*  @param[IN] y coordinate
+*  @param[IN] length of span
+*  @param[IN] action, 1 = set, 0 = clear, 2 = or, 3 = xor
+*  @param[IN] fill pattern, 0 for solid
+*  @brief     Fills a horizontal span clipped to the clip rectangle
+*/
+static void putSpanClipped(tGraphCtx* pCtx, uint16_t x, uint16_t y, uint16_t len,
+                           uint8_t action, const uint8_t* p_pattern)
+{
+   uint32_t x_end = (uint32_t)x + len;    /* exclusive */
+   tClipRect clip;
+
+   getClip(pCtx, &clip);
+   if((y < clip.y1) || (y > clip.y2))
+      return;
+   if(x < clip.x1)
+      x = clip.x1;
+   if(x_end > (clip.x2 + 1U))
+      x_end = clip.x2 + 1U;
+   if(x_end > x)
+      fillRect(pCtx, x, y, (uint16_t)(x_end - 1U), y, action, p_pattern);
+}
+
+/**
+*  @fn        fillRect
+*  @param[IN] x coordinate, top left
+*  @param[IN] y coordinate, top left
+*  @param[IN] x coordinate, bottom right
+*  @param[IN] y coordinate, bottom right
+*  @param[IN] action, 1 = set, 0 = clear, 2 = or, 3 = xor
+*  @param[IN] fill pattern, 0 for solid
+*  @brief     Fills rectangle without clipping. End masks and the action's
+*             byte operation are worked out once, runs of a word or more
+*             are written a word at a time, and full width fills use memset.
+*             Trailer bytes are left untouched. A pattern is one byte per
+*             row, x aligned, so only changes the value written
+*/
+static void fillRect(tGraphCtx* pCtx, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                     uint8_t action, const uint8_t* p_pattern)
+{
+   uint16_t stride = pCtx->stride;
+   uint16_t rows = y2 - y1 + 1U;
+   uint16_t xb1 = x1 >> 3U;
+   uint16_t xb2 = x2 >> 3U;
+   uint8_t  s_mask = 0xFF >> (x1 & 7U);
+   uint8_t  e_mask = 0xFF << (7U - (x2 & 7U));
+   uint8_t *p_row = &pCtx->pTarget[(y1 * stride) + xb1];
+   uint8_t *p_fb;
+   const tFillOp* p_op;
+   uint16_t n_mid;
+   uint16_t i;
+   uint8_t  pattern = 0xFF;
+   uint8_t  keep;
+   uint8_t  put;
+   uint8_t  y = (uint8_t)y1;
+   uint8_t  full_row;
+
+   if(action > GRAPH_XOR)
+      return;
+   p_op = &FillOps[action];
+   keep = (uint8_t)((~pattern & p_op->invert) | p_op->hold);
+   put = pattern & p_op->solid;
+
+   markDirty(pCtx, y1, rows);
+
+   if(xb1 == xb2)
+   {
+      /* Within a single byte */
+      s_mask &= e_mask;
+      for(; rows != 0; rows--, p_row += stride, y++)
+      {
+         if(p_pattern != 0)
+         {
+            pattern = p_pattern[y & 7U];
+            keep = (uint8_t)((~pattern & p_op->invert) | p_op->hold);
+            put = pattern & p_op->solid;
+         }
+         fillByte(p_row, keep | (uint8_t)~s_mask, put & s_mask);
+      }
+      return;
+   }
+
+   /* Whole bytes between partial start and end bytes */
+   n_mid = (xb2 - xb1) + 1U - ((s_mask != 0xFF) ? 1U : 0) - ((e_mask != 0xFF) ? 1U : 0);
+
+   /* Whole rows can be written by memset if the target is a whole number of bytes wide */
+   full_row = (uint8_t)((n_mid == (pCtx->width >> 3U)) && ((pCtx->width & 7U) == 0));
+
+   if(full_row && (action == GRAPH_CLEAR) && (p_pattern == 0) &&
+      (((pCtx->flags & GRAPH_CTX_SCREEN) != 0) || (pCtx->stride == n_mid)))
+   {
+      /* Full width, screen trailer bytes are zero so can be cleared with the rows */
+      memset(p_row, 0, ((rows - 1U) * stride) + n_mid);
+   }
+   else if(full_row &&
+           ((action == GRAPH_SET) || ((action == GRAPH_OR) && (p_pattern == 0))))
+   {
+      for(; rows != 0; rows--, p_row += stride, y++)
+      {
+         if(p_pattern != 0)
+            pattern = p_pattern[y & 7U];
+         memset(p_row, pattern, n_mid);
+      }
+   }
+   else
+   {
+      for(; rows != 0; rows--, p_row += stride, y++)
+      {
+         if(p_pattern != 0)
+         {
+            pattern = p_pattern[y & 7U];
+            keep = (uint8_t)((~pattern & p_op->invert) | p_op->hold);
+            put = pattern & p_op->solid;
+         }
+         p_fb = p_row;
+         if(s_mask != 0xFF)
+            fillByte(p_fb++, keep | (uint8_t)~s_mask, put & s_mask);
+
+         /* Runs shorter than a word, such as sprite erases, are not worth aligning */
+         if(n_mid < 4U)
+         {
+            for(i = 0; i < n_mid; i++)
+               fillByte(&p_fb[i], keep, put);
+         }
+         else
+            fillBytes(p_fb, n_mid, keep, put);
+
+         if(e_mask != 0xFF)
+            fillByte(&p_fb[n_mid], keep | (uint8_t)~e_mask, put & e_mask);
+      }
+   }
+}
+
+/**
+*  @fn        fillByte
+*  @param[IN] pointer to frame buffer
+*  @param[IN] bits kept, from FillOps
+*  @param[IN] bits then inverted, from FillOps
+*  @brief     Applies a fill action's byte operation, masked by the caller
+*             setting the keep bits and clearing the put bits outside it
+*/
+static __INLINE void fillByte(uint8_t* pFrameBuff, uint8_t keep, uint8_t put)
+{
+   *pFrameBuff = (*pFrameBuff & keep) ^ put;
+}
+
+/**
+*  @fn        fillBytes
+*  @param[IN] pointer to frame buffer
+*  @param[IN] number of bytes
+*  @param[IN] bits kept, from FillOps
+*  @param[IN] bits then inverted, from FillOps
+*  @brief     Applies a fill action to whole bytes, aligned words at a time.
+*             Set and solid clear keep nothing, so just store
+*/
+static void fillBytes(uint8_t* pFrameBuff, uint16_t len, uint8_t keep, uint8_t put)
+{
+   uint32_t* p_word;
+   uint32_t  keep_word = keep * 0x01010101UL;
+   uint32_t  put_word = put * 0x01010101UL;
+
+   /* Bytes up to word boundary */
+   for(; (len != 0) && (((uintptr_t)pFrameBuff & 3U) != 0); len--)
+      fillByte(pFrameBuff++, keep, put);
+
+   p_word = (uint32_t*)pFrameBuff;
+   if(keep == 0)
+   {
+      for(; len >= 4U; len -= 4U)
+         *p_word++ = put_word;
+   }
+   else
+   {
+      for(; len >= 4U; len -= 4U, p_word++)
+         *p_word = (*p_word & keep_word) ^ put_word;
+   }
+
+   /* Remaining bytes */
+   for(pFrameBuff = (uint8_t*)p_word; len != 0; len--)
+      fillByte(pFrameBuff++, keep, put);
+}
+
+/**
+*  @fn        plotPixel
+*  @param[IN] x coordinate
+*  @param[IN] y coordinate
+*  @param[IN] action, 1 = set, 0 = clear, 2 = or, 3 = xor
+*  @brief     Sets pixel without clipping
+*/
+static void plotPixel(tGraphCtx* pCtx, uint16_t x, uint16_t y, uint8_t action)
+{
+   /* X Byte index and bit mask */
+   uint16_t x_index = x >> 3U; 
+   uint16_t bit_pos = x & 7;
+   uint8_t  mask = (0x80 >> bit_pos);
+
+   if((pCtx->flags & GRAPH_CTX_SCREEN) != 0)
+   {
+      VIDEO_MARK_DIRTY(y);
+   }
+   plotByte(&pCtx->pTarget[(y * pCtx->stride) + x_index], mask, action);
+}
+
+/**
+*  @fn             syncScreen
+*  @param[IN,OUT]  graphics context
+*  @brief          Points screen context at the buffer being drawn into, and
+*                  sizes it to the current video mode
+*/
+static void syncScreen(tGraphCtx* pCtx)
+{
+   if((pCtx->flags & GRAPH_CTX_SCREEN) != 0)
+   {
+      pCtx->pTarget = pDrawBuff;
+      pCtx->width = pVideoMode->width;
+      pCtx->height = pVideoMode->height;
+      pCtx->stride = pVideoMode->stride;
+   }
+}
+
+/**
+*  @fn         getClip
+*  @param[IN]  graphics context, screen target is brought up to date first
+*  @param[OUT] clip rectangle limited to target
+*/
+static void getClip(tGraphCtx* pCtx, tClipRect* p_clip)
+{
+   syncScreen(pCtx);
+   *p_clip = pCtx->clip;
+   if(p_clip->x2 >= pCtx->width)
+      p_clip->x2 = pCtx->width - 1U;
+   if(p_clip->y2 >= pCtx->height)
+      p_clip->y2 = pCtx->height - 1U;
+}
+
+/**
+*  @fn         markDirty
+*  @param[IN]  graphics context
+*  @param[IN]  first row
+*  @param[IN]  number of rows
+*  @brief      Marks rows for video update, only the screen has any
+*/
+static __INLINE void markDirty(const tGraphCtx* pCtx, uint16_t y, uint16_t rows)
+{
+   if((pCtx->flags & GRAPH_CTX_SCREEN) != 0)
+   {
+      VideoMarkDirty(y, rows);
+   }
+}
+
+/**
+*  @fn         isClipped
+*  @param[IN]  x coordinate
+*  @param[IN]  y coordinate
+*  @param[IN]  width
+*  @param[IN]  height
+*  @param[IN]  clip rectangle
+*  @return     0 if area is not empty and lies wholly within clip rectangle
+*/
+static uint8_t isClipped(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const tClipRect* p_clip)
+{
+   return (uint8_t)((width == 0) || (height == 0) ||
+                    (x < p_clip->x1) || (((uint32_t)x + width - 1U) > p_clip->x2) ||
+                    (y < p_clip->y1) || (((uint32_t)y + height - 1U) > p_clip->y2));
+}
+
+/**
+*  @fn         outCode
+*  @param[IN]  x coordinate
+*  @param[IN]  y coordinate
+*  @param[IN]  clip rectangle
+*  @return     Cohen-Sutherland outcode, 0 if inside
+*/
+static uint8_t outCode(int32_t x, int32_t y, const tClipRect* p_clip)
+{
+   uint8_t code = 0;
+
+   if(x < p_clip->x1)
+      code |= CLIP_LEFT;
+   else if(x > p_clip->x2)
+      code |= CLIP_RIGHT;
+   if(y < p_clip->y1)
+      code |= CLIP_TOP;
+   else if(y > p_clip->y2)
+      code |= CLIP_BOTTOM;
+   return code;
+}
+
+/**
+*  @fn             clipLine
+*  @param[IN,OUT]  x coordinate, 1st point
+*  @param[IN,OUT]  y coordinate, 1st point
+*  @param[IN,OUT]  x coordinate, 2nd point
+*  @param[IN,OUT]  y coordinate, 2nd point
+*  @return         0 if line lies wholly outside clip rectangle
+*  @brief          Cohen-Sutherland line clipping, end points are moved
+*                  onto the clip rectangle
+*/
+static uint8_t clipLine(tGraphCtx* pCtx, uint16_t* p_x1, uint16_t* p_y1, uint16_t* p_x2, uint16_t* p_y2)
+{
+   int32_t x1 = *p_x1, y1 = *p_y1;
+   int32_t x2 = *p_x2, y2 = *p_y2;
+   int32_t x, y;
+   uint8_t code1, code2, code;
+   uint8_t passes;
+   tClipRect clip;
+
+   getClip(pCtx, &clip);
+   code1 = outCode(x1, y1, &clip);
+   code2 = outCode(x2, y2, &clip);
+
+   /* Each pass moves an end point onto one edge, rounding may need a further pass */
+   for(passes = 0; (code1 | code2) != 0; passes++)
+   {
+      if(((code1 & code2) != 0) || (passes >= 8U))
+         return 0;
+
+      code = (code1 != 0) ? code1 : code2;
+      if(code & CLIP_BOTTOM)
+      {
+         y = clip.y2;
+         x = x1 + (int32_t)(((int64_t)(x2 - x1) * (y - y1)) / (y2 - y1));
+      }
+      else if(code & CLIP_TOP)
+      {
+         y = clip.y1;
+         x = x1 + (int32_t)(((int64_t)(x2 - x1) * (y - y1)) / (y2 - y1));
+      }
+      else if(code & CLIP_RIGHT)
+      {
+         x = clip.x2;
+         y = y1 + (int32_t)(((int64_t)(y2 - y1) * (x - x1)) / (x2 - x1));
+      }
+      else
+      {
+         x = clip.x1;
+         y = y1 + (int32_t)(((int64_t)(y2 - y1) * (x - x1)) / (x2 - x1));
+      }
+
+      if(code == code1)
+      {
+         x1 = x;
+         y1 = y;
+         code1 = outCode(x1, y1, &clip);
+      }
+      else
+      {
+         x2 = x;
+         y2 = y;
+         code2 = outCode(x2, y2, &clip);
+      }
+   }
+
+   *p_x1 = (uint16_t)x1;
+   *p_y1 = (uint16_t)y1;
+   *p_x2 = (uint16_t)x2;
+   *p_y2 = (uint16_t)y2;
+   return 1;
+}
+
+/**
+*  @fn        plotByte
+*  @param[IN] pointer to frame buffer byte
+*  @param[IN] mask, pixels to be drawn
+*  @param[IN] action, 1 = set, 0 = clear, 2 = or, 3 = xor
+*  @brief     Applies plot action to pixels within a byte. Set and or are
+*             the same when drawing in a single colour
+*/
+static __INLINE void plotByte(uint8_t* pFrameBuff, uint8_t mask, uint8_t action)
+{
+   switch(action)
+   {
+      case GRAPH_CLEAR:
+         *pFrameBuff &= ~mask;
+         break;
+
+      case GRAPH_SET:
+      case GRAPH_OR:
+         *pFrameBuff |= mask;
+         break;
+
+      case GRAPH_XOR:
+         *pFrameBuff ^= mask;
+         break;
+
+      default:
+         break;
+   }
+}
+
+/**
+*  @fn        plot8points
+*  @param[IN] graphics context
+*  @param[IN] cx  - centre coordinate
+*  @param[IN] cy  - centre coordinate
+*  @param[IN] x   - offset from centre
+*  @param[IN] y   - offset from centre
+*  @param[IN] action, 1 = set, 0 = clear, 2 = or, 3 = xor
+*  @param[IN] plot function, PutPixelCtx if circle crosses clip rectangle,
+*             otherwise plotPixel
+*  @brief     Sub-function for circle drawing
+*             Its is based on Bressenhams circle algorithm, and adapted from 
+*             sample code given at http://en.wikipedia.org/wiki/Midpoint_circle_algorithm
+*/
+static void plot8points(tGraphCtx* pCtx, uint16_t cx, uint16_t cy, uint16_t x, uint16_t y,
+                        uint16_t action, void (*plot)(tGraphCtx*, uint16_t, uint16_t, uint8_t))
+{
+   plot4points(pCtx, cx, cy, x, y, action, plot);
+   if (x != y) 
+      plot4points(pCtx, cx, cy, y, x, action, plot);
+}
+ 
+/**
+*  @fn        plot4points
+*  @param[IN] graphics context
+*  @param[IN] cx  - centre coordinate
+*  @param[IN] cy  - centre coordinate
+*  @param[IN] x   - offset from centre
+*  @param[IN] y   - offset from centre
+*  @param[IN] action, 1 = set, 0 = clear, 2 = or, 3 = xor
+*  @param[IN] plot function, PutPixelCtx if circle crosses clip rectangle,
+*             otherwise plotPixel
+*  @brief     Sub-function for circle drawing
+*             Its is based on Bressenhams circle algorithm, and adapted from 
+*             sample code given at http://en.wikipedia.org/wiki/Midpoint_circle_algorithm
+*/
+static void plot4points(tGraphCtx* pCtx, uint16_t cx, uint16_t cy, uint16_t x, uint16_t y,
+                        uint16_t action, void (*plot)(tGraphCtx*, uint16_t, uint16_t, uint8_t))
+{
+   // The '(x != 0 && y != 0)' test in the last line of this function
+   // may be omitted for a performance benefit if the radius of the
+   // circle is known to be non-zero.
+   plot(pCtx, cx + x, cy + y, action);
+   if (x != 0) 
+      plot(pCtx, cx - x, cy + y, action);
+   if (y != 0) 
+      plot(pCtx, cx + x, cy - y, action);
+   if (x != 0 && y != 0) 
+      plot(pCtx, cx - x, cy - y, action);
+}
+
+/**
+*  @fn         loadImageBits
+*  @param[IN]  pointer to image row
+*  @param[IN]  number of bytes to load, 1 to 4
+*  @return     image bits, leftmost pixel in MSB. Frame buffer bytes are
+*              in the same order, so must be byte swapped before storing
+*/
+static __INLINE uint32_t loadImageBits(const uint8_t* p_img, uint16_t n_img)
+{
+   uint32_t bits = (uint32_t)p_img[0] << 24;
+
+   if(n_img > 1U)
+      bits |= (uint32_t)p_img[1] << 16;
+   if(n_img > 2U)
+      bits |= (uint32_t)p_img[2] << 8;
+   if(n_img > 3U)
+      bits |= p_img[3];
+
+   return bits;
+}
+
+/**
+*  @fn             appendRun
+*  @param[IN,OUT]  run
+*  @param[IN]      pixels, left aligned, unused bits zero
+*  @param[IN]      number of pixels, up to 24
+*  @param[IN]      action
+*  @brief          Shifts pixels into run, writing out every whole byte
+*/
+static __INLINE void appendRun(tRun* p_run, uint32_t bits, uint8_t n_bits, uint8_t action)
+{
+   p_run->acc |= bits >> p_run->n_acc;
+   p_run->n_acc += n_bits;
+   while(p_run->n_acc >= 8U)
+   {
+      flushRun(p_run, action);
+      p_run->n_acc -= 8U;
+   }
+}
+
+/**
+*  @fn             flushRun
+*  @param[IN,OUT]  run
+*  @param[IN]      action
+*  @brief          Writes leftmost byte of run if visible and not blank
+*/
+static __INLINE void flushRun(tRun* p_run, uint8_t action)
+{
+   uint8_t mask = (uint8_t)(p_run->acc >> 24);
+
+   if((mask != 0) && (p_run->i_byte >= p_run->i_first) && (p_run->i_byte <= p_run->i_last))
+   {
+      if(p_run->i_byte == p_run->i_first)
+         mask &= p_run->s_mask;
+      if(p_run->i_byte == p_run->i_last)
+         mask &= p_run->e_mask;
+      plotByte(&p_run->p_row[p_run->i_byte], mask, action);
+   }
+   p_run->acc <<= 8;
+   p_run->i_byte++;
+}
+
+/**
+*  @fn         putBitmapWords
+*  @param[IN]  pointer to image data
+*  @param[IN]  number of bytes in each image row
+*  @param[IN]  pointer to frame buffer
+*  @param[IN]  number of rows
+*  @param[IN]  number of frame buffer words per row
+*  @param[IN]  action
+*  @brief      Renders image wider than one word, bits shifted out of each word
+*              are carried into the next
+*/
+static void putBitmapWords(const tGraphCtx* pCtx, const uint8_t* p_img, uint16_t n_img,
+                           uint8_t* p_fb, uint16_t rows, uint16_t n_words, uint8_t action)
+{
+   uint8_t shift = pCtx->bit_pos;
+   uint16_t stride = pCtx->stride;
+   uint16_t i;
+   int16_t left;
+   uint32_t src;
+   uint32_t carry;
+   uint32_t mask;
+   /* fb = (fb & ~(mask & clr)) ^ (mask & tog) covers all actions */
+   uint32_t clr = (action == GRAPH_XOR) ? 0 : 0xFFFFFFFFUL;
+   uint32_t tog = (action == GRAPH_CLEAR) ? 0 : 0xFFFFFFFFUL;
+
+   for(; rows != 0; rows--, p_img += n_img, p_fb += stride)
+   {
+      carry = 0;
+      for(i = 0; i < n_words; i++)
+      {
+         left = (int16_t)n_img - (int16_t)(i << 2);
+         src = 0;
+         if(left > 0)
+            src = loadImageBits(&p_img[i << 2], (left > 4) ? 4U : (uint16_t)left);
+         mask = __REV((src >> shift) | carry);
+         carry = (shift != 0) ? (src << (32U - shift)) : 0;
+         FB_WORD(&p_fb[i << 2]) = (FB_WORD(&p_fb[i << 2]) & ~(mask & clr)) ^ (mask & tog);
+      }
+   }
+}
+
+/**
+*  @fn         putBitmapBytes
+*  @param[IN]  pointer to image
+*  @param[IN]  clip rectangle
+*  @param[IN]  action
+*  @brief      Renders visible part of image a byte at a time, for images
+*              crossing the clip rectangle or at the end of the frame buffer
+*/
+static void putBitmapBytes(tGraphCtx* pCtx, const tImage* pImage, const tClipRect* p_clip, uint8_t action)
+{
+   const uint8_t* p_img = pImage->bitmap;
+   uint8_t* p_fb = pCtx->pBuff;
+   uint8_t shift = pCtx->bit_pos;
+   uint16_t stride = pCtx->stride;
+   uint16_t n_img = (pImage->width + 7U) >> 3;
+   uint32_t x1 = pCtx->x_draw;
+   uint32_t y1 = pCtx->y_draw;
+   uint32_t x2 = x1 + pImage->width - 1U;
+   uint32_t y2 = y1 + pImage->height - 1U;
+   uint16_t i_first, i_last;
+   uint16_t i_fb;
+   uint8_t s_mask, e_mask;
+   uint8_t mask;
+
+   /* Visible part of image */
+   if(x1 < p_clip->x1)
+      x1 = p_clip->x1;
+   if(y1 < p_clip->y1)
+      y1 = p_clip->y1;
+   if(x2 > p_clip->x2)
+      x2 = p_clip->x2;
+   if(y2 > p_clip->y2)
+      y2 = p_clip->y2;
+   if((pImage->width == 0) || (pImage->height == 0) || (x1 > x2) || (y1 > y2))
+      return;
+
+   /* Frame buffer bytes covering visible columns, masked at either end */
+   i_first = (uint16_t)((x1 >> 3) - (pCtx->x_draw >> 3));
+   i_last = (uint16_t)((x2 >> 3) - (pCtx->x_draw >> 3));
+   s_mask = 0xFF >> (x1 & 7U);
+   e_mask = 0xFF << (7U - (x2 & 7U));
+
+   p_img += (y1 - pCtx->y_draw) * n_img;
+   p_fb += (y1 - pCtx->y_draw) * stride;
+   markDirty(pCtx, (uint16_t)y1, (uint16_t)(y2 - y1 + 1U));
+
+   for(; y1 <= y2; y1++)
+   {
+      for(i_fb = i_first; i_fb <= i_last; i_fb++)
+      {
+         mask = 0;
+         if(i_fb != 0)
+            mask |= (uint8_t)(p_img[i_fb - 1U] << (8 - shift));  /* rightmost section of prev image byte */
+         if(i_fb < n_img)
+            mask |= p_img[i_fb] >> shift;                      /* leftmost section of image byte */
+         if(i_fb == i_first)
+            mask &= s_mask;
+         if(i_fb == i_last)
+            mask &= e_mask;
+         plotByte(&p_fb[i_fb], mask, action);
+      }
+      p_img += n_img;                        /* next row in bit map      */
+      p_fb += stride;                        /* next row in frame buffer */
+   }
+}
+
+#ifdef GRAPH_SPRITE_CACHE
+/**
+*  @fn         getShiftedSprite
+*  @param[IN]  pointer to image
+*  @param[IN]  bit alignment, 0 to 7
+*  @return     shifted rows, 0 if image cannot be cached
+*  @brief      Finds image in cache, adding it if there is room, and shifts
+*              it to the requested alignment if not done already
+*/
+static const uint32_t* getShiftedSprite(const tImage* pImage, uint8_t align)
+{
+   tSpriteCacheEntry* p_entry = SpriteCache;
+   uint16_t n_img = (pImage->width + 7U) >> 3;
+   uint16_t rows = pImage->height;
+   uint16_t words = rows * 8U;
+   const uint8_t* p_img = pImage->bitmap;
+   uint32_t* p_shifted;
+
+   if(pImage->width > SPRITE_CACHE_WIDTH)
+   {
+      SpriteCacheStats.misses++;
+      return 0;
+   }
+
+   while((p_entry < &SpriteCache[SpriteCacheStats.entries]) && (p_entry->pImage != pImage))
+      p_entry++;
+
+   if(p_entry == &SpriteCache[SpriteCacheStats.entries])
+   {
+      /* Not cached, allocate room for all alignments. Never evicted */
+      if((SpriteCacheStats.entries == SPRITE_CACHE_ENTRIES) ||
+         ((SpriteCacheStats.bytes_used + (words * 4U)) > SPRITE_CACHE_BYTES))
+      {
+         SpriteCacheStats.misses++;
+         return 0;
+      }
+      p_entry->pImage = pImage;
+      p_entry->pShifted = &SpritePool[SpriteCacheStats.bytes_used / 4U];
+      p_entry->built = 0;
+      SpriteCacheStats.bytes_used += words * 4U;
+      SpriteCacheStats.entries++;
+   }
+
+   p_shifted = &p_entry->pShifted[align * rows];
+   if(p_entry->built & (1U << align))
+   {
+      SpriteCacheStats.hits++;
+   }
+   else
+   {
+      SpriteCacheStats.misses++;
+      for(; rows != 0; rows--, p_img += n_img)
+         *p_shifted++ = __REV(loadImageBits(p_img, n_img) >> align);
+      p_entry->built |= (uint8_t)(1U << align);
+      p_shifted = &p_entry->pShifted[align * pImage->height];
+   }
+   return p_shifted;
+}
+#endif
+
+/**
+*  @fn         fillConic
+*  @param[IN]  cx  - centre coordinate
+*  @param[IN]  cy  - centre coordinate
+*  @param[IN]  horizontal radius
+*  @param[IN]  vertical radius
+*  @param[IN]  sector to fill, 0 for whole ellipse
+*  @param[IN]  action
+*  @brief      Works down the rows of an ellipse, narrowing the half width
+*              until the span ends lie within radii increased by half a
+*              pixel, so each row is drawn exactly once
+*/
+static void fillConic(tGraphCtx* pCtx, uint16_t cx, uint16_t cy, uint16_t rx, uint16_t ry,
+                      const tSector* p_sector, uint8_t action)
+{
+   /* Inside if 4x^2(2ry+1)^2 + 4y^2(2rx+1)^2 <= (2rx+1)^2(2ry+1)^2 */
+   uint64_t a2 = (uint64_t)((2UL * rx) + 1U) * ((2UL * rx) + 1U);
+   uint64_t b2 = (uint64_t)((2UL * ry) + 1U) * ((2UL * ry) + 1U);
+   uint64_t limit = a2 * b2;
+   int32_t half_width = rx;
+   int32_t dy;
+
+   if((rx > GRAPH_MAX_RADIUS) || (ry > GRAPH_MAX_RADIUS))
+      return;
+
+   for(dy = 0; dy <= ry; dy++)
+   {
+      while((half_width > 0) &&
+            (((4U * b2 * (uint32_t)half_width * (uint32_t)half_width) +
+              (4U * a2 * (uint32_t)dy * (uint32_t)dy)) > limit))
+         half_width--;
+
+      if(p_sector == 0)
+      {
+         putSpan(pCtx, (int32_t)cx - half_width, (int32_t)cx + half_width, (int32_t)cy - dy, action);
+         if(dy != 0)
+            putSpan(pCtx, (int32_t)cx - half_width, (int32_t)cx + half_width, (int32_t)cy + dy, action);
+      }
+      else
+      {
+         fillSectorRow(pCtx, cx, (int32_t)cy - dy, dy, half_width, p_sector, action);
+         if(dy != 0)
+            fillSectorRow(pCtx, cx, (int32_t)cy + dy, -dy, half_width, p_sector, action);
+      }
+   }
+}
+
+/**
+*  @fn         fillSectorRow
+*  @param[IN]  cx  - centre coordinate
+*  @param[IN]  screen row
+*  @param[IN]  height above centre, upwards positive
+*  @param[IN]  half width of circle on this row
+*  @param[IN]  sector to fill
+*  @param[IN]  action
+*  @brief      Intersects row of circle with the half planes either side
+*              of the sector, giving one or two spans
+*/
+static void fillSectorRow(tGraphCtx* pCtx, int32_t cx, int32_t y, int32_t dy, int32_t half_width,
+                          const tSector* p_sector, uint8_t action)
+{
+   int32_t lo1, hi1, lo2, hi2;
+
+   /* Left of start direction: x*sin_start <= dy*cos_start */
+   halfPlane(p_sector->sin_start, dy * p_sector->cos_start, &lo1, &hi1);
+   /* Right of end direction: x*sin_end >= dy*cos_end */
+   halfPlane(-p_sector->sin_end, -dy * p_sector->cos_end, &lo2, &hi2);
+
+   if(p_sector->reflex == 0)
+   {
+      /* Inside both half planes */
+      if(lo2 > lo1)
+         lo1 = lo2;
+      if(hi2 < hi1)
+         hi1 = hi2;
+      lo2 = 1;
+      hi2 = 0;
+   }
+   else if((lo2 <= (hi1 + 1)) && (lo1 <= (hi2 + 1)))
+   {
+      /* Inside either half plane, overlapping spans merged so none drawn twice */
+      if(lo2 < lo1)
+         lo1 = lo2;
+      if(hi2 > hi1)
+         hi1 = hi2;
+      lo2 = 1;
+      hi2 = 0;
+   }
+
+   if(lo1 < -half_width)
+      lo1 = -half_width;
+   if(hi1 > half_width)
+      hi1 = half_width;
+   if(lo2 < -half_width)
+      lo2 = -half_width;
+   if(hi2 > half_width)
+      hi2 = half_width;
+
+   if(lo1 <= hi1)
+      putSpan(pCtx, cx + lo1, cx + hi1, y, action);
+   if(lo2 <= hi2)
+      putSpan(pCtx, cx + lo2, cx + hi2, y, action);
+}
+
+/**
+*  @fn         halfPlane
+*  @param[IN]  a
+*  @param[IN]  b
+*  @param[OUT] lowest x
+*  @param[OUT] highest x, below lowest if there is no solution
+*  @brief      Solves a*x <= b for integer x
+*/
+static void halfPlane(int32_t a, int32_t b, int32_t* p_lo, int32_t* p_hi)
+{
+   *p_lo = -0x10000L;
+   *p_hi = 0x10000L;
+
+   if(a > 0)
+   {
+      /* x <= b/a, rounded down */
+      *p_hi = (b >= 0) ? (b / a) : -((-b + a - 1) / a);
+   }
+   else if(a < 0)
+   {
+      /* x >= b/a, rounded up */
+      a = -a;
+      b = -b;
+      *p_lo = (b >= 0) ? ((b + a - 1) / a) : -((-b) / a);
+   }
+   else if(b < 0)
+   {
+      *p_lo = 1;
+      *p_hi = 0;
+   }
+}
+
+/**
+*  @fn         putSpan
+*  @param[IN]  x coordinate, left
+*  @param[IN]  x coordinate, right
+*  @param[IN]  y coordinate
+*  @param[IN]  action
+*  @brief      Draws horizontal span that may extend off the screen, in the
+*              current fill pattern. Ends past 0xFFFE are off any target,
+*              so the length always fits 16 bits
+*/
+static void putSpan(tGraphCtx* pCtx, int32_t x1, int32_t x2, int32_t y, uint8_t action)
+{
+   if((y < 0) || (y > 0xFFFF) || (x2 < 0) || (x1 > 0xFFFE))
+      return;
+   if(x1 < 0)
+      x1 = 0;
+   if(x2 > 0xFFFE)
+      x2 = 0xFFFE;
+   putSpanClipped(pCtx, (uint16_t)x1, (uint16_t)y, (uint16_t)(x2 - x1 + 1), action, pCtx->pPattern);
+}
+
+/**
+*  @fn         sinDeg
+*  @param[IN]  angle, degrees
+*  @return     sin of angle, scaled by SIN_SCALE
+*/
+static int32_t sinDeg(int16_t degrees)
+{
+   degrees %= 360;
+   if(degrees < 0)
+      degrees += 360;
+
+   if(degrees <= 90)
+      return SinTable[degrees];
+   if(degrees <= 180)
+      return SinTable[180 - degrees];
+   if(degrees <= 270)
+      return -SinTable[degrees - 180];
+   return -SinTable[360 - degrees];
+}
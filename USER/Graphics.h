@@ -1,44 +1,156 @@
-/**
-*  @file   Graphics.h
-*  @author Rob Gee
-*  @date   November 2017
-*  @brief  Include file for graphics functions
-*/
-
-#ifndef __GRAPHICS_H
-#define __GRAPHICS_H
-
-#include "Display.h"
-
-/***** Constants  *************************************************/
-#define GRAPH_SET    1U
-#define GRAPH_CLEAR  0U
-#define GRAPH_OR     2U
-
-/***** Types      *************************************************/
-typedef struct
-{
-   const uint8_t* bitmap; 
-   uint8_t  width;
-   uint8_t  height;
-   uint8_t  datasize;
-} tImage;
-
-
-/***** Exported functions   ***************************************/
-void GraphicsInit(void);
-void GraphicsTick(void);
-void PutPixel(uint16_t x, uint16_t y, uint8_t action);
-void PutLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t action);
-void PutVline(uint16_t x, uint16_t y, uint16_t len, uint8_t action);
-void PutRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t action);
-void FillRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t action);
-void PutCircle(uint16_t cx, uint16_t cy, uint16_t radius, uint16_t action);
-uint8_t PutBitmap(tImage* pImage, uint8_t action);
-void GotoXY(uint16_t Xpos, uint16_t Ypos);
-void ClearScreen(void);
-uint8_t IsVblankActive(void);
-
-#endif  /*  __GRAPHICS_H  */
-
-
+/**
+*  @file   Graphics.h
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Include file for graphics functions
+*/
+
+#ifndef __GRAPHICS_H
+#define __GRAPHICS_H
+
+#include "Display.h"
+
+/***** Constants  *************************************************/
+#define GRAPH_SET    1U
+#define GRAPH_CLEAR  0U
+#define GRAPH_OR     2U    /* same as set for single colour drawing  */
+#define GRAPH_XOR    3U    /* drawing twice restores the background  */
+
+#define GRAPH_MAX_RADIUS      4095U /* largest radius of filled circles, ellipses and arcs */
+#define GRAPH_MAX_POLY_POINTS 16U   /* most vertices of a filled polygon */
+#define GRAPH_MAX_COORD       8191  /* polygon vertices may be off screen, up to this far */
+#define GRAPH_RUN_LEN         16U   /* images passed to PutBitRun() by PutGlyphRun() at a time */
+#define GRAPH_DITHER_LEVELS   65U   /* grey levels of SetFillDither(), 0 clear to 64 solid */
+
+#define GRAPH_CTX_SCREEN      0x01U /* context follows draw buffer and video mode, marks rows dirty */
+
+/* Build options */
+//#define GRAPH_SPRITE_CACHE          /* PutSprite() keeps pre-shifted copies of sprites in RAM */
+
+#ifndef SPRITE_CACHE_BYTES
+#define SPRITE_CACHE_BYTES    2048U /* pool for pre-shifted sprites, 256 bytes per 8 row sprite */
+#endif
+#define SPRITE_CACHE_ENTRIES  16U
+#define SPRITE_CACHE_WIDTH    25U   /* widest sprite fitting one word at every alignment */
+
+/***** Types      *************************************************/
+typedef struct
+{
+   const uint8_t* bitmap; 
+   uint8_t  width;
+   uint8_t  height;
+   uint8_t  datasize;
+} tImage;
+
+typedef struct
+{
+   uint32_t hits;          /* draws from an already shifted copy      */
+   uint32_t misses;        /* draws that shifted, or could not cache  */
+   uint16_t bytes_used;
+   uint8_t  entries;
+} tSpriteCacheStats;
+
+typedef struct
+{
+   int16_t x;
+   int16_t y;
+} tPoint;
+
+/* Image at any bit offset in a bit stream, with rows pitch bits apart.
+   tImage rows are padded to whole bytes, packed font glyphs are not */
+typedef struct
+{
+   const uint8_t* bits;
+   uint16_t offset;        /* bit offset of top left pixel          */
+   uint16_t pitch;         /* bits from one row to the next         */
+   uint8_t  width;
+   uint8_t  height;
+} tBitImage;
+
+typedef struct
+{
+   uint16_t x1;            /* inclusive */
+   uint16_t y1;
+   uint16_t x2;
+   uint16_t y2;
+} tClipRect;
+
+/* Drawing target, clip rectangle, fill pattern and cursor. Functions without
+   a context argument draw on the screen through GraphGetScreen() */
+typedef struct
+{
+   uint8_t  *pTarget;      /* top left pixel in MSB of first byte       */
+   uint16_t width;         /* pixels                                    */
+   uint16_t height;
+   uint16_t stride;        /* bytes from one row to the next            */
+   uint8_t  flags;         /* GRAPH_CTX_xxx                             */
+   tClipRect clip;         /* limited to target when used               */
+   uint8_t  *pBuff;        /* byte at cursor                            */
+   uint16_t x_draw;        /* cursor                                    */
+   uint16_t y_draw;
+   uint8_t  bit_pos;
+   const uint8_t *pPattern;   /* fill pattern, 0 for solid              */
+   uint8_t  pattern[8];       /* one byte per row, repeats every 8 pixels */
+} tGraphCtx;
+
+
+/***** Exported functions   ***************************************/
+void GraphicsInit(void);
+void GraphicsTick(void);
+void GraphCtxInit(tGraphCtx* pCtx, uint8_t* pTarget, uint16_t width, uint16_t height, uint16_t stride);
+tGraphCtx* GraphGetScreen(void);
+void PutPixelCtx(tGraphCtx* pCtx, uint16_t x, uint16_t y, uint8_t action);
+void SetClipRectCtx(tGraphCtx* pCtx, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+void ResetClipRectCtx(tGraphCtx* pCtx);
+void SetFillPatternCtx(tGraphCtx* pCtx, const uint8_t* pPattern);
+void SetFillDitherCtx(tGraphCtx* pCtx, uint8_t level);
+void PutLineCtx(tGraphCtx* pCtx, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t action);
+void PutVlineCtx(tGraphCtx* pCtx, uint16_t x, uint16_t y, uint16_t len, uint8_t action);
+void PutRectangleCtx(tGraphCtx* pCtx, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t action);
+void FillRectangleCtx(tGraphCtx* pCtx, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t action);
+void PutCircleCtx(tGraphCtx* pCtx, uint16_t cx, uint16_t cy, uint16_t radius, uint16_t action);
+void FillCircleCtx(tGraphCtx* pCtx, uint16_t cx, uint16_t cy, uint16_t radius, uint8_t action);
+void FillEllipseCtx(tGraphCtx* pCtx, uint16_t cx, uint16_t cy, uint16_t rx, uint16_t ry, uint8_t action);
+void FillArcCtx(tGraphCtx* pCtx, uint16_t cx, uint16_t cy, uint16_t radius, uint16_t start, uint16_t end, uint8_t action);
+void FillPolygonCtx(tGraphCtx* pCtx, const tPoint* pPoints, uint8_t n_points, uint8_t action);
+void FillTriangleCtx(tGraphCtx* pCtx, int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t x3, int16_t y3, uint8_t action);
+uint8_t PutBitmapCtx(tGraphCtx* pCtx, tImage* pImage, uint8_t action);
+uint16_t PutGlyphRunCtx(tGraphCtx* pCtx, const tImage* const* pGlyphs, uint8_t n_glyphs, uint8_t action);
+uint16_t PutBitRunCtx(tGraphCtx* pCtx, const tBitImage* pImages, uint8_t n_images, uint8_t action);
+void GotoXYCtx(tGraphCtx* pCtx, uint16_t Xpos, uint16_t Ypos);
+
+/* Screen context */
+void PutPixel(uint16_t x, uint16_t y, uint8_t action);
+void SetClipRect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+void ResetClipRect(void);
+void SetFillPattern(const uint8_t* pPattern);
+void SetFillDither(uint8_t level);
+void PutLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t action);
+void PutVline(uint16_t x, uint16_t y, uint16_t len, uint8_t action);
+void PutRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t action);
+void FillRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t action);
+void PutCircle(uint16_t cx, uint16_t cy, uint16_t radius, uint16_t action);
+void FillCircle(uint16_t cx, uint16_t cy, uint16_t radius, uint8_t action);
+void FillEllipse(uint16_t cx, uint16_t cy, uint16_t rx, uint16_t ry, uint8_t action);
+void FillArc(uint16_t cx, uint16_t cy, uint16_t radius, uint16_t start, uint16_t end, uint8_t action);
+void FillPolygon(const tPoint* pPoints, uint8_t n_points, uint8_t action);
+void FillTriangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t x3, int16_t y3, uint8_t action);
+uint8_t PutBitmap(tImage* pImage, uint8_t action);
+uint16_t PutGlyphRun(const tImage* const* pGlyphs, uint8_t n_glyphs, uint8_t action);
+uint16_t PutBitRun(const tBitImage* pImages, uint8_t n_images, uint8_t action);
+#ifdef GRAPH_SPRITE_CACHE
+uint8_t PutSpriteCtx(tGraphCtx* pCtx, const tImage* pImage, uint8_t action);
+uint8_t PutSprite(const tImage* pImage, uint8_t action);
+void SpriteCacheFlush(void);
+void SpriteCacheGetStats(tSpriteCacheStats* pStats);
+#else
+#define PutSpriteCtx(pCtx, pImage, action)   PutBitmapCtx((pCtx), (tImage*)(pImage), (action))
+#define PutSprite(pImage, action)            PutBitmap((tImage*)(pImage), (action))
+#endif
+void GotoXY(uint16_t Xpos, uint16_t Ypos);
+void ClearScreen(void);
+uint8_t IsVblankActive(void);
+
+#endif  /*  __GRAPHICS_H  */
+
+
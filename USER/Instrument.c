@@ -0,0 +1,178 @@
+/**
+*  @file   Instrument.c
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  CPU time instrumentation using the Cortex-M3 DWT cycle counter
+*          Keeps min, max, mean and a histogram of times for each channel
+*/
+
+/***** Include files  *********************************************/
+#ifdef INSTR_HOST
+#include <stdint.h>
+#include <string.h>
+#else
+#include "stm32f10x.h"
+#include <string.h>
+#include "Graphics.h"
+#include "GraphText.h"
+#endif
+#include "Instrument.h"
+
+/***** Constants  *************************************************/
+#define OVERLAY_FORMAT     ((uint8_t*)"XXXX 00000 00000 00000")
+
+/***** Types      *************************************************/
+
+/***** Storage    *************************************************/
+static tInstrStats InstrStats[INSTR_NUM_CHANNELS];
+
+#ifdef INSTR_HOST
+uint32_t InstrFakeCycles = 0;
+#else
+static uint8_t * const ChannelNames[INSTR_NUM_CHANNELS] = {
+      (uint8_t*)"ISR ", (uint8_t*)"VBL ", (uint8_t*)"LINE", (uint8_t*)"FILL",
+      (uint8_t*)"BMP ", (uint8_t*)"TEXT", (uint8_t*)"CLS ", (uint8_t*)"CELL"
+      };
+#endif
+
+/***** Local prototypes    ****************************************/
+
+/***** Exported functions  ****************************************/
+/**
+*  @fn     InstrInit
+*  @brief  Starts the cycle counter and clears all channels
+*/
+void InstrInit(void)
+{
+   #ifndef INSTR_HOST
+   CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+   DWT->CYCCNT = 0;
+   DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+   #endif
+   InstrReset();
+}
+
+/**
+*  @fn     InstrReset
+*  @brief  Clears all channels
+*/
+void InstrReset(void)
+{
+   uint16_t i;
+
+   memset(InstrStats, 0, sizeof(InstrStats));
+   for(i = 0; i < INSTR_NUM_CHANNELS; i++)
+      InstrStats[i].min = 0xFFFFFFFFUL;
+}
+
+/**
+*  @fn         InstrRecord
+*  @param[IN]  channel
+*  @param[IN]  time taken, cycles
+*  @brief      Adds a measurement to a channel
+*/
+void InstrRecord(tInstrChannel channel, uint32_t cycles)
+{
+   tInstrStats *p_stats = &InstrStats[channel];
+   uint32_t us = InstrCyclesToUs(cycles);
+   uint16_t bin = 0;
+
+   if(cycles < p_stats->min)
+      p_stats->min = cycles;
+   if(cycles > p_stats->max)
+      p_stats->max = cycles;
+   p_stats->total += cycles;
+   p_stats->count++;
+
+   while(((us >>= 1) != 0) && (bin < (INSTR_HIST_BINS-1U)))
+      bin++;
+   if(p_stats->hist[bin] != 0xFFFFU)
+      p_stats->hist[bin]++;
+}
+
+/**
+*  @fn         InstrGetStats
+*  @param[IN]  channel
+*  @return     pointer to channel statistics, times in cycles
+*/
+const tInstrStats* InstrGetStats(tInstrChannel channel)
+{
+   return &InstrStats[channel];
+}
+
+/**
+*  @fn         InstrGetMean
+*  @param[IN]  channel
+*  @return     mean time, cycles, 0 if no measurements
+*/
+uint32_t InstrGetMean(tInstrChannel channel)
+{
+   if(InstrStats[channel].count == 0)
+      return 0;
+   return (uint32_t)(InstrStats[channel].total / InstrStats[channel].count);
+}
+
+/**
+*  @fn         InstrCyclesToUs
+*  @param[IN]  cycles
+*  @return     microseconds
+*/
+uint32_t InstrCyclesToUs(uint32_t cycles)
+{
+   return cycles / (INSTR_CLOCK / 1000000UL);
+}
+
+#ifndef INSTR_HOST
+/**
+*  @fn         InstrGetFrameFree
+*  @return     per mille of frame time not spent in video interrupts, on average
+*/
+uint16_t InstrGetFrameFree(void)
+{
+   uint32_t frame = INSTR_CLOCK / FRAME_RATE;
+   uint32_t used = InstrGetMean(INSTR_VIDEO_ISR);
+
+   if(used >= frame)
+      return 0;
+   return (uint16_t)(((frame - used) * 1000UL) / frame);
+}
+
+/**
+*  @fn         InstrDrawOverlay
+*  @param[IN]  x coordinate
+*  @param[IN]  y coordinate
+*  @brief      Draws min, mean and max time in us of each channel, plus free frame time
+*/
+void InstrDrawOverlay(uint16_t x, uint16_t y)
+{
+   uint16_t i;
+   uint16_t height = GetTextHeight(OVERLAY_FORMAT);
+   const tInstrStats *p_stats;
+
+   FillRectangle(x, y, x + GetTextLen(OVERLAY_FORMAT) - 1,
+                 y + ((INSTR_NUM_CHANNELS + 1U) * height) - 1, GRAPH_CLEAR);
+
+   for(i = 0; i < INSTR_NUM_CHANNELS; i++)
+   {
+      p_stats = &InstrStats[i];
+      GotoXY(x, y);
+      PutText(ChannelNames[i], GRAPH_SET);
+      if(p_stats->count != 0)
+      {
+         PutText((uint8_t*)" ", GRAPH_SET);
+         PutInt16((uint16_t)InstrCyclesToUs(p_stats->min), GRAPH_SET);
+         PutText((uint8_t*)" ", GRAPH_SET);
+         PutInt16((uint16_t)InstrCyclesToUs(InstrGetMean((tInstrChannel)i)), GRAPH_SET);
+         PutText((uint8_t*)" ", GRAPH_SET);
+         PutInt16((uint16_t)InstrCyclesToUs(p_stats->max), GRAPH_SET);
+      }
+      y += height;
+   }
+
+   GotoXY(x, y);
+   PutText((uint8_t*)"FREE ", GRAPH_SET);
+   PutInt16(InstrGetFrameFree(), GRAPH_SET);
+}
+#endif
+
+/***** Local    functions  ****************************************/
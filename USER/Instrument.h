@@ -0,0 +1,73 @@
+/**
+*  @file   Instrument.h
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Include file for CPU time instrumentation
+*/
+
+#ifndef __INSTRUMENT_H
+#define __INSTRUMENT_H
+
+
+/***** Constants  *************************************************/
+/* Build options */
+//#define INSTRUMENT                /* DWT cycle counts of video interrupts, vblank and drawing */
+//#define INSTR_HOST                /* host build, cycle counter is InstrFakeCycles */
+
+#define INSTR_HIST_BINS       16U   /* bin n counts times of 2^n to 2^(n+1)-1 us */
+
+#ifdef INSTR_HOST
+#define INSTR_CYCLES()        (InstrFakeCycles)
+#define INSTR_CLOCK           56000000UL
+#else
+#define INSTR_CYCLES()        (DWT->CYCCNT)
+#define INSTR_CLOCK           SystemCoreClock
+#endif
+
+/* Time a block of code, INSTR_START must follow the declarations */
+#ifdef INSTRUMENT
+#define INSTR_START(ch)       uint32_t instr_##ch = INSTR_CYCLES()
+#define INSTR_STOP(ch)        InstrRecord(ch, INSTR_CYCLES() - instr_##ch)
+#else
+#define INSTR_START(ch)
+#define INSTR_STOP(ch)
+#endif
+
+/***** Types      *************************************************/
+typedef enum {INSTR_VIDEO_ISR = 0,     /* all video interrupts, per frame  */
+              INSTR_VBLANK,            /* vertical blanking callback       */
+              INSTR_PUT_LINE,
+              INSTR_FILL_RECT,
+              INSTR_PUT_BITMAP,
+              INSTR_PUT_TEXT,
+              INSTR_CLEAR_SCREEN,
+              INSTR_TEXT_MODE,         /* TextModeRender()                 */
+              INSTR_NUM_CHANNELS} tInstrChannel;
+
+typedef struct
+{
+   uint32_t min;                       /* cycles                           */
+   uint32_t max;
+   uint64_t total;
+   uint32_t count;
+   uint16_t hist[INSTR_HIST_BINS];
+} tInstrStats;
+
+/***** Global storage**********************************************/
+#ifdef INSTR_HOST
+extern uint32_t InstrFakeCycles;
+#endif
+
+/***** Exported functions   ***************************************/
+void InstrInit(void);
+void InstrReset(void);
+void InstrRecord(tInstrChannel channel, uint32_t cycles);
+const tInstrStats* InstrGetStats(tInstrChannel channel);
+uint32_t InstrGetMean(tInstrChannel channel);
+uint32_t InstrCyclesToUs(uint32_t cycles);
+#ifndef INSTR_HOST
+uint16_t InstrGetFrameFree(void);
+void InstrDrawOverlay(uint16_t x, uint16_t y);
+#endif
+
+#endif  /*  __INSTRUMENT_H  */
@@ -1,19 +1,19 @@
-/**
-*  @file   Invaders.h
-*  @author Rob Gee
-*  @date   November 2017
-*  @brief  Include file for space invaders game
-*/
-
-#ifndef __INVADERS_H
-#define __INVADERS_H
-
-
-/***** Constants  *************************************************/
-
-/***** Types      *************************************************/
-
-/***** Exported functions   ***************************************/
-void InvadersGame(t_ButtonEvent button_event);
-
-#endif  /*  __INVADERS_H  */
+/**
+*  @file   Invaders.h
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Include file for space invaders game
+*/
+
+#ifndef __INVADERS_H
+#define __INVADERS_H
+
+
+/***** Constants  *************************************************/
+
+/***** Types      *************************************************/
+
+/***** Exported functions   ***************************************/
+void InvadersGame(t_ButtonEvent button_event);
+
+#endif  /*  __INVADERS_H  */
@@ -1,33 +1,33 @@
-/**
-*  @file   Sprites.h
-*  @author Rob Gee
-*  @date   November 2017
-*  @brief  Include file for space invader Sprites
-*/
-#ifndef __SPRITES_H
-#define __SPRITES_H
-
-#include "Graphics.h"
-
-
-
-extern const tImage Invader10pt_1;
-extern const tImage Invader10pt_2;
-extern const tImage Invader20pt_1;
-extern const tImage Invader20pt_2;
-extern const tImage Invader30pt_1;
-extern const tImage Invader30pt_2;
-extern const tImage InvaderExplode;
-extern const tImage Laser;
-extern const tImage LaserExplode1;
-extern const tImage LaserExplode2;
-extern const tImage Missile;
-extern const tImage MissileCross;
-extern const tImage MissileWiggle1;
-extern const tImage MissileWiggle2;
-extern const tImage Shelter;
-extern const tImage Spaceship;
-
-#endif  /* __SPRITES_H */
-
-
+/**
+*  @file   Sprites.h
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Include file for space invader Sprites
+*/
+#ifndef __SPRITES_H
+#define __SPRITES_H
+
+#include "Graphics.h"
+
+
+
+extern const tImage Invader10pt_1;
+extern const tImage Invader10pt_2;
+extern const tImage Invader20pt_1;
+extern const tImage Invader20pt_2;
+extern const tImage Invader30pt_1;
+extern const tImage Invader30pt_2;
+extern const tImage InvaderExplode;
+extern const tImage Laser;
+extern const tImage LaserExplode1;
+extern const tImage LaserExplode2;
+extern const tImage Missile;
+extern const tImage MissileCross;
+extern const tImage MissileWiggle1;
+extern const tImage MissileWiggle2;
+extern const tImage Shelter;
+extern const tImage Spaceship;
+
+#endif  /* __SPRITES_H */
+
+
@@ -1,20 +1,20 @@
-/**
-*  @file   Starfield.h
-*  @author Rob Gee
-*  @date   November 2017
-*  @brief  Include file for starfield simulation
-*/
-
-#ifndef __STARFIELD_H
-#define __STARFIELD_H
-
-
-/***** Constants  *************************************************/
-
-/***** Types      *************************************************/
-
-/***** Exported functions   ***************************************/
-void StarfieldSim(void);
-
-
-#endif  /*  ____STARFIELD_H  */
+/**
+*  @file   Starfield.h
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Include file for starfield simulation
+*/
+
+#ifndef __STARFIELD_H
+#define __STARFIELD_H
+
+
+/***** Constants  *************************************************/
+
+/***** Types      *************************************************/
+
+/***** Exported functions   ***************************************/
+void StarfieldSim(void);
+
+
+#endif  /*  ____STARFIELD_H  */
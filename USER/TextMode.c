@@ -0,0 +1,298 @@
+/**
+*  @file   TextMode.c
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Character cell text mode. The screen is a grid of character
+*          codes, changed cells are marked dirty and only those are
+*          rendered into the frame buffer, a cell at a time, during
+*          vertical blanking. Alternatively in VIDEO_RENDER_LINE mode
+*          TextModeRenderLine() expands the cells for each line as it is
+*          output, with no frame buffer at all.
+*          Glyphs are expanded from a packed font into a RAM cache of one
+*          byte per cell row, so drawing a cell is a byte copy per row
+*/
+
+/***** Include files  *********************************************/
+#include "stm32f10x.h"
+#include <string.h>
+#include "Graphics.h"
+#include "TextMode.h"
+#include "Instrument.h"
+
+/***** Constants  *************************************************/
+#define DIRTY_WORDS     ((TEXTMODE_COLS + 31U) / 32U)
+
+/***** Types      *************************************************/
+
+/***** Storage    *************************************************/
+static uint8_t Cells[TEXTMODE_ROWS][TEXTMODE_COLS];
+static uint32_t DirtyCells[TEXTMODE_ROWS][DIRTY_WORDS];     /* bit n of word w is column (w*32)+n */
+static uint32_t DirtyCellRows = 0;                          /* bit n set if row n has a dirty cell */
+static uint8_t GlyphCache[TEXTMODE_MAX_GLYPHS][TEXTMODE_CELL_HEIGHT];
+static uint8_t FirstCode = 0x20;
+static uint8_t NumGlyphs = 0;
+static uint8_t DefaultGlyph = 0;
+
+/***** Local prototypes    ****************************************/
+static void cacheGlyph(const tPackedFont* p_font, uint8_t index, uint8_t* p_rows);
+static __INLINE void markCell(uint8_t col, uint8_t row);
+static __INLINE const uint8_t* cellGlyph(uint8_t code);
+
+/***** Exported functions  ****************************************/
+
+/**
+*  @fn         TextModeInit
+*  @param[IN]  font, glyphs up to TEXTMODE_CELL_WIDTH by TEXTMODE_CELL_HEIGHT
+*  @return     1 if font fits the cells, 0 otherwise
+*  @brief      Fills glyph cache from font and clears cells. Glyphs are
+*              placed at the top left of their cells
+*/
+uint8_t TextModeInit(const tPackedFont* pFont)
+{
+   uint8_t i;
+
+   if((pFont->max_width > TEXTMODE_CELL_WIDTH) || (pFont->height > TEXTMODE_CELL_HEIGHT))
+      return 0;
+
+   FirstCode = pFont->first;
+   NumGlyphs = pFont->last - pFont->first + 1U;
+   if(NumGlyphs > TEXTMODE_MAX_GLYPHS)
+      NumGlyphs = TEXTMODE_MAX_GLYPHS;
+   DefaultGlyph = pFont->default_char - pFont->first;
+   if(DefaultGlyph >= NumGlyphs)
+      DefaultGlyph = 0;
+
+   memset(GlyphCache, 0, sizeof(GlyphCache));
+   for(i = 0; i < NumGlyphs; i++)
+      cacheGlyph(pFont, i, GlyphCache[i]);
+
+   TextModeClear();
+   return 1;
+}
+
+/**
+*  @fn         TextModeClear
+*  @brief      Sets every cell to space
+*/
+void TextModeClear(void)
+{
+   memset(Cells, ' ', sizeof(Cells));
+   TextModeInvalidate();
+}
+
+/**
+*  @fn         TextModeInvalidate
+*  @brief      Marks every cell dirty, eg. after the frame buffer has been
+*              cleared or drawn over by graphics functions
+*/
+void TextModeInvalidate(void)
+{
+   uint8_t row;
+   uint8_t w;
+
+   for(row = 0; row < TEXTMODE_ROWS; row++)
+   {
+      for(w = 0; w < DIRTY_WORDS; w++)
+         DirtyCells[row][w] = 0xFFFFFFFFUL;
+      DirtyCells[row][DIRTY_WORDS-1U] >>= (DIRTY_WORDS * 32U) - TEXTMODE_COLS;
+   }
+   DirtyCellRows = (1UL << TEXTMODE_ROWS) - 1U;
+}
+
+/**
+*  @fn         TextModePutChar
+*  @param[IN]  column
+*  @param[IN]  row
+*  @param[IN]  character code, OR TEXTMODE_INVERSE for inverse video
+*  @brief      Sets a cell, marking it dirty only if it has changed
+*/
+void TextModePutChar(uint8_t col, uint8_t row, uint8_t code)
+{
+   if((col >= TEXTMODE_COLS) || (row >= TEXTMODE_ROWS))
+      return;
+   if(Cells[row][col] != code)
+   {
+      Cells[row][col] = code;
+      markCell(col, row);
+   }
+}
+
+/**
+*  @fn         TextModePutText
+*  @param[IN]  column of first character
+*  @param[IN]  row
+*  @param[IN]  string
+*  @param[IN]  attribute, 0 or TEXTMODE_INVERSE
+*  @return     Column after last character written
+*  @brief      Writes string along a row, cut at the right edge. Unchanged
+*              characters cost a compare, only changed cells are redrawn
+*/
+uint8_t TextModePutText(uint8_t col, uint8_t row, const uint8_t* str, uint8_t attr)
+{
+   while((*str != 0) && (col < TEXTMODE_COLS))
+      TextModePutChar(col++, row, *str++ | attr);
+   return col;
+}
+
+/**
+*  @fn         TextModeRender
+*  @param[IN]  most cells to render
+*  @return     Number of cells rendered
+*  @brief      Renders dirty cells into the draw buffer, top row first.
+*              Cells left over are rendered by the next call. Cells outside
+*              the current video mode are dropped
+*/
+uint16_t TextModeRender(uint16_t max_cells)
+{
+   uint16_t count = 0;
+   uint16_t row_count;
+   uint16_t stride = pVideoMode->stride;
+   uint8_t  cols = (pVideoMode->line_bytes < TEXTMODE_COLS) ? pVideoMode->line_bytes : TEXTMODE_COLS;
+   uint16_t rows = pVideoMode->height / TEXTMODE_CELL_HEIGHT;
+   uint8_t  row;
+   uint8_t  col;
+   uint8_t  w;
+   uint8_t  r;
+   uint8_t  inverse;
+   uint32_t dirty;
+   uint32_t any;
+   const uint8_t* p_glyph;
+   uint8_t* p_fb;
+   INSTR_START(INSTR_TEXT_MODE);
+
+   for(row = 0; (row < TEXTMODE_ROWS) && (DirtyCellRows != 0) && (count < max_cells); row++)
+   {
+      if((DirtyCellRows & (1UL << row)) == 0)
+         continue;
+
+      row_count = count;
+      for(w = 0; (w < DIRTY_WORDS) && (count < max_cells); w++)
+      {
+         dirty = DirtyCells[row][w];
+         while((dirty != 0) && (count < max_cells))
+         {
+            /* Lowest dirty column */
+            col = (uint8_t)((w * 32U) + (31U - __CLZ(dirty & (0U - dirty))));
+            dirty &= dirty - 1U;
+            if((row < rows) && (col < cols))
+            {
+               p_glyph = cellGlyph(Cells[row][col]);
+               inverse = ((Cells[row][col] & TEXTMODE_INVERSE) != 0) ? 0xFF : 0x00;
+               p_fb = &pDrawBuff[(row * TEXTMODE_CELL_HEIGHT * stride) + col];
+               for(r = 0; r < TEXTMODE_CELL_HEIGHT; r++, p_fb += stride)
+                  *p_fb = p_glyph[r] ^ inverse;
+               count++;
+            }
+         }
+         DirtyCells[row][w] = dirty;
+      }
+
+      if(count != row_count)
+      {
+         VideoMarkDirty(row * TEXTMODE_CELL_HEIGHT, TEXTMODE_CELL_HEIGHT);
+      }
+
+      /* Row is clean once every column has been rendered */
+      for(w = 0, any = 0; w < DIRTY_WORDS; w++)
+         any |= DirtyCells[row][w];
+      if(any == 0)
+         DirtyCellRows &= ~(1UL << row);
+   }
+
+   INSTR_STOP(INSTR_TEXT_MODE);
+   return count;
+}
+
+/**
+*  @fn     TextModeTick
+*  @brief  Call every tick, renders up to TEXTMODE_CELLS_PER_TICK dirty cells
+*          while vertical blanking is active
+*/
+void TextModeTick(void)
+{
+   if((DirtyCellRows != 0) && (IsVblankActive() != 0))
+      TextModeRender(TEXTMODE_CELLS_PER_TICK);
+}
+
+/**
+*  @fn         TextModeRenderLine
+*  @param[IN]  buffer row
+*  @param[OUT] line of pixel data
+*  @brief      Line render callback for VIDEO_RENDER_LINE mode, expands the
+*              cells of a line from the glyph cache. Install with
+*              setLineRenderCallback(), dirty cells are then not used
+*/
+void TextModeRenderLine(uint16_t line, uint8_t* pLine)
+{
+   uint8_t cols = (pVideoMode->line_bytes < TEXTMODE_COLS) ? pVideoMode->line_bytes : TEXTMODE_COLS;
+   uint16_t row = line / TEXTMODE_CELL_HEIGHT;
+   uint8_t  r = (uint8_t)(line - (row * TEXTMODE_CELL_HEIGHT));
+   const uint8_t* p_cell;
+   uint8_t col;
+
+   if(row >= TEXTMODE_ROWS)
+   {
+      memset(pLine, 0, pVideoMode->line_bytes);
+      return;
+   }
+
+   p_cell = Cells[row];
+   for(col = 0; col < cols; col++, p_cell++)
+      pLine[col] = cellGlyph(*p_cell)[r] ^ (((*p_cell & TEXTMODE_INVERSE) != 0) ? 0xFF : 0x00);
+   if(cols < pVideoMode->line_bytes)
+      memset(&pLine[cols], 0, pVideoMode->line_bytes - cols);
+}
+
+/***** Local    functions  ****************************************/
+
+/**
+*  @fn         cacheGlyph
+*  @param[IN]  font
+*  @param[IN]  glyph index, code - first code of font
+*  @param[OUT] one byte per row, pixels left aligned
+*  @brief      Unpacks a glyph from the font bit stream
+*/
+static void cacheGlyph(const tPackedFont* p_font, uint8_t index, uint8_t* p_rows)
+{
+   uint8_t  width = p_font->widths[index];
+   uint32_t bit = p_font->offsets[index];
+   uint16_t bits;
+   uint8_t  r;
+
+   if(width == 0)
+      return;
+
+   for(r = 0; r < p_font->height; r++, bit += width)
+   {
+      /* Row may span two bytes of the stream */
+      bits = (uint16_t)p_font->bits[bit >> 3] << 8;
+      if(((bit & 7U) + width) > 8U)
+         bits |= p_font->bits[(bit >> 3) + 1U];
+      p_rows[r] = (uint8_t)((bits << (bit & 7U)) >> 8) & (uint8_t)(0xFF00 >> width);
+   }
+}
+
+/**
+*  @fn         markCell
+*  @param[IN]  column
+*  @param[IN]  row
+*/
+static __INLINE void markCell(uint8_t col, uint8_t row)
+{
+   DirtyCells[row][col >> 5] |= 1UL << (col & 31U);
+   DirtyCellRows |= 1UL << row;
+}
+
+/**
+*  @fn         cellGlyph
+*  @param[IN]  cell contents
+*  @return     cached glyph, the default glyph for codes not in the cache
+*/
+static __INLINE const uint8_t* cellGlyph(uint8_t code)
+{
+   uint8_t i = (code & (uint8_t)~TEXTMODE_INVERSE) - FirstCode;
+
+   if(i >= NumGlyphs)
+      i = DefaultGlyph;
+   return GlyphCache[i];
+}
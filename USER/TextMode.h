@@ -0,0 +1,35 @@
+/**
+*  @file   TextMode.h
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Include file for character cell text mode
+*/
+
+#ifndef __TEXTMODE_H
+#define __TEXTMODE_H
+
+#include "fonts.h"
+
+/***** Constants  *************************************************/
+#define TEXTMODE_COLS            40U   /* 8 pixel cells across 320 pixels */
+#define TEXTMODE_ROWS            17U   /* 14 pixel cells down 240 rows    */
+#define TEXTMODE_CELL_WIDTH      8U
+#define TEXTMODE_CELL_HEIGHT     14U
+#define TEXTMODE_MAX_GLYPHS      96U   /* glyph cache, from first code of font */
+#define TEXTMODE_CELLS_PER_TICK  64U   /* cells rendered by each TextModeTick() in vblank */
+
+#define TEXTMODE_INVERSE         0x80U /* OR with a character code for inverse video */
+
+/***** Types      *************************************************/
+
+/***** Exported functions   ***************************************/
+uint8_t TextModeInit(const tPackedFont* pFont);
+void TextModeClear(void);
+void TextModeInvalidate(void);
+void TextModePutChar(uint8_t col, uint8_t row, uint8_t code);
+uint8_t TextModePutText(uint8_t col, uint8_t row, const uint8_t* str, uint8_t attr);
+uint16_t TextModeRender(uint16_t max_cells);
+void TextModeTick(void);
+void TextModeRenderLine(uint16_t line, uint8_t* pLine);
+
+#endif  /*  __TEXTMODE_H  */
@@ -1,459 +1,1113 @@
-/**
-*  @file   Video.c
-*  @author Rob Gee
-*  @date   November 2017
-*  @brief  compositite video signal generator, for STM32
-*/
-
-/***** Include files  *********************************************/
-#include "stm32f10x.h"
-#include "bsp.h"
-#include "Video.h"
-
-/***** Constants  *************************************************/
-
-/*   PAL constants      */
-#define SCANLINE_US        (1000000UL/(625UL * (FRAME_RATE/2)))
-#define SCANFREQ           ((1000000UL)/SCANLINE_US)        /* line frequency */
-
-/* NB the following times all in ns */
-#define H_SYNC             4700UL
-#define LONG_SYNC_GAP      (H_SYNC)
-#define LONG_SYNC          ((SCANLINE_US*500UL)-LONG_SYNC_GAP)
-#define SHORT_SYNC         (H_SYNC/2UL)
-#define BACK_PORCH         5700UL
-#define FRONT_PORCH        1650UL
-#define BACK_PORCH         5700UL
-#define TEXT_OFFSET        3400UL
-//#define TEXT_WIDTH         45715UL
-#define TEXT_WIDTH         (((NUM_X_PIXELS*1000000UL)+(SPI_CLOCK/2000UL))/(SPI_CLOCK/1000UL))
-#define TEXT_START         (BACK_PORCH+TEXT_OFFSET)
-#define TEXT_END           (TEXT_START+TEXT_WIDTH)
-#define FIRST_ACTIVE_LINE  6U          /* Inbetween these are teletext data */
-#define NUM_LINES          NUM_Y_PIXELS
-#define DISP_START_LINE    23U
-#define TEXT_START_LINE    49U
-#define TEXT_END_LINE      (TEXT_START_LINE+NUM_LINES-1U)
-#define DISP_END_LINE      309U
-#define LAST_ACTIVE_LINE   309U
-
-/* NB During frame sync and short sync sections, increase PWM freq to 2X line freq   */
-#define NUM_BROAD_SYNC        5U
-#define NUM_PRE_FRAME_SYNC    5U
-#define NUM_POST_FRAME_SYNC   6U
-
-/* STM32 timing constants */
-#define AHB2_CLOCK      56000000UL
-#define AHB1_CLOCK      28000000UL
-#define TIMER_PSC       7UL
-#define TIMER_CLOCK     (AHB2_CLOCK/TIMER_PSC)
-#define TIMER_ARR       (TIMER_CLOCK/SCANFREQ)
-#define TIMER_ARR_SYNC  (TIMER_ARR/2UL)
-#define TIMER_TICK      ((1000000000UL)/TIMER_CLOCK)
-#define SPI_PSC         4
-#define SPI_CLOCK       (AHB1_CLOCK/SPI_PSC)
-
-#define TIMER_TICKS(ns) (((ns)+(TIMER_TICK/2))/TIMER_TICK)
-
-/* STM32 peripheral constants  */
-#define DMA_CHAN_SPI2_TX   DMA1_Channel5
-
-/* Test patterns  */
-//#define TEST_PATTERN_ACTIVE
-#define TEST_HATCH_SIZE    20
-
-#define TIMING_TEST
-
-/***** Types      *************************************************/
-typedef enum {FRAME_SYNC, PRE_FRAME_SHORT, FRAME_ACTIVE, POST_FRAME_SHORT} Sync_State_e;
-
-/***** Storage    *************************************************/
-uint8_t FrameBuff[NUM_Y_PIXELS][NUM_X_BYTES] = {0};      /* Extra zero byte at end */
-
-static void (*pVerticalBlankingCallback)(uint8_t) = 0;
-
-/***** Local prototypes    ****************************************/
-static void GPIO_Configuration(void);
-static void TIM_Configuration(void);
-static void NVIC_Configuration(void);
-static void SPI_Configuration(void);
-static void DMA_Configuration(void);
-static void TriggerLine(uint16_t line);
-#ifdef TEST_PATTERN_ACTIVE
-static void GenerateScreenTest(void);
-#endif
-#ifdef TEST
-static void SPI_Test(void);
-#endif
-
-
-/***** Exported functions  ****************************************/
-/**
-*  @fn     VideoInit
-*  @brief  Initialises Video generator
-*/
-void VideoInit(void)
-{
-   #ifdef TEST
-   volatile uint32_t test;
-   test = TEXT_WIDTH;
-   test = NUM_LINES;
-   test = SPI_CLOCK;
-   test = TEXT_WIDTH;
-   test = NUM_X_PIXELS;
-   #endif
-
-   #ifdef TEST_PATTERN_ACTIVE
-   GenerateScreenTest();
-   #endif
-
-   GPIO_Configuration();
-   NVIC_Configuration();
-   SPI_Configuration();
-
-   DMA_Configuration();
-   TIM_Configuration();
-
-}
-
-/**
-*  @fn     setVerticalBlankingCallback
-*  @brief  Sets call back function for vertical blanking event
-*/
-void setVerticalBlankingCallback(void (*pCallback)(uint8_t))
-{
-   pVerticalBlankingCallback = pCallback;
-}
-
-/***** Local    functions  ****************************************/
-
-/**
-*  @fn     TIM1_CC_IRQHandler
-*  @brief  Interrupt handler for timer CC event
-*/
-void TIM1_CC_IRQHandler(void)
-{    
-   static Sync_State_e sync_state = FRAME_SYNC;
-   static uint16_t scan_line_count;
-   static uint16_t display_line_count;
-   static uint16_t pulse_count = 0;
-
-//   DBGMCU->CR |= DBGMCU_CR_DBG_TIM1_STOP;    /* stop timer 1 in debug mode */
-
-   if(TIM_GetITStatus(TIM1 , TIM_IT_CC1) != RESET)
-   {
-      TIM_ClearITPendingBit(TIM1 , TIM_FLAG_CC1);
-      switch(sync_state)
-      {
-         case FRAME_SYNC:
-            if(++pulse_count >= NUM_BROAD_SYNC)
-            {
-               TIM1->CCR1 = TIMER_TICKS(SHORT_SYNC);
-               sync_state = PRE_FRAME_SHORT;
-               pulse_count = 0;
-            }
-         break;
-
-         case PRE_FRAME_SHORT:
-            if(++pulse_count >= NUM_PRE_FRAME_SYNC)
-            {
-               TIM1->CCR1 = TIMER_TICKS(H_SYNC);
-               TIM1->ARR = TIMER_ARR;
-               sync_state = FRAME_ACTIVE;
-               scan_line_count = FIRST_ACTIVE_LINE;
-               display_line_count = 0;
-            }
-         break;
-
-         case FRAME_ACTIVE:
-            if(scan_line_count >= LAST_ACTIVE_LINE)
-            {
-               TIM1->CCR1 = TIMER_TICKS(SHORT_SYNC);
-               TIM1->ARR = TIMER_ARR_SYNC;
-               pulse_count = 0;
-               sync_state = POST_FRAME_SHORT;
-            }
-            /* Placemarker for vertical blanking interval - with present numbers we can have
-               72 lines or 4.6ms */
-            else if(scan_line_count == (TEXT_START_LINE-1))
-            {
-               /* TODO add call back for end of blanking interval  */
-               if(pVerticalBlankingCallback != 0)
-               {
-                  pVerticalBlankingCallback(0);
-                  #ifdef TIMING_TEST
-                  GPIO_SetBits(DEBUG_PORT, DEBUG_PIN_2);
-                  #endif
-               }
-            }
-            else if(scan_line_count == (TEXT_END_LINE+1))
-            {
-               /* TODO add callback for start of blanking interval */
-               if(pVerticalBlankingCallback != 0)
-               {
-                  pVerticalBlankingCallback(1);
-                  #ifdef TIMING_TEST
-                  GPIO_ResetBits(DEBUG_PORT, DEBUG_PIN_2);
-                  #endif
-               }
-            }
-            scan_line_count++;
-         break;
-
-         case POST_FRAME_SHORT:
-            if(++pulse_count >= NUM_POST_FRAME_SYNC)
-            {
-               TIM1->CCR1 = TIMER_TICKS(LONG_SYNC);
-               sync_state = FRAME_SYNC;
-               pulse_count = 0;
-            }
-         break;
-      }
-   }
-   else if(TIM_GetITStatus(TIM1 , TIM_IT_CC2) != RESET)
-   {
-      TIM_ClearITPendingBit(TIM1 , TIM_FLAG_CC2);
-      if((scan_line_count >= TEXT_START_LINE) && (scan_line_count <= TEXT_END_LINE))
-      {
-         TriggerLine(display_line_count++);
-      }
-
-   }
-}
-
-
-/**
-*  @fn     TIM1_CC_IRQHandler
-*  @brief  Interrupt handler for timer CC event
-*/
-void DMA1_Channel5_IRQHandler(void)
-{
-   if(DMA_GetITStatus(DMA1_IT_TC5) != RESET)
-   {
-      DMA_ClearITPendingBit(DMA1_IT_TC5);
-      DMA_Cmd(DMA_CHAN_SPI2_TX, DISABLE);
-      while((SPI2->SR & SPI_SR_TXE) == 0);
-      SPI2->DR = 0;
-   }
-}
-
-/**
-*  @fn     GPIO_Configuration
-*  @brief  Set up sync output
-*/
-static void GPIO_Configuration(void)
-{
-   GPIO_InitTypeDef GPIO_InitStructure = {0};
-
-   RCC_APB2PeriphClockCmd( RCC_APB2Periph_GPIOA | RCC_APB2Periph_GPIOB | RCC_APB2Periph_AFIO, ENABLE); 						 
-
-  /* Timer1 channel 1 PA8  */
-   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_8;
-   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
-   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF_PP; ; 
-   GPIO_Init(GPIOA, &GPIO_InitStructure);
-
-   /* SPI2 MOSI - PB15     */
-   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_15;
-   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
-   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF_PP; ; 
-   GPIO_Init(GPIOB, &GPIO_InitStructure);
-
-}
-
-
-/**
-*  @fn     TIM_Configuration
-*  @brief  Configure timer used for sync generation
-*/
-static void TIM_Configuration(void)
-{
-   TIM_TimeBaseInitTypeDef  TIM_TimeBaseStructure = {0};
-   TIM_OCInitTypeDef        TIM_OCInitStructure = {0};
-   
-   RCC_APB2PeriphClockCmd(RCC_APB2Periph_TIM1 , ENABLE);
-   TIM_DeInit(TIM1);
-   TIM_TimeBaseStructure.TIM_Period=TIMER_ARR_SYNC;
-   												
-   TIM_TimeBaseStructure.TIM_Prescaler= TIMER_PSC-1;
-   TIM_TimeBaseStructure.TIM_ClockDivision=TIM_CKD_DIV1; 
-   TIM_TimeBaseStructure.TIM_CounterMode=TIM_CounterMode_Up;
-   TIM_TimeBaseInit(TIM1, &TIM_TimeBaseStructure);
-   TIM_ClearFlag(TIM1, TIM_FLAG_Update);						
-   TIM_ITConfig(TIM1,(TIM_IT_CC1 | TIM_IT_CC2),ENABLE);
-   
-   TIM_ARRPreloadConfig(TIM1, ENABLE);
-   
-   /* Enable PWM = Channel 1 generates sync */
-   TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_PWM1;
-   TIM_OCInitStructure.TIM_OutputState = TIM_OutputState_Enable;
-   TIM_OCInitStructure.TIM_Pulse = TIMER_TICKS(LONG_SYNC);
-   TIM_OCInitStructure.TIM_OCPolarity = TIM_OCPolarity_Low;
-   
-   TIM_OC1Init(TIM1, &TIM_OCInitStructure);
-   TIM_OC1PreloadConfig(TIM1, TIM_OCPreload_Enable);
-
-   /* PWM channel 2 generates DMA trigger for pixel data */
-   TIM_OCInitStructure.TIM_OCPolarity = TIM_OCPolarity_High;
-   TIM_OCInitStructure.TIM_OCPolarity = TIM_OCPolarity_Low;
-   TIM_OCInitStructure.TIM_Pulse = TIMER_TICKS(TEXT_START);
- 
-   TIM_OC2Init(TIM1, &TIM_OCInitStructure);
-   TIM_OC2PreloadConfig(TIM1, TIM_OCPreload_Enable);
-
-   /* Configure DMA trigger, on CCR2  */
-//   TIM_DMAConfig(TIM1, TIM_DMABase_CCR2, TIM_DMABurstLength_1Byte);
-//   TIM_DMACmd(TIM1, TIM_DMA_CC2, ENABLE);
-   
-   TIM_CtrlPWMOutputs(TIM1, ENABLE);
-   TIM_Cmd(TIM1, ENABLE);			
-}
-
-/**
-*  @fn     NVIC_Configuration
-*  @brief  Configure NVIC
-*/
-static void NVIC_Configuration(void)
-{
-   NVIC_InitTypeDef NVIC_InitStructure; 
-    
-   NVIC_PriorityGroupConfig(NVIC_PriorityGroup_0);  													
-   NVIC_InitStructure.NVIC_IRQChannel = TIM1_CC_IRQn;	  
-   NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0;
-   NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;	
-   NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
-   NVIC_Init(&NVIC_InitStructure);
-   
-   NVIC_InitStructure.NVIC_IRQChannel = DMA1_Channel5_IRQn;
-   NVIC_Init(&NVIC_InitStructure);
-}
-
-/**
-*  @fn     SPI_Configuration
-*  @brief  Configure SPI
-*/
-static void SPI_Configuration(void)
-{
-   SPI_InitTypeDef  SPI_InitStructure;
-
-   RCC_APB1PeriphClockCmd(RCC_APB1Periph_SPI2 , ENABLE);
-
-   SPI_InitStructure.SPI_Direction = SPI_Direction_1Line_Tx;
-   SPI_InitStructure.SPI_Mode = SPI_Mode_Master;
-   SPI_InitStructure.SPI_DataSize = SPI_DataSize_8b;
-   SPI_InitStructure.SPI_CPOL = SPI_CPOL_High;
-   SPI_InitStructure.SPI_CPHA = SPI_CPHA_1Edge;
-   SPI_InitStructure.SPI_NSS = SPI_NSS_Soft;
-   SPI_InitStructure.SPI_BaudRatePrescaler = SPI_BaudRatePrescaler_4;
-   SPI_InitStructure.SPI_FirstBit = SPI_FirstBit_MSB;
-   SPI_InitStructure.SPI_CRCPolynomial = 7;
-   SPI_Init(SPI2, &SPI_InitStructure);
-
-   /* Enable SPI2 Tx request */
-   SPI_I2S_DMACmd(SPI2, SPI_I2S_DMAReq_Tx, ENABLE);
-
-   /* Enable SPI2  */
-   SPI_Cmd(SPI2, ENABLE);
-}
-
-/**
-*  @fn     DMA_Configuration
-*  @brief  Configure DMA
-*/
-static void DMA_Configuration(void)
-{
-   DMA_InitTypeDef  DMA_InitStructure;
-
-   RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1 , ENABLE);
-
-   DMA_DeInit(DMA_CHAN_SPI2_TX);
-   DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&SPI2->DR;
-   DMA_InitStructure.DMA_MemoryBaseAddr = (uint32_t)FrameBuff;
-   DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralDST;
-   DMA_InitStructure.DMA_BufferSize = NUM_X_BYTES;
-   DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
-   DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
-   DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
-   DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
-   DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
-   DMA_InitStructure.DMA_Priority = DMA_Priority_VeryHigh;
-   DMA_InitStructure.DMA_M2M = DMA_M2M_Disable;
-   DMA_ITConfig(DMA_CHAN_SPI2_TX, DMA_CCR5_TCIE, ENABLE); 
-   DMA_Init(DMA_CHAN_SPI2_TX, &DMA_InitStructure);
-}
-
-
-/**
-*  @fn        TriggerLine
-*  @brief     Initiates output of a scan line
-*  @param[IN] line number
-*/
-static void TriggerLine(uint16_t line)
-{
-   DMA_CHAN_SPI2_TX->CMAR = (uint32_t)&FrameBuff[line][0];
-   DMA_CHAN_SPI2_TX->CNDTR = NUM_X_BYTES;
-   DMA_Cmd(DMA_CHAN_SPI2_TX, ENABLE);
-   SPI2->DR = FrameBuff[line][0];
-}
-
-#ifdef TEST_PATTERN_ACTIVE
-/**
-*  @fn        GenerateScreenTest
-*  @brief     Generates cross hatch pattern
-*/
-static void GenerateScreenTest(void)
-{
-   uint16_t x,y;
-   uint8_t byte;
- 
-   for(y = 0; y < NUM_Y_PIXELS; y++)
-   {
-      for(x = 0; x < NUM_X_BYTES; x++)
-      {
-         if( ((y % 16) == 0) || (y == NUM_Y_PIXELS-1))
-         {
-            byte = 0xf0;
-         }
-         else if (x == NUM_X_BYTES-1)
-         {
-//            byte = 0x01;
-            byte = 0xF0;
-         }
-         else if( ((x % 2) == 0) || (x == 0))
-         {
-//            byte = 0x80;   
-            byte = 0xF0;   
-         }
-         else
-         {
-            byte = 0;
-         }
-         FrameBuff[y][x] = byte;
-      }
-   }
-}
-#endif
-
-#ifdef TEST
-/**
-*  @fn        SPI_Test
-*  @brief     Sends a single line directly via SPI
-*/
-static void SPI_Test(void)
-{
-   uint8_t i;
-
-   for(i = 0; i < NUM_X_BYTES; i++)
-   {
-      /* Wait for SPI2 Tx buffer empty */
-      while (SPI_I2S_GetFlagStatus(SPI2, SPI_I2S_FLAG_TXE) == RESET);
-      /* Send SPI2 data */
-      SPI_I2S_SendData(SPI2, FrameBuff[0][i]);
-      
-   }
-}
-#endif
-
-
-
-
+/**
+*  @file   Video.c
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  compositite video signal generator, for STM32
+*/
+
+/***** Include files  *********************************************/
+#include "stm32f10x.h"
+#include "bsp.h"
+#include "Video.h"
+#include "Instrument.h"
+
+/***** Constants  *************************************************/
+#ifdef INSTRUMENT
+#define VIDEO_ISR_STATS          /* per frame interrupt time feeds instrumentation */
+#endif
+
+/*   PAL constants, 312 lines non-interlaced   */
+#define PAL_FRAME_RATE           50U
+#define PAL_SCANLINE             64000UL     /* ns */
+#define PAL_NUM_SCAN_LINES       312U
+#define PAL_FIRST_ACTIVE_LINE    6U          /* Inbetween these are teletext data */
+#define PAL_LAST_ACTIVE_LINE     309U
+#define PAL_TEXT_START_LINE      49U
+#define PAL_TEXT_START           (BACK_PORCH+TEXT_OFFSET)
+/* NB During frame sync and short sync sections, increase PWM freq to 2X line freq   */
+#define PAL_NUM_BROAD_SYNC       5U
+#define PAL_NUM_PRE_FRAME_SYNC   5U
+#define PAL_NUM_POST_FRAME_SYNC  6U
+
+/*   NTSC constants, 262 lines non-interlaced, line numbers as per standard  */
+#define NTSC_FRAME_RATE          60U
+#define NTSC_SCANLINE            63556UL     /* ns */
+#define NTSC_NUM_SCAN_LINES      262U
+#define NTSC_FIRST_ACTIVE_LINE   10U
+#define NTSC_LAST_ACTIVE_LINE    262U
+#define NTSC_TEXT_START_LINE     21U
+#define NTSC_TEXT_START          (PAL_TEXT_START-800UL)   /* NTSC blanking ends 0.8us earlier */
+#define NTSC_NUM_BROAD_SYNC      6U
+#define NTSC_NUM_PRE_FRAME_SYNC  6U          /* equalising pulses */
+#define NTSC_NUM_POST_FRAME_SYNC 6U
+
+/* NB the following times all in ns */
+#define H_SYNC             4700UL
+#define LONG_SYNC_GAP      (H_SYNC)
+#define LONG_SYNC(line)    (((line)/2UL)-LONG_SYNC_GAP)
+#define SHORT_SYNC         (H_SYNC/2UL)
+#define BACK_PORCH         5700UL
+#define FRONT_PORCH        1650UL
+#define BACK_PORCH         5700UL
+#define TEXT_OFFSET        3400UL
+//#define TEXT_WIDTH         45715UL
+#define TEXT_WIDTH         (((NUM_X_PIXELS*1000000UL)+(SPI_CLOCK/2000UL))/(SPI_CLOCK/1000UL))
+#define NUM_LINES          NUM_Y_PIXELS
+#define LINE_RENDER_START  (pVideoMode->first_line-VIDEO_LINE_RING-1U)   /* start filling line ring */
+
+/* STM32 timing constants */
+#define AHB2_CLOCK      56000000UL
+#define AHB1_CLOCK      28000000UL
+#define TIMER_PSC       7UL
+#define TIMER_CLOCK     (AHB2_CLOCK/TIMER_PSC)
+#define TIMER_TICK      ((1000000000UL)/TIMER_CLOCK)
+#define SPI_PSC         4
+#define SPI_CLOCK       (AHB1_CLOCK/SPI_PSC)
+
+#define TIMER_TICKS(ns) (((ns)+(TIMER_TICK/2))/TIMER_TICK)
+
+/* Timing profile for each TV standard */
+#define VIDEO_TIMING(std) \
+         {std##_FRAME_RATE, TIMER_TICKS(std##_SCANLINE), TIMER_TICKS(LONG_SYNC(std##_SCANLINE)), \
+          std##_NUM_BROAD_SYNC, std##_NUM_PRE_FRAME_SYNC, std##_NUM_POST_FRAME_SYNC, \
+          std##_FIRST_ACTIVE_LINE, std##_LAST_ACTIVE_LINE}
+
+/* Sync pulses are half lines, so check they plus the active lines make a whole field,
+   and that the field rate is within 0.5% of nominal */
+#define TIMING_FITS(std) \
+         (((std##_NUM_BROAD_SYNC+std##_NUM_PRE_FRAME_SYNC+std##_NUM_POST_FRAME_SYNC+ \
+            (2U*(std##_LAST_ACTIVE_LINE-std##_FIRST_ACTIVE_LINE+1U))) == (2U*std##_NUM_SCAN_LINES)) && \
+          ((std##_NUM_SCAN_LINES*TIMER_TICKS(std##_SCANLINE)*std##_FRAME_RATE) >= ((995UL*1000000UL)/TIMER_TICK)) && \
+          ((std##_NUM_SCAN_LINES*TIMER_TICKS(std##_SCANLINE)*std##_FRAME_RATE) <= ((1005UL*1000000UL)/TIMER_TICK)))
+
+#if !TIMING_FITS(PAL) || !TIMING_FITS(NTSC)
+#error "Video timing profile does not make up a field"
+#endif
+
+/* Video mode timing, modes are centred on the default 320x240 picture area */
+#define MODE_WIDTH_NS(px, psc)         ((((px)*1000000UL)+((AHB1_CLOCK/(psc))/2000UL))/((AHB1_CLOCK/(psc))/1000UL))
+#define MODE_START_NS(std, px, psc)    (std##_TEXT_START+((TEXT_WIDTH-MODE_WIDTH_NS(px, psc))/2UL))
+#define MODE_FIRST_LINE(std, h, rep)   (std##_TEXT_START_LINE+((NUM_LINES-((h)*(rep)))/2U))
+#define MODE_LAST_LINE(std, h, rep)    (MODE_FIRST_LINE(std, h, rep)+((h)*(rep))-1U)
+/* Interlaced modes scan out half their rows in each field */
+#define MODE_FITS(std, px, h, rep, psc, il) \
+         (((TIMER_TICKS(MODE_START_NS(std, px, psc))+TIMER_TICKS(MODE_WIDTH_NS(px, psc))) <= \
+            (TIMER_TICKS(std##_SCANLINE)-TIMER_TICKS(FRONT_PORCH))) && \
+          (MODE_START_NS(std, px, psc) >= std##_TEXT_START) && \
+          ((MODE_FIRST_LINE(std, (h)>>(il), rep)-VIDEO_LINE_RING-1U) > std##_FIRST_ACTIVE_LINE) && \
+          ((MODE_LAST_LINE(std, (h)>>(il), rep)+1U) < std##_LAST_ACTIVE_LINE) && \
+          (((px)/8U) <= VIDEO_MAX_LINE_BYTES))
+/* Each row is followed by a zero byte, sent by the line DMA to blank the line tail */
+#define MODE_BUFF_FITS(px, h)          (((((px)/8U)+1U)*(h) <= VIDEO_BUFF_SIZE) && ((h) <= VIDEO_MAX_ROWS))
+#define VIDEO_MODE(std, px, h, rep, psc, il) \
+         {px, h, ((px)/8U)+1U, (px)/8U, rep, il, SPI_BaudRatePrescaler_##psc, TIMER_TICKS(MODE_START_NS(std, px, psc)), \
+          MODE_FIRST_LINE(std, (h)>>(il), rep), MODE_LAST_LINE(std, (h)>>(il), rep)},
+
+/* Every mode in tVideoModeId order, as M(std, width, height, line repeat, SPI prescaler, interlace) */
+#define VIDEO_MODE_LIST(M, std) \
+         M(std, 320U, 240U, 1U, 4, 0U)     /* VIDEO_MODE_320x240, default   */ \
+         M(std, 320U, 120U, 2U, 4, 0U)     /* VIDEO_MODE_320x120, 4.8KB     */ \
+         M(std, 256U, 192U, 1U, 4, 0U)     /* VIDEO_MODE_256x192, 6.2KB     */ \
+         M(std, 400U, 240U, 1U, 2, 0U)     /* VIDEO_MODE_400x240, 12KB      */ \
+         M(std, 320U, 480U, 1U, 4, 1U)     /* VIDEO_MODE_320x480I, 19.2KB   */ \
+         M(std, 256U, 384U, 1U, 4, 1U)     /* VIDEO_MODE_256x384I, 12.4KB   */
+#define VIDEO_MODES(std)               {VIDEO_MODE_LIST(VIDEO_MODE, std)}
+#define MODE_FITS_AND(std, px, h, rep, psc, il)   MODE_FITS(std, px, h, rep, psc, il) &&
+#define MODES_FIT(std)                 (VIDEO_MODE_LIST(MODE_FITS_AND, std) 1)
+
+/* Check every mode in the table fits within line and frame timing of each standard */
+#if !MODES_FIT(PAL) || !MODES_FIT(NTSC)
+#error "Video mode does not fit within line or frame timing"
+#endif
+
+/* The default mode is set up before any call to VideoSetMode(), so must fit the
+   buffer. VideoSetMode() turns down the larger modes unless the build sizes it for them */
+#if !MODE_BUFF_FITS(320U, 240U)
+#error "VIDEO_BUFF_SIZE or VIDEO_MAX_ROWS too small for the default video mode"
+#endif
+
+/* STM32 peripheral constants  */
+#define DMA_CHAN_SPI2_TX   DMA1_Channel5
+#define DMA_CHAN_TIM1_CC2  DMA1_Channel3
+#define DMA_CHAN_M2M       DMA1_Channel1
+#define DMA_FLAG_M2M_TC    DMA1_FLAG_TC1
+
+/* Test patterns  */
+//#define TEST_PATTERN_ACTIVE
+#define TEST_HATCH_SIZE    20
+
+#define TIMING_TEST
+
+/***** Types      *************************************************/
+typedef enum {FRAME_SYNC, PRE_FRAME_SHORT, FRAME_ACTIVE, POST_FRAME_SHORT} Sync_State_e;
+
+/***** Storage    *************************************************/
+uint8_t FrameBuff[VIDEO_BUFF_SIZE] __attribute__((aligned(4))) = {0};   /* Extra zero byte at end of each row */
+
+static const tVideoTiming VideoTimings[VIDEO_NUM_STANDARDS] = {
+      VIDEO_TIMING(PAL),
+      VIDEO_TIMING(NTSC)
+      };
+
+static const tVideoMode VideoModes[VIDEO_NUM_STANDARDS][VIDEO_NUM_MODES] = {
+      VIDEO_MODES(PAL),
+      VIDEO_MODES(NTSC)
+      };
+
+const tVideoTiming *pVideoTiming = &VideoTimings[VIDEO_STANDARD_PAL];
+const tVideoMode * volatile pVideoMode = &VideoModes[VIDEO_STANDARD_PAL][VIDEO_MODE_320x240];
+static const tVideoMode *pModeTable = VideoModes[VIDEO_STANDARD_PAL];
+static const tVideoMode * volatile pNextMode = 0;
+
+#ifdef VIDEO_DOUBLE_BUFFER
+static uint8_t BackBuff[VIDEO_BUFF_SIZE] __attribute__((aligned(4))) = {0};
+
+uint8_t * volatile pDrawBuff = BackBuff;
+static uint8_t * volatile pScanBuff = FrameBuff;
+static volatile uint8_t swapPending = 0;
+#else
+#define pScanBuff          FrameBuff
+#endif
+
+#ifdef VIDEO_DIRTY_ROWS
+#if ((VIDEO_BUFF_SIZE % 4U) != 0)
+#error "Dirty row copy uses word transfers, VIDEO_BUFF_SIZE must be a multiple of 4"
+#endif
+uint8_t BackBuff[VIDEO_BUFF_SIZE] __attribute__((aligned(4))) = {0};
+uint32_t DirtyRows[(VIDEO_MAX_ROWS+31U)/32U] = {0};
+#endif
+
+#if ((VIDEO_LINE_RING & (VIDEO_LINE_RING-1U)) != 0)
+#error "VIDEO_LINE_RING must be a power of 2"
+#endif
+static uint8_t LineRing[VIDEO_LINE_RING][VIDEO_MAX_LINE_BYTES+1U] = {0};   /* zero trailer byte */
+static volatile int16_t  lineScanned;          /* display line being output       */
+static volatile uint16_t lineRendered;         /* lines rendered so far, in order */
+static volatile uint16_t LineRingLine[VIDEO_LINE_RING];   /* line held by each ring buffer */
+static volatile uint16_t lineTarget;           /* render up to but not including  */
+static volatile uint16_t lateLines = 0;
+static tVideoRender renderMode = VIDEO_RENDER_FRAME;
+static volatile uint8_t scanField = 0;          /* field parity, 1 = odd rows */
+static uint16_t scanLine;                       /* scan line in field         */
+static uint16_t displayLine;                    /* buffer row being output    */
+static uint8_t  lineRepeat;
+
+#ifdef VIDEO_DMA_CHAIN
+static uint32_t lineStartCCR;                   /* SPI DMA channel control with enable set */
+#endif
+
+#ifdef VIDEO_ISR_STATS
+static tVideoIsrStats isrStats;                 /* accumulating over current frame */
+static tVideoIsrStats isrStatsFrame;            /* last complete frame             */
+#define ISR_STATS_ENTER()  uint32_t isr_start = DWT->CYCCNT
+#define ISR_STATS_EXIT()   do { isrStats.isr_count++; isrStats.isr_cycles += DWT->CYCCNT - isr_start; } while(0)
+#else
+#define ISR_STATS_ENTER()
+#define ISR_STATS_EXIT()
+#endif
+
+#ifdef VIDEO_DISPLAY_LIST
+tDisplayLine DisplayList[VIDEO_MAX_ROWS];
+#endif
+
+static void (*pVerticalBlankingCallback)(uint8_t, uint8_t) = 0;
+static void (*pLineRenderCallback)(uint16_t, uint8_t*) = 0;
+
+/***** Local prototypes    ****************************************/
+static void GPIO_Configuration(void);
+static void TIM_Configuration(void);
+static void NVIC_Configuration(void);
+static void SPI_Configuration(void);
+static void DMA_Configuration(void);
+static void TriggerLine(const uint8_t *pLine);
+static void TriggerRenderedLine(uint16_t line);
+static void ApplyMode(const tVideoMode *pMode);
+static void ScanLine(uint16_t line);
+static void SetLineShift(uint16_t row);
+#ifdef TEST_PATTERN_ACTIVE
+static void GenerateScreenTest(void);
+#endif
+#ifdef TEST
+static void SPI_Test(void);
+#endif
+
+
+/***** Exported functions  ****************************************/
+/**
+*  @fn         VideoInit
+*  @param[IN]  render mode
+*     @arg     VIDEO_RENDER_FRAME - lines are output from FrameBuff
+*     @arg     VIDEO_RENDER_LINE  - lines are produced just ahead of the beam by the
+*                                   line render callback, into a small ring of buffers
+*  @param[IN]  TV standard, sets line and frame timing
+*     @arg     VIDEO_STANDARD_PAL  - 312 lines, 50Hz
+*     @arg     VIDEO_STANDARD_NTSC - 262 lines, 60Hz
+*  @brief      Initialises Video generator
+*/
+void VideoInit(tVideoRender render, tVideoStandard standard)
+{
+   #ifdef TEST
+   volatile uint32_t test;
+   test = TEXT_WIDTH;
+   test = NUM_LINES;
+   test = SPI_CLOCK;
+   test = TEXT_WIDTH;
+   test = NUM_X_PIXELS;
+   #endif
+
+   #ifdef TEST_PATTERN_ACTIVE
+   GenerateScreenTest();
+   #endif
+
+   if(standard >= VIDEO_NUM_STANDARDS)
+      standard = VIDEO_STANDARD_PAL;
+
+   /* Keep current video mode, using the new standard's line timing */
+   pVideoTiming = &VideoTimings[standard];
+   pVideoMode = &VideoModes[standard][pVideoMode - pModeTable];
+   pModeTable = VideoModes[standard];
+
+   renderMode = render;
+   VideoResetDisplayList();
+
+   #ifdef VIDEO_ISR_STATS
+   /* Cycle counter for interrupt load */
+   CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+   DWT->CYCCNT = 0;
+   DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+   #endif
+
+   GPIO_Configuration();
+   NVIC_Configuration();
+   SPI_Configuration();
+
+   DMA_Configuration();
+   TIM_Configuration();
+
+}
+
+/**
+*  @fn     setVerticalBlankingCallback
+*  @brief  Sets call back function for vertical blanking event, called with 1 at
+*          start of blanking and 0 at end, plus the parity of the field being scanned
+*/
+void setVerticalBlankingCallback(void (*pCallback)(uint8_t, uint8_t))
+{
+   pVerticalBlankingCallback = pCallback;
+}
+
+/**
+*  @fn         setLineRenderCallback
+*  @param[IN]  callback, passed display line number and the buffer to fill with it
+*  @brief      Sets the line render function used in VIDEO_RENDER_LINE mode
+*              The callback runs from PendSV, so it can be pre-empted by the sync
+*              interrupt, and may be up to VIDEO_LINE_RING-1 lines ahead of the beam.
+*/
+void setLineRenderCallback(void (*pCallback)(uint16_t, uint8_t*))
+{
+   pLineRenderCallback = pCallback;
+}
+
+/**
+*  @fn     VideoGetLateLines
+*  @return Number of lines whose render had not completed when they were due for output
+*/
+uint16_t VideoGetLateLines(void)
+{
+   return lateLines;
+}
+
+/**
+*  @fn            VideoStep
+*  @param[IN]     speed, in units per second
+*  @param[IN/OUT] remainder carried between frames, initialise to 0
+*  @return        distance to move this frame
+*  @brief         Converts a speed to per frame steps which keep real time speed at any
+*                 frame rate, call once per frame
+*/
+uint16_t VideoStep(uint16_t speed, uint16_t *pFraction)
+{
+   uint16_t step;
+
+   *pFraction += speed;
+   step = *pFraction / FRAME_RATE;
+   *pFraction -= step * FRAME_RATE;
+   return step;
+}
+
+/**
+*  @fn         VideoGetIsrStats
+*  @param[OUT] interrupt count, cycles and load over the last frame
+*  @brief      Reports video interrupt load, needs VIDEO_ISR_STATS
+*/
+void VideoGetIsrStats(tVideoIsrStats *pStats)
+{
+   #ifdef VIDEO_ISR_STATS
+   __disable_irq();
+   *pStats = isrStatsFrame;
+   __enable_irq();
+   pStats->load = (uint16_t)((pStats->isr_cycles * 1000UL) / (SystemCoreClock / FRAME_RATE));
+   #else
+   pStats->isr_count = 0;
+   pStats->isr_cycles = 0;
+   pStats->load = 0;
+   #endif
+}
+
+/**
+*  @fn         VideoSetMode
+*  @param[IN]  video mode
+*  @return     0 if mode set, 1 if mode not supported by frame buffer size
+*  @brief      Changes video mode at the start of the next frame
+*              If video is running this waits for the change to take effect, after which
+*              the frame buffer contents should be redrawn.
+*/
+uint8_t VideoSetMode(tVideoModeId mode)
+{
+   if((mode >= VIDEO_NUM_MODES) || (pModeTable[mode].height > VIDEO_MAX_ROWS) ||
+      (((uint32_t)pModeTable[mode].stride * pModeTable[mode].height) > VIDEO_BUFF_SIZE))
+   {
+      return 1;
+   }
+
+   if((TIM1->CR1 & TIM_CR1_CEN) != 0)
+   {
+      pNextMode = &pModeTable[mode];
+      while(pNextMode != 0);
+   }
+   else
+   {
+      pVideoMode = &pModeTable[mode];
+      VideoResetDisplayList();
+   }
+   return 0;
+}
+
+/**
+*  @fn     VideoSwapBuffers
+*  @brief  Requests that the draw buffer is displayed from the start of the next frame
+*          Drawing must not resume until IsSwapPending() returns 0, at which point
+*          pDrawBuff refers to the buffer that was previously on screen.
+*          Does nothing if double buffering is not built in.
+*/
+void VideoSwapBuffers(void)
+{
+   #ifdef VIDEO_DOUBLE_BUFFER
+   swapPending = 1;
+   #endif
+}
+
+/**
+*  @fn     IsSwapPending
+*  @return 1 if a buffer swap has been requested but not yet latched
+*/
+uint8_t IsSwapPending(void)
+{
+   #ifdef VIDEO_DOUBLE_BUFFER
+   return swapPending;
+   #else
+   return 0;
+   #endif
+}
+
+#ifdef VIDEO_DIRTY_ROWS
+/**
+*  @fn         VideoMarkDirty
+*  @param[IN]  first row
+*  @param[IN]  number of rows
+*  @brief      Flags a band of rows as changed, so they are copied on next commit
+*/
+void VideoMarkDirty(uint16_t y, uint16_t rows)
+{
+   if(y >= VIDEO_MAX_ROWS)
+      return;
+   if(rows > (VIDEO_MAX_ROWS - y))
+      rows = VIDEO_MAX_ROWS - y;
+
+   while(rows-- > 0)
+   {
+      VIDEO_MARK_DIRTY(y);
+      y++;
+   }
+}
+#endif
+
+/**
+*  @fn     VideoCommitDirty
+*  @return number of bytes copied
+*  @brief  Copies changed rows from the back buffer into FrameBuff, using memory to memory DMA
+*          Adjacent rows are merged into a single transfer.
+*          Call once per vertical blank, GraphicsTick() does so at its start.
+*/
+uint16_t VideoCommitDirty(void)
+{
+   uint16_t copied = 0;
+   #ifdef VIDEO_DIRTY_ROWS
+   uint16_t y = 0;
+   uint16_t start;
+   uint16_t first, last;
+
+   while(y < VIDEO_MAX_ROWS)
+   {
+      /* Skip quickly over clean groups of 32 rows */
+      if(((y & 31U) == 0) && (DirtyRows[y >> 5] == 0))
+      {
+         y += 32U;
+         continue;
+      }
+      if((DirtyRows[y >> 5] & (1UL << (y & 31U))) == 0)
+      {
+         y++;
+         continue;
+      }
+
+      /* Find end of this run of dirty rows, clearing flags as we go */
+      start = y;
+      do
+      {
+         DirtyRows[y >> 5] &= ~(1UL << (y & 31U));
+         y++;
+      }
+      while((y < VIDEO_MAX_ROWS) && ((DirtyRows[y >> 5] & (1UL << (y & 31U))) != 0));
+
+      /* Rows are not word aligned, copy whole words around the run. The extra bytes
+         come from the back buffer as well, so are already correct */
+      first = (start * pVideoMode->stride) & ~3U;
+      last = ((y * pVideoMode->stride) + 3U) & ~3U;
+      DMA_CHAN_M2M->CPAR = (uint32_t)&BackBuff[first];
+      DMA_CHAN_M2M->CMAR = (uint32_t)&FrameBuff[first];
+      DMA_CHAN_M2M->CNDTR = (last - first) / 4U;
+      DMA_Cmd(DMA_CHAN_M2M, ENABLE);
+      while(DMA_GetFlagStatus(DMA_FLAG_M2M_TC) == RESET);
+      DMA_ClearFlag(DMA_FLAG_M2M_TC);
+      DMA_Cmd(DMA_CHAN_M2M, DISABLE);
+
+      copied += last - first;
+   }
+   #endif
+   return copied;
+}
+
+/**
+*  @fn     VideoResetDisplayList
+*  @brief  Sets display list so that each line shows the matching frame buffer row
+*/
+void VideoResetDisplayList(void)
+{
+   #ifdef VIDEO_DISPLAY_LIST
+   uint16_t line;
+
+   for(line = 0; line < VIDEO_MAX_ROWS; line++)
+   {
+      DisplayList[line].offset = line * pVideoMode->stride;
+      DisplayList[line].h_shift = 0;
+   }
+   #endif
+}
+
+/**
+*  @fn         VideoScrollBand
+*  @param[IN]  first line of band
+*  @param[IN]  number of lines in band
+*  @param[IN]  vertical scroll, in lines, rows wrap around within the band
+*  @param[IN]  horizontal shift of band, in timer ticks
+*  @brief      Scrolls a horizontal band of the screen by updating the display list
+*              Costs one table write per line rather than moving frame buffer data, so
+*              e.g. a playfield can scroll beneath a static score bar.
+*/
+void VideoScrollBand(uint16_t first, uint16_t count, uint16_t scroll, int8_t h_shift)
+{
+   #ifdef VIDEO_DISPLAY_LIST
+   uint16_t i;
+   uint16_t row;
+
+   if(first >= VIDEO_MAX_ROWS)
+      return;
+   if(count > (VIDEO_MAX_ROWS - first))
+      count = VIDEO_MAX_ROWS - first;
+   if(count == 0)
+      return;
+   if(h_shift > VIDEO_MAX_H_SHIFT)
+      h_shift = VIDEO_MAX_H_SHIFT;
+   else if(h_shift < -VIDEO_MAX_H_SHIFT)
+      h_shift = -VIDEO_MAX_H_SHIFT;
+
+   row = scroll % count;
+   for(i = 0; i < count; i++)
+   {
+      DisplayList[first + i].offset = (first + row) * pVideoMode->stride;
+      DisplayList[first + i].h_shift = h_shift;
+      if(++row >= count)
+         row = 0;
+   }
+   #else
+   (void)first;
+   (void)count;
+   (void)scroll;
+   (void)h_shift;
+   #endif
+}
+
+/***** Local    functions  ****************************************/
+
+/**
+*  @fn     TIM1_CC_IRQHandler
+*  @brief  Interrupt handler for timer CC event
+*/
+void TIM1_CC_IRQHandler(void)
+{    
+   static Sync_State_e sync_state = FRAME_SYNC;
+   static uint16_t pulse_count = 0;
+   uint16_t i;
+   ISR_STATS_ENTER();
+
+//   DBGMCU->CR |= DBGMCU_CR_DBG_TIM1_STOP;    /* stop timer 1 in debug mode */
+
+   if(TIM_GetITStatus(TIM1 , TIM_IT_CC1) != RESET)
+   {
+      TIM_ClearITPendingBit(TIM1 , TIM_FLAG_CC1);
+      switch(sync_state)
+      {
+         case FRAME_SYNC:
+            if(++pulse_count >= pVideoTiming->num_broad_sync)
+            {
+               TIM1->CCR1 = TIMER_TICKS(SHORT_SYNC);
+               sync_state = PRE_FRAME_SHORT;
+               pulse_count = 0;
+            }
+         break;
+
+         case PRE_FRAME_SHORT:
+            /* Progressive mode about to be applied starts on an even field */
+            if((pNextMode != 0) && (pNextMode->interlace == 0))
+               scanField = 0;
+            /* Odd field of an interlaced frame starts its lines half a line later */
+            if(++pulse_count >= (pVideoTiming->num_pre_frame_sync + scanField))
+            {
+               TIM1->CCR1 = TIMER_TICKS(H_SYNC);
+               TIM1->ARR = pVideoTiming->line_period;
+               sync_state = FRAME_ACTIVE;
+               scanLine = pVideoTiming->first_active_line;
+               lineRepeat = 0;
+               if(pNextMode != 0)
+               {
+                  ApplyMode(pNextMode);
+                  pNextMode = 0;
+               }
+               displayLine = scanField;
+               #ifdef VIDEO_DMA_CHAIN
+               SetLineShift(displayLine);
+               #endif
+               #ifdef VIDEO_DOUBLE_BUFFER
+               /* Latch buffer swap before the first displayed line, so no tearing */
+               if(swapPending != 0)
+               {
+                  pDrawBuff = pScanBuff;
+                  pScanBuff = (pDrawBuff == FrameBuff) ? BackBuff : FrameBuff;
+                  swapPending = 0;
+               }
+               #endif
+               #ifdef VIDEO_ISR_STATS
+               isrStatsFrame = isrStats;
+               #ifdef INSTRUMENT
+               InstrRecord(INSTR_VIDEO_ISR, isrStats.isr_cycles);
+               #endif
+               isrStats.isr_count = 0;
+               isrStats.isr_cycles = 0;
+               #endif
+            }
+         break;
+
+         case FRAME_ACTIVE:
+            if(scanLine >= pVideoTiming->last_active_line)
+            {
+               TIM1->CCR1 = TIMER_TICKS(SHORT_SYNC);
+               TIM1->ARR = pVideoTiming->line_period/2U;
+               pulse_count = 0;
+               sync_state = POST_FRAME_SHORT;
+            }
+            else if((scanLine == LINE_RENDER_START) && (renderMode == VIDEO_RENDER_LINE))
+            {
+               /* Fill the line ring ahead of the first displayed line */
+               lineScanned = -1;
+               lineRendered = 0;
+               for(i = 0; i < VIDEO_LINE_RING; i++)
+               {
+                  /* Trailer moves with the mode's line length */
+                  LineRing[i][pVideoMode->line_bytes] = 0;
+                  LineRingLine[i] = 0xFFFFU;
+               }
+               lineTarget = VIDEO_LINE_RING;
+               SCB->ICSR = SCB_ICSR_PENDSVSET;
+            }
+            /* Placemarker for vertical blanking interval - with present numbers we can have
+               72 lines or 4.6ms */
+            else if(scanLine == (pVideoMode->first_line-1U))
+            {
+               #ifdef VIDEO_DMA_CHAIN
+               /* Load first line, CC2 DMA request of this line starts it */
+               ScanLine(scanLine + 1U);
+               SetLineShift(displayLine);
+               #endif
+               /* TODO add call back for end of blanking interval  */
+               if(pVerticalBlankingCallback != 0)
+               {
+                  INSTR_START(INSTR_VBLANK);
+                  pVerticalBlankingCallback(0, scanField);
+                  INSTR_STOP(INSTR_VBLANK);
+                  #ifdef TIMING_TEST
+                  GPIO_SetBits(DEBUG_PORT, DEBUG_PIN_2);
+                  #endif
+               }
+            }
+            else if(scanLine == (pVideoMode->last_line+1U))
+            {
+               /* TODO add callback for start of blanking interval */
+               if(pVerticalBlankingCallback != 0)
+               {
+                  INSTR_START(INSTR_VBLANK);
+                  pVerticalBlankingCallback(1, scanField);
+                  INSTR_STOP(INSTR_VBLANK);
+                  #ifdef TIMING_TEST
+                  GPIO_ResetBits(DEBUG_PORT, DEBUG_PIN_2);
+                  #endif
+               }
+            }
+            scanLine++;
+         break;
+
+         case POST_FRAME_SHORT:
+            /* Even field of an interlaced frame has an extra half line, so the
+               next field's broad sync pulses start mid line */
+            if(++pulse_count >= (pVideoTiming->num_post_frame_sync +
+                                 (pVideoMode->interlace & (scanField ^ 1U))))
+            {
+               TIM1->CCR1 = pVideoTiming->long_sync;
+               sync_state = FRAME_SYNC;
+               pulse_count = 0;
+               scanField = (pVideoMode->interlace != 0) ? (scanField ^ 1U) : 0;
+            }
+         break;
+      }
+   }
+   #ifndef VIDEO_DMA_CHAIN
+   else if(TIM_GetITStatus(TIM1 , TIM_IT_CC2) != RESET)
+   {
+      TIM_ClearITPendingBit(TIM1 , TIM_FLAG_CC2);
+      ScanLine(scanLine);
+      SetLineShift(displayLine);
+   }
+   #endif
+   ISR_STATS_EXIT();
+}
+
+
+/**
+*  @fn     PendSV_Handler
+*  @brief  Renders lines into the line ring, up to the target set by the sync interrupt
+*          Runs at lower priority than the sync interrupt, which can pre-empt it to
+*          output the next line. Lines already reached by the beam are skipped.
+*/
+void PendSV_Handler(void)
+{
+   uint16_t line;
+
+   while(lineRendered < lineTarget)
+   {
+      line = lineRendered;
+      if(((int16_t)line > lineScanned) && (line < (pVideoMode->height >> pVideoMode->interlace)) &&
+         (pLineRenderCallback != 0))
+      {
+         /* Ring holds lines of the current field, callback gets the buffer row */
+         pLineRenderCallback((line << pVideoMode->interlace) + scanField,
+                             LineRing[line & (VIDEO_LINE_RING-1U)]);
+         LineRingLine[line & (VIDEO_LINE_RING-1U)] = line;
+      }
+      lineRendered = line + 1;
+   }
+}
+
+/**
+*  @fn     DMA1_Channel5_IRQHandler
+*  @brief  Interrupt handler for SPI DMA transfer complete
+*/
+void DMA1_Channel5_IRQHandler(void)
+{
+   #ifdef VIDEO_DMA_CHAIN
+   uint16_t row;
+   #endif
+   ISR_STATS_ENTER();
+
+   if(DMA_GetITStatus(DMA1_IT_TC5) != RESET)
+   {
+      /* Zero trailer byte is now in SPI data register, so line ends blank */
+      DMA_ClearITPendingBit(DMA1_IT_TC5);
+      DMA_Cmd(DMA_CHAN_SPI2_TX, DISABLE);
+      #ifdef VIDEO_DMA_CHAIN
+      /* Load next line, which the TIM1 CC2 DMA request starts */
+      row = displayLine;
+      ScanLine(scanLine + 1U);
+      SetLineShift(row);
+      #endif
+   }
+   ISR_STATS_EXIT();
+}
+
+/**
+*  @fn     GPIO_Configuration
+*  @brief  Set up sync output
+*/
+static void GPIO_Configuration(void)
+{
+   GPIO_InitTypeDef GPIO_InitStructure = {0};
+
+   RCC_APB2PeriphClockCmd( RCC_APB2Periph_GPIOA | RCC_APB2Periph_GPIOB | RCC_APB2Periph_AFIO, ENABLE); 						 
+
+  /* Timer1 channel 1 PA8  */
+   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_8;
+   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
+   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF_PP; ; 
+   GPIO_Init(GPIOA, &GPIO_InitStructure);
+
+   /* SPI2 MOSI - PB15     */
+   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_15;
+   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
+   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF_PP; ; 
+   GPIO_Init(GPIOB, &GPIO_InitStructure);
+
+}
+
+
+/**
+*  @fn     TIM_Configuration
+*  @brief  Configure timer used for sync generation
+*/
+static void TIM_Configuration(void)
+{
+   TIM_TimeBaseInitTypeDef  TIM_TimeBaseStructure = {0};
+   TIM_OCInitTypeDef        TIM_OCInitStructure = {0};
+   
+   RCC_APB2PeriphClockCmd(RCC_APB2Periph_TIM1 , ENABLE);
+   TIM_DeInit(TIM1);
+   TIM_TimeBaseStructure.TIM_Period=pVideoTiming->line_period/2U;
+   												
+   TIM_TimeBaseStructure.TIM_Prescaler= TIMER_PSC-1;
+   TIM_TimeBaseStructure.TIM_ClockDivision=TIM_CKD_DIV1; 
+   TIM_TimeBaseStructure.TIM_CounterMode=TIM_CounterMode_Up;
+   TIM_TimeBaseInit(TIM1, &TIM_TimeBaseStructure);
+   TIM_ClearFlag(TIM1, TIM_FLAG_Update);						
+   #ifdef VIDEO_DMA_CHAIN
+   TIM_ITConfig(TIM1, TIM_IT_CC1, ENABLE);
+   #else
+   TIM_ITConfig(TIM1,(TIM_IT_CC1 | TIM_IT_CC2),ENABLE);
+   #endif
+   
+   TIM_ARRPreloadConfig(TIM1, ENABLE);
+   
+   /* Enable PWM = Channel 1 generates sync */
+   TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_PWM1;
+   TIM_OCInitStructure.TIM_OutputState = TIM_OutputState_Enable;
+   TIM_OCInitStructure.TIM_Pulse = pVideoTiming->long_sync;
+   TIM_OCInitStructure.TIM_OCPolarity = TIM_OCPolarity_Low;
+   
+   TIM_OC1Init(TIM1, &TIM_OCInitStructure);
+   TIM_OC1PreloadConfig(TIM1, TIM_OCPreload_Enable);
+
+   /* PWM channel 2 generates DMA trigger for pixel data */
+   TIM_OCInitStructure.TIM_OCPolarity = TIM_OCPolarity_High;
+   TIM_OCInitStructure.TIM_OCPolarity = TIM_OCPolarity_Low;
+   TIM_OCInitStructure.TIM_Pulse = pVideoMode->line_start;
+ 
+   TIM_OC2Init(TIM1, &TIM_OCInitStructure);
+   TIM_OC2PreloadConfig(TIM1, TIM_OCPreload_Enable);
+
+   #ifdef VIDEO_DMA_CHAIN
+   /* Configure DMA trigger, on CCR2  */
+   TIM_DMACmd(TIM1, TIM_DMA_CC2, ENABLE);
+   #endif
+   
+   TIM_CtrlPWMOutputs(TIM1, ENABLE);
+   TIM_Cmd(TIM1, ENABLE);			
+}
+
+/**
+*  @fn     NVIC_Configuration
+*  @brief  Configure NVIC
+*/
+static void NVIC_Configuration(void)
+{
+   NVIC_InitTypeDef NVIC_InitStructure; 
+    
+   /* One pre-emption bit, so the sync interrupt can pre-empt line rendering in PendSV */
+   NVIC_PriorityGroupConfig(NVIC_PriorityGroup_1);  													
+   NVIC_InitStructure.NVIC_IRQChannel = TIM1_CC_IRQn;	  
+   NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0;
+   NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;	
+   NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+   NVIC_Init(&NVIC_InitStructure);
+   
+   NVIC_InitStructure.NVIC_IRQChannel = DMA1_Channel5_IRQn;
+   NVIC_Init(&NVIC_InitStructure);
+
+   NVIC_SetPriority(PendSV_IRQn, 0x0F);
+}
+
+/**
+*  @fn     SPI_Configuration
+*  @brief  Configure SPI
+*/
+static void SPI_Configuration(void)
+{
+   SPI_InitTypeDef  SPI_InitStructure;
+
+   RCC_APB1PeriphClockCmd(RCC_APB1Periph_SPI2 , ENABLE);
+
+   SPI_InitStructure.SPI_Direction = SPI_Direction_1Line_Tx;
+   SPI_InitStructure.SPI_Mode = SPI_Mode_Master;
+   SPI_InitStructure.SPI_DataSize = SPI_DataSize_8b;
+   SPI_InitStructure.SPI_CPOL = SPI_CPOL_High;
+   SPI_InitStructure.SPI_CPHA = SPI_CPHA_1Edge;
+   SPI_InitStructure.SPI_NSS = SPI_NSS_Soft;
+   SPI_InitStructure.SPI_BaudRatePrescaler = pVideoMode->spi_psc;
+   SPI_InitStructure.SPI_FirstBit = SPI_FirstBit_MSB;
+   SPI_InitStructure.SPI_CRCPolynomial = 7;
+   SPI_Init(SPI2, &SPI_InitStructure);
+
+   /* Enable SPI2 Tx request */
+   SPI_I2S_DMACmd(SPI2, SPI_I2S_DMAReq_Tx, ENABLE);
+
+   /* Enable SPI2  */
+   SPI_Cmd(SPI2, ENABLE);
+}
+
+/**
+*  @fn     DMA_Configuration
+*  @brief  Configure DMA
+*/
+static void DMA_Configuration(void)
+{
+   DMA_InitTypeDef  DMA_InitStructure;
+
+   RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1 , ENABLE);
+
+   DMA_DeInit(DMA_CHAN_SPI2_TX);
+   DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&SPI2->DR;
+   DMA_InitStructure.DMA_MemoryBaseAddr = (uint32_t)FrameBuff;
+   DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralDST;
+   DMA_InitStructure.DMA_BufferSize = pVideoMode->line_bytes + 1U;
+   DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+   DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+   DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+   DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+   DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+   DMA_InitStructure.DMA_Priority = DMA_Priority_VeryHigh;
+   DMA_InitStructure.DMA_M2M = DMA_M2M_Disable;
+   DMA_ITConfig(DMA_CHAN_SPI2_TX, DMA_CCR5_TCIE, ENABLE); 
+   DMA_Init(DMA_CHAN_SPI2_TX, &DMA_InitStructure);
+
+   #ifdef VIDEO_DMA_CHAIN
+   /* TIM1 CC2 request copies the SPI channel control word, with enable set, so
+      each line starts without an interrupt */
+   lineStartCCR = DMA_CHAN_SPI2_TX->CCR | DMA_CCR5_EN;
+   /* Nothing to send until the first line is loaded, as CC2 requests start
+      from the first broad sync pulse */
+   DMA_CHAN_SPI2_TX->CNDTR = 0;
+   DMA_DeInit(DMA_CHAN_TIM1_CC2);
+   DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&DMA_CHAN_SPI2_TX->CCR;
+   DMA_InitStructure.DMA_MemoryBaseAddr = (uint32_t)&lineStartCCR;
+   DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralDST;
+   DMA_InitStructure.DMA_BufferSize = 1;
+   DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+   DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Disable;
+   DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Word;
+   DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Word;
+   DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
+   DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+   DMA_InitStructure.DMA_M2M = DMA_M2M_Disable;
+   DMA_Init(DMA_CHAN_TIM1_CC2, &DMA_InitStructure);
+   DMA_Cmd(DMA_CHAN_TIM1_CC2, ENABLE);
+   #endif
+
+   #ifdef VIDEO_DIRTY_ROWS
+   /* Memory to memory channel for copying dirty rows, in words */
+   DMA_DeInit(DMA_CHAN_M2M);
+   DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)BackBuff;
+   DMA_InitStructure.DMA_MemoryBaseAddr = (uint32_t)FrameBuff;
+   DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralSRC;
+   DMA_InitStructure.DMA_BufferSize = VIDEO_BUFF_SIZE/4U;
+   DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Enable;
+   DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+   DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Word;
+   DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Word;
+   DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+   DMA_InitStructure.DMA_Priority = DMA_Priority_Low;
+   DMA_InitStructure.DMA_M2M = DMA_M2M_Enable;
+   DMA_Init(DMA_CHAN_M2M, &DMA_InitStructure);
+   #endif
+}
+
+
+/**
+*  @fn        TriggerLine
+*  @brief     Initiates output of a scan line
+*  @param[IN] pointer to line data
+*/
+static void TriggerLine(const uint8_t *pLine)
+{
+   #ifdef VIDEO_DMA_CHAIN
+   /* Enabled, with nothing to send, by CC2 requests in blanking */
+   DMA_CHAN_SPI2_TX->CCR &= ~DMA_CCR5_EN;
+   #endif
+   DMA_CHAN_SPI2_TX->CMAR = (uint32_t)pLine;
+   DMA_CHAN_SPI2_TX->CNDTR = pVideoMode->line_bytes + 1U;    /* and zero trailer */
+   #ifndef VIDEO_DMA_CHAIN
+   DMA_Cmd(DMA_CHAN_SPI2_TX, ENABLE);
+   SPI2->DR = pLine[0];
+   #endif
+}
+
+/**
+*  @fn        TriggerRenderedLine
+*  @brief     Initiates output of a scan line from the line ring, and requests
+*             rendering of the lines ahead of it
+*  @param[IN] line number
+*/
+static void TriggerRenderedLine(uint16_t line)
+{
+   lineScanned = (int16_t)line;
+   if(LineRingLine[line & (VIDEO_LINE_RING-1U)] != line)
+   {
+      /* Render missed its deadline, or was skipped as the beam had reached it
+         on an earlier repeat, ring slot holds stale or partial data */
+      lateLines++;
+   }
+   TriggerLine(LineRing[line & (VIDEO_LINE_RING-1U)]);
+   lineTarget = line + VIDEO_LINE_RING;
+   SCB->ICSR = SCB_ICSR_PENDSVSET;
+}
+
+/**
+*  @fn        ScanLine
+*  @param[IN] scan line number
+*  @brief     Outputs pixel data for a displayed scan line, with VIDEO_DMA_CHAIN the
+*             line is loaded ready for the TIM1 CC2 DMA request to start it
+*/
+static void ScanLine(uint16_t line)
+{
+   if((line >= pVideoMode->first_line) && (line <= pVideoMode->last_line))
+   {
+      if(renderMode == VIDEO_RENDER_LINE)
+         TriggerRenderedLine(displayLine >> pVideoMode->interlace);
+      else
+      {
+         #ifdef VIDEO_DISPLAY_LIST
+         TriggerLine(pScanBuff + DisplayList[displayLine].offset);
+         #else
+         TriggerLine(pScanBuff + (displayLine * pVideoMode->stride));
+         #endif
+      }
+      if(++lineRepeat >= pVideoMode->line_repeat)
+      {
+         lineRepeat = 0;
+         displayLine += 1U + pVideoMode->interlace;
+      }
+   }
+}
+
+/**
+*  @fn        SetLineShift
+*  @param[IN] buffer row
+*  @brief     Sets start time of next line from the display list
+*/
+static void SetLineShift(uint16_t row)
+{
+   #ifdef VIDEO_DISPLAY_LIST
+   /* CCR2 is preloaded, so this sets the start time of the next line */
+   if((row < pVideoMode->height) && (renderMode == VIDEO_RENDER_FRAME))
+      TIM1->CCR2 = pVideoMode->line_start + DisplayList[row].h_shift;
+   else
+      TIM1->CCR2 = pVideoMode->line_start;
+   #else
+   (void)row;
+   #endif
+}
+
+/**
+*  @fn        ApplyMode
+*  @brief     Switches video generator to new mode, called during vertical blanking
+*  @param[IN] new video mode
+*/
+static void ApplyMode(const tVideoMode *pMode)
+{
+   pVideoMode = pMode;
+
+   /* Pixel clock, SPI is idle in vertical blanking */
+   SPI_Cmd(SPI2, DISABLE);
+   SPI2->CR1 = (SPI2->CR1 & ~SPI_BaudRatePrescaler_256) | pMode->spi_psc;
+   SPI_Cmd(SPI2, ENABLE);
+
+   TIM1->CCR2 = pMode->line_start;
+   VideoResetDisplayList();
+}
+
+#ifdef TEST_PATTERN_ACTIVE
+/**
+*  @fn        GenerateScreenTest
+*  @brief     Generates cross hatch pattern
+*/
+static void GenerateScreenTest(void)
+{
+   uint16_t x,y;
+   uint8_t byte;
+ 
+   for(y = 0; y < NUM_Y_PIXELS; y++)
+   {
+      for(x = 0; x < NUM_X_BYTES; x++)
+      {
+         if( ((y % 16) == 0) || (y == NUM_Y_PIXELS-1))
+         {
+            byte = 0xf0;
+         }
+         else if (x == NUM_X_BYTES-1)
+         {
+//            byte = 0x01;
+            byte = 0xF0;
+         }
+         else if( ((x % 2) == 0) || (x == 0))
+         {
+//            byte = 0x80;   
+            byte = 0xF0;   
+         }
+         else
+         {
+            byte = 0;
+         }
+         FrameBuff[(y * pVideoMode->stride) + x] = byte;
+      }
+   }
+}
+#endif
+
+#ifdef TEST
+/**
+*  @fn        SPI_Test
+*  @brief     Sends a single line directly via SPI
+*/
+static void SPI_Test(void)
+{
+   uint8_t i;
+
+   for(i = 0; i < NUM_X_BYTES; i++)
+   {
+      /* Wait for SPI2 Tx buffer empty */
+      while (SPI_I2S_GetFlagStatus(SPI2, SPI_I2S_FLAG_TXE) == RESET);
+      /* Send SPI2 data */
+      SPI_I2S_SendData(SPI2, FrameBuff[i]);
+      
+   }
+}
+#endif
+
+
+
+
@@ -1,38 +1,150 @@
-/**
-*  @file   Video.h
-*  @author Rob Gee
-*  @date   November 2017
-*  @brief  Include file for compositite video signal generator
-*/
-
-#ifndef __VIDEO_H
-#define __VIDEO_H
-
-/***** Constants  *************************************************/
-#define VIDEO_SYNC_TIMER      TIM1
-#define VIDEO_SYNC_CHANNEL    TIM_OC1
-
-#define FRAME_RATE            50U
-#define NUM_X_PIXELS          320U
-#define NUM_Y_PIXELS          240U
-#define NUM_X_BYTES           (NUM_X_PIXELS/8U)
-
-#define VIDEO_COUNTS(ms)      (((ms) * FRAME_RATE)/1000UL)
-
-/***** Types      *************************************************/
-
-
-/***** Global storage**********************************************/
-extern uint8_t FrameBuff[NUM_Y_PIXELS][NUM_X_BYTES];
-
-
-/***** Exported functions   ***************************************/
-void VideoInit(void);
-void GraphicsTick(void);
-void SetPixel(uint16_t x, uint16_t y, uint8_t action);
-void DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t action);
-void setVerticalBlankingCallback(void (*pCallback)(uint8_t));
-
-#endif  /*  __VIDEO_H  */
-
-
+/**
+*  @file   Video.h
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Include file for compositite video signal generator
+*/
+
+#ifndef __VIDEO_H
+#define __VIDEO_H
+
+/***** Constants  *************************************************/
+#define VIDEO_SYNC_TIMER      TIM1
+#define VIDEO_SYNC_CHANNEL    TIM_OC1
+
+#define FRAME_RATE            (pVideoTiming->frame_rate)   /* follows standard chosen at VideoInit() */
+#define NUM_X_PIXELS          320U        /* geometry of default video mode */
+#define NUM_Y_PIXELS          240U
+#define NUM_X_BYTES           (NUM_X_PIXELS/8U)
+
+#ifndef VIDEO_BUFF_SIZE
+#define VIDEO_BUFF_SIZE       (NUM_Y_PIXELS*(NUM_X_BYTES+1U))  /* rows have a zero trailer byte, 12672 needed
+                                                                  for 400x240 and 256x384, 19680 for 320x480 */
+#endif
+#define VIDEO_MAX_LINE_BYTES  50U         /* widest line of any video mode */
+#ifndef VIDEO_MAX_ROWS
+#define VIDEO_MAX_ROWS        NUM_Y_PIXELS   /* tallest mode supported, 480 for interlaced modes */
+#endif
+
+#define VIDEO_COUNTS(ms)      (((ms) * FRAME_RATE)/1000UL)
+#define VIDEO_STEP(speed)     (((speed) + (FRAME_RATE/2U))/FRAME_RATE)   /* per frame, rounded */
+
+#ifndef VIDEO_STANDARD
+#define VIDEO_STANDARD        VIDEO_STANDARD_PAL    /* TV standard used by GraphicsInit() */
+#endif
+
+#define VIDEO_LINE_RING       4U          /* line buffers in line render mode */
+#define VIDEO_MAX_H_SHIFT     16          /* display list horizontal shift limit, timer ticks */
+
+/* Build options */
+//#define VIDEO_DOUBLE_BUFFER         /* second frame buffer, costs a further 9.6KB of SRAM */
+//#define VIDEO_DIRTY_ROWS            /* draw into back buffer, copy changed rows in vblank */
+//#define VIDEO_DISPLAY_LIST          /* per line start offset and horizontal shift table */
+//#define VIDEO_DMA_CHAIN             /* TIM1 CC2 DMA request starts each line, no CC2 interrupt */
+//#define VIDEO_ISR_STATS             /* count video interrupts and their DWT cycles each frame */
+
+#if defined(VIDEO_DOUBLE_BUFFER) && defined(VIDEO_DIRTY_ROWS)
+#error "VIDEO_DOUBLE_BUFFER and VIDEO_DIRTY_ROWS are mutually exclusive"
+#endif
+
+/***** Types      *************************************************/
+typedef enum {VIDEO_STANDARD_PAL = 0, VIDEO_STANDARD_NTSC, VIDEO_NUM_STANDARDS} tVideoStandard;
+
+/* Line and frame timing of a TV standard */
+typedef struct
+{
+   uint8_t  frame_rate;          /* fields per second                      */
+   uint16_t line_period;         /* timer ticks                            */
+   uint16_t long_sync;           /* broad sync pulse, timer ticks          */
+   uint8_t  num_broad_sync;      /* half line pulses in each sync section  */
+   uint8_t  num_pre_frame_sync;
+   uint8_t  num_post_frame_sync;
+   uint16_t first_active_line;
+   uint16_t last_active_line;
+} tVideoTiming;
+
+typedef enum {VIDEO_MODE_320x240 = 0, VIDEO_MODE_320x120, VIDEO_MODE_256x192, VIDEO_MODE_400x240,
+              VIDEO_MODE_320x480I, VIDEO_MODE_256x384I, VIDEO_NUM_MODES} tVideoModeId;
+
+typedef struct
+{
+   uint16_t width;         /* pixels                                   */
+   uint16_t height;        /* buffer rows                              */
+   uint16_t stride;        /* bytes between buffer rows, line + trailer */
+   uint8_t  line_bytes;    /* bytes output per line                    */
+   uint8_t  line_repeat;   /* scan lines per buffer row                */
+   uint8_t  interlace;     /* 1 = even rows in even field, odd in odd  */
+   uint16_t spi_psc;       /* SPI_BaudRatePrescaler_x, sets pixel clock */
+   uint16_t line_start;    /* start of pixel data, timer ticks         */
+   uint16_t first_line;    /* first displayed scan line of each field  */
+   uint16_t last_line;     /* last displayed scan line of each field   */
+} tVideoMode;
+
+/* Source of pixel data for each displayed line */
+typedef enum {VIDEO_RENDER_FRAME, VIDEO_RENDER_LINE} tVideoRender;
+
+/* Display list entry, one per displayed line */
+typedef struct
+{
+   uint16_t offset;     /* byte offset of line data from start of frame buffer  */
+   int8_t   h_shift;    /* delay of line start in timer ticks, 125ns (~7/8 pixel) */
+} tDisplayLine;
+
+/* Video interrupt load over the last frame */
+typedef struct
+{
+   uint16_t isr_count;     /* TIM1 CC and SPI DMA interrupts     */
+   uint32_t isr_cycles;    /* CPU cycles spent in them           */
+   uint16_t load;          /* per mille of frame time            */
+} tVideoIsrStats;
+
+/***** Global storage**********************************************/
+extern uint8_t FrameBuff[VIDEO_BUFF_SIZE];
+extern const tVideoTiming *pVideoTiming;
+extern const tVideoMode * volatile pVideoMode;
+
+#if defined(VIDEO_DOUBLE_BUFFER)
+/* Buffer that graphics functions render into, the other one is being displayed */
+extern uint8_t * volatile pDrawBuff;
+#elif defined(VIDEO_DIRTY_ROWS)
+/* Graphics functions render into the back buffer, changed rows are copied to FrameBuff */
+extern uint8_t BackBuff[VIDEO_BUFF_SIZE];
+#define pDrawBuff             BackBuff
+#else
+#define pDrawBuff             FrameBuff
+#endif
+
+#ifdef VIDEO_DISPLAY_LIST
+extern tDisplayLine DisplayList[VIDEO_MAX_ROWS];
+#endif
+
+#ifdef VIDEO_DIRTY_ROWS
+extern uint32_t DirtyRows[(VIDEO_MAX_ROWS+31U)/32U];
+#define VIDEO_MARK_DIRTY(y)   (DirtyRows[(y) >> 5] |= (1UL << ((y) & 31U)))
+void VideoMarkDirty(uint16_t y, uint16_t rows);
+#else
+#define VIDEO_MARK_DIRTY(y)   ((void)(y))
+#define VideoMarkDirty(y, rows)  ((void)(y), (void)(rows))
+#endif
+
+
+/***** Exported functions   ***************************************/
+void VideoInit(tVideoRender render, tVideoStandard standard);
+void GraphicsTick(void);
+void SetPixel(uint16_t x, uint16_t y, uint8_t action);
+void DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t action);
+void setVerticalBlankingCallback(void (*pCallback)(uint8_t, uint8_t));
+void setLineRenderCallback(void (*pCallback)(uint16_t, uint8_t*));
+uint16_t VideoGetLateLines(void);
+void VideoSwapBuffers(void);
+uint8_t IsSwapPending(void);
+uint16_t VideoCommitDirty(void);
+void VideoResetDisplayList(void);
+uint8_t VideoSetMode(tVideoModeId mode);
+uint16_t VideoStep(uint16_t speed, uint16_t *pFraction);
+void VideoGetIsrStats(tVideoIsrStats *pStats);
+void VideoScrollBand(uint16_t first, uint16_t count, uint16_t scroll, int8_t h_shift);
+
+#endif  /*  __VIDEO_H  */
+
+
@@ -1,20 +1,20 @@
-/**
-*  @file   name.c
-*  @author Rob Gee
-*  @date   November 2017
-*  @brief  
-*/
-
-/***** Include files  *********************************************/
-
-/***** Constants  *************************************************/
-
-/***** Types      *************************************************/
-
-/***** Storage    *************************************************/
-
-/***** Local prototypes    ****************************************/
-
-/***** Exported functions  ****************************************/
-
-/***** Local    functions  ****************************************/
+/**
+*  @file   name.c
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  
+*/
+
+/***** Include files  *********************************************/
+
+/***** Constants  *************************************************/
+
+/***** Types      *************************************************/
+
+/***** Storage    *************************************************/
+
+/***** Local prototypes    ****************************************/
+
+/***** Exported functions  ****************************************/
+
+/***** Local    functions  ****************************************/
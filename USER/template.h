@@ -1,18 +1,18 @@
-/**
-*  @file   name.h
-*  @author Rob Gee
-*  @date   November 2017
-*  @brief  Include file for 
-*/
-
-#ifndef __NAME_H
-#define __NAME_H
-
-
-/***** Constants  *************************************************/
-
-/***** Types      *************************************************/
-
-/***** Exported functions   ***************************************/
-
-#endif  /*  __NAME_H  */
+/**
+*  @file   name.h
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Include file for 
+*/
+
+#ifndef __NAME_H
+#define __NAME_H
+
+
+/***** Constants  *************************************************/
+
+/***** Types      *************************************************/
+
+/***** Exported functions   ***************************************/
+
+#endif  /*  __NAME_H  */
@@ -0,0 +1,237 @@
+/**
+*  @file   BenchDirtyRows.c
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Host benchmark of dirty row copying, built with VIDEO_DIRTY_ROWS
+*          Runs the space invaders game, with scripted buttons, and the
+*          starfield from the main loop against the emulated video timing,
+*          and reports the bytes copied into FrameBuff each frame against a
+*          whole buffer copy. Checks that no frame copies more than the whole
+*          buffer, and that FrameBuff matches the back buffer after a last
+*          commit, so no drawing missed marking its rows. Invaders fires as
+*          fast as the game allows, so the missile often crosses aliens
+*          being erased and redrawn, and each frame its playfield must hold
+*          only the one missile
+*/
+
+/***** Include files  *********************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stm32f10x.h"
+#include "bsp.h"
+#include "Graphics.h"
+#include "Invaders.h"
+#include "Starfield.h"
+#include "HostPeriph.h"
+#include "TestUtil.h"
+
+/***** Constants  *************************************************/
+#define BENCH_FRAMES          500U
+#define LOOP_TICKS            40U      /* main loop pass, 5us */
+#define BUTTON_PHASE_FRAMES   50U      /* frames of each laser move */
+#define FIRE_INTERVAL         3U       /* frames between pressing fire */
+#define PLAY_TOP              20U      /* rows between the score and the shelters */
+#define PLAY_BOTTOM           183U
+#define MISSILE_LEN           3U
+
+/***** Types      *************************************************/
+typedef struct
+{
+   uint32_t frames;
+   uint32_t total;
+   uint32_t max;
+} tCopyStats;
+
+/***** Storage    *************************************************/
+static uint32_t frameCount;
+static uint32_t frameStartBytes;
+static uint8_t  lastBroad;
+static tCopyStats Stats;
+
+/***** Local prototypes    ****************************************/
+static void runApp(const char* name, void (*pStep)(void), void (*pCheck)(void));
+static void stepInvaders(void);
+static void checkInvaders(void);
+static uint16_t countMissiles(void);
+static uint8_t isLit(int16_t x, int16_t y);
+static void onPeriod(uint16_t arr, uint16_t ccr1);
+
+/***** Exported functions  ****************************************/
+int main(void)
+{
+   runApp("Invaders", stepInvaders, checkInvaders);
+   runApp("Starfield", StarfieldSim, 0);
+   return 0;
+}
+
+/**
+*  @fn     ReadGameButtons
+*  @return buttons, pressed low. Moves the laser right, then left, with
+*          pauses between, pressing fire at intervals
+*/
+uint16_t ReadGameButtons(void)
+{
+   uint16_t pressed = 0;
+
+   switch((frameCount / BUTTON_PHASE_FRAMES) % 4U)
+   {
+      case 0:  pressed = GAME_BTN_2;  break;
+      case 2:  pressed = GAME_BTN_3;  break;
+      default:                        break;
+   }
+   if((frameCount % FIRE_INTERVAL) < 2U)
+      pressed |= GAME_BTN_1;
+   return 0x07U & ~pressed;
+}
+
+/***** Local    functions  ****************************************/
+
+/**
+*  @fn         runApp
+*  @param[IN]  name, for the report
+*  @param[IN]  application step, called each main loop pass
+*  @param[IN]  check of the screen after each frame starts, or 0
+*  @brief      Runs the main loop for BENCH_FRAMES frames from a blank
+*              screen, as main() does
+*/
+static void runApp(const char* name, void (*pStep)(void), void (*pCheck)(void))
+{
+   uint16_t used;
+   uint32_t full;
+   uint32_t frame;
+
+   TIM_Cmd(TIM1, DISABLE);
+   HostReset();
+   pHostPeriodHook = onPeriod;
+   CHECK(VideoSetMode(VIDEO_MODE_320x240) == 0, "video mode not supported");
+   GraphicsInit();
+   ClearScreen();
+   VideoCommitDirty();
+   memset(&Stats, 0, sizeof(Stats));
+   frameCount = 0;
+   frameStartBytes = HostDmaCopyBytes;
+   lastBroad = 0;
+
+   while(frameCount < BENCH_FRAMES)
+   {
+      frame = frameCount;
+      pStep();
+      GraphicsTick();
+      HostSpend(LOOP_TICKS);
+      if((pCheck != 0) && (frameCount != frame))
+         pCheck();
+   }
+   TIM_Cmd(TIM1, DISABLE);
+
+   /* Anything drawn since the last commit, then the buffers must match */
+   VideoCommitDirty();
+   used = pVideoMode->height * pVideoMode->stride;
+   CHECK(memcmp(FrameBuff, BackBuff, used) == 0, "%s: FrameBuff differs from back buffer", name);
+
+   /* One commit a frame never copies more than the whole buffer */
+   full = used;
+   CHECK(Stats.max <= full, "%s: copied %u bytes in a frame, over a full copy", name, Stats.max);
+   printf("%-10s %4u frames, copied %6u bytes/frame mean, %6u max, %3u%% of a %u byte buffer copy\n",
+          name, Stats.frames, Stats.total / Stats.frames, Stats.max,
+          (Stats.total * 100U) / (Stats.frames * full), full);
+}
+
+/**
+*  @fn     stepInvaders
+*  @brief  Game step, as main() calls it
+*/
+static void stepInvaders(void)
+{
+   InvadersGame(BTN_NONE);
+}
+
+/**
+*  @fn         onPeriod
+*  @param[IN]  auto reload
+*  @param[IN]  sync pulse width, ticks
+*  @brief      Counts frames at the first broad sync pulse, and the bytes
+*              copied during the last one
+*/
+static void onPeriod(uint16_t arr, uint16_t ccr1)
+{
+   uint8_t broad = (ccr1 == pVideoTiming->long_sync);
+   uint32_t copied;
+
+   (void)arr;
+   if((broad != 0) && (lastBroad == 0))
+   {
+      copied = HostDmaCopyBytes - frameStartBytes;
+      frameStartBytes = HostDmaCopyBytes;
+      if(frameCount != 0)
+      {
+         Stats.frames++;
+         Stats.total += copied;
+         if(copied > Stats.max)
+            Stats.max = copied;
+      }
+      frameCount++;
+   }
+   lastBroad = broad;
+}
+
+/**
+*  @fn     checkInvaders
+*  @brief  Pixels cleared under the xor drawn missile are set again when
+*          it is erased, leaving a copy of it behind, so there must never
+*          be more than the one missile in flight
+*/
+static void checkInvaders(void)
+{
+   uint16_t missiles = countMissiles();
+
+   CHECK(missiles <= 1U, "Invaders: %u missiles in the playfield at frame %u", missiles, frameCount);
+}
+
+/**
+*  @fn     countMissiles
+*  @return lit runs in the playfield shaped as the missile, a column of
+*          MISSILE_LEN pixels touching nothing else
+*/
+static uint16_t countMissiles(void)
+{
+   int16_t x;
+   int16_t y;
+   int16_t y_top;
+   int16_t i;
+   uint8_t touching;
+   uint16_t missiles = 0;
+
+   for(x = 0; x < (int16_t)pVideoMode->width; x++)
+   {
+      for(y = PLAY_TOP; y <= (int16_t)PLAY_BOTTOM; y++)
+      {
+         if(isLit(x, y) == 0)
+            continue;
+         y_top = y;
+         while(isLit(x, y + 1) != 0)
+            y++;
+
+         touching = 0;
+         for(i = y_top - 1; i <= (y + 1); i++)
+            touching |= isLit(x - 1, i) | isLit(x + 1, i);
+         if((touching == 0) && ((y - y_top + 1) == (int16_t)MISSILE_LEN))
+            missiles++;
+      }
+   }
+   return missiles;
+}
+
+/**
+*  @fn         isLit
+*  @param[IN]  x coordinate
+*  @param[IN]  y coordinate
+*  @return     1 if the pixel is set in the draw buffer, 0 if not or outside
+*              the playfield
+*/
+static uint8_t isLit(int16_t x, int16_t y)
+{
+   if((x < 0) || (x >= (int16_t)pVideoMode->width) || (y < (int16_t)PLAY_TOP) || (y > (int16_t)PLAY_BOTTOM))
+      return 0;
+   return (uint8_t)((pDrawBuff[(y * pVideoMode->stride) + (x >> 3)] >> (7 - (x & 7))) & 1U);
+}
@@ -0,0 +1,736 @@
+/**
+*  @file   BenchGraphics.c
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Host benchmarks of the drawing primitives
+*          Each item is called in batches, timed by the host clock scaled to
+*          INSTR_CLOCK cycles in InstrFakeCycles, and recorded on its
+*          instrumentation channel, which is reset between items. Times are
+*          the fastest batch, per call, so only ratios between items mean
+*          anything on the target
+*/
+
+/***** Include files  *********************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "stm32f10x.h"
+#include "Graphics.h"
+#include "GraphText.h"
+#include "Sprites.h"
+#include "TextMode.h"
+#include "Instrument.h"
+#include "TestUtil.h"
+
+/***** Constants  *************************************************/
+#define BENCH_REPS            1000U    /* calls in each timed batch */
+#define BENCH_SAMPLES         25U      /* batches of each item      */
+#define BENCH_NUM_ALIGN       8U       /* bit alignments within a byte */
+#define BENCH_Y               8U
+#define BENCH_NUM_FILLS       5U
+#define BENCH_NUM_RADII       3U
+#define BENCH_TEXT_LEN        240U     /* characters of the string measured */
+#define BENCH_TEXT_X          3U       /* odd bit alignment */
+#define BENCH_COUNT           12345U   /* status page number, incremented by each update */
+#define BENCH_COUNT_COL       3U       /* its character cell */
+#define BENCH_COUNT_ROW       2U
+
+/***** Types      *************************************************/
+typedef struct
+{
+   const char*   name;
+   const tImage* pImage;
+} tBenchImage;
+
+typedef struct
+{
+   const char* name;
+   uint16_t width;
+   uint16_t height;
+} tBenchFill;
+
+/***** Storage    *************************************************/
+static const tBenchImage BenchImages[] = {
+      {"Invader10pt_1", &Invader10pt_1}, {"Invader10pt_2", &Invader10pt_2},
+      {"Invader20pt_1", &Invader20pt_1}, {"Invader20pt_2", &Invader20pt_2},
+      {"Invader30pt_1", &Invader30pt_1}, {"Invader30pt_2", &Invader30pt_2},
+      {"InvaderExplode", &InvaderExplode}, {"Laser", &Laser},
+      {"LaserExplode1", &LaserExplode1}, {"LaserExplode2", &LaserExplode2},
+      {"MissileCross", &MissileCross},
+      {"MissileWiggle1", &MissileWiggle1}, {"MissileWiggle2", &MissileWiggle2},
+      {"Shelter", &Shelter}, {"Spaceship", &Spaceship}
+      };
+
+/* Rectangles cleared by Invaders */
+static const tBenchFill BenchFills[BENCH_NUM_FILLS] = {
+      {"alien", 12, 8}, {"explosion", 13, 8}, {"shelter", 22, 16},
+      {"score", 32, 10}, {"band", NUM_X_PIXELS, 16}
+      };
+
+/* Text scroller and Invaders score strings */
+static const char* const BenchStrings[] = {"Analogue Heaven", "SCORE<1>", "CREDIT 03"};
+
+static const char* const FontNames[MAX_FONT] = {
+      "FixedSys8_14", "CourierNew8_14", "NokiaLargex_13", "DejaVueSans6x10"
+      };
+
+/* Radar and HUD discs */
+static const uint16_t BenchRadii[BENCH_NUM_RADII] = {8, 20, 50};
+
+/* Item being timed, set before each call to benchItem() */
+static struct
+{
+   const tImage* pImage;
+   uint16_t x;
+   uint16_t y;
+   uint16_t width;
+   uint16_t height;
+   uint16_t radius;
+   uint8_t* pText;
+   uint16_t count;
+   uint8_t  action;
+} Bench;
+
+static uint8_t ScreenCopy[VIDEO_BUFF_SIZE];
+static uint8_t BenchText[BENCH_TEXT_LEN + 1U];
+
+/***** Local prototypes    ****************************************/
+static void benchBitmaps(void);
+static void benchFills(void);
+static void benchCircles(void);
+static void benchTextLen(void);
+static void benchText(void);
+static void benchTextMode(void);
+static uint32_t benchItem(tInstrChannel channel, void (*pCall)(void));
+static void hostClock(void);
+static void callPutBitmap(void);
+static void callBytesBitmap(void);
+static void bytesPutBitmap(const tImage* pImage, uint16_t x, uint16_t y, uint8_t action);
+static void callFillRectangle(void);
+static void callRowsFill(void);
+static void rowsFillRectangle(tGraphCtx* pCtx, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                              uint8_t action);
+static void callFillCircle(void);
+static void callPutCircles(void);
+static void callGetTextLen(void);
+static void callCharsTextLen(void);
+static uint16_t charsTextLen(const uint8_t* str);
+static void callPutText(void);
+static void callPutChars(void);
+static void callPutInt16(void);
+static void callTextMode(void);
+static void printCycles(uint32_t cycles);
+
+/***** Exported functions  ****************************************/
+int main(void)
+{
+   InstrInit();
+   TestScreenInit(VIDEO_MODE_320x240);
+   printf("BenchGraphics: %u MHz cycles of host time per call, fastest of %u batches of %u\n",
+          (unsigned)(INSTR_CLOCK / 1000000UL), BENCH_SAMPLES, BENCH_REPS);
+   benchBitmaps();
+   benchFills();
+   benchCircles();
+   benchTextLen();
+   benchText();
+   benchTextMode();
+   return 0;
+}
+
+/***** Local    functions  ****************************************/
+
+/**
+*  @fn     benchBitmaps
+*  @brief  PutBitmap, a 32 bit word per row, against the byte at a time
+*          blitter it replaced, for every sprite at each bit alignment.
+*          Both must draw the same pixels
+*/
+static void benchBitmaps(void)
+{
+   uint16_t i;
+   uint16_t align;
+   uint32_t words;
+   uint32_t bytes;
+   uint32_t total_words = 0;
+   uint32_t total_bytes = 0;
+   uint16_t used = pVideoMode->height * pVideoMode->stride;
+
+   printf("\n%-27s", "PutBitmap, SET     align");
+   for(align = 0; align < BENCH_NUM_ALIGN; align++)
+      printf(" %7u", align);
+   printf("\n");
+   for(i = 0; i < (sizeof(BenchImages) / sizeof(BenchImages[0])); i++)
+   {
+      Bench.pImage = BenchImages[i].pImage;
+      Bench.y = BENCH_Y;
+      Bench.action = GRAPH_SET;
+
+      printf("%-15s %2ux%-2u words", BenchImages[i].name, Bench.pImage->width, Bench.pImage->height);
+      for(align = 0; align < BENCH_NUM_ALIGN; align++)
+      {
+         Bench.x = align;
+         ClearScreen();
+         callBytesBitmap();
+         memcpy(ScreenCopy, pDrawBuff, used);
+         ClearScreen();
+         words = benchItem(INSTR_PUT_BITMAP, callPutBitmap);
+         CHECK(memcmp(ScreenCopy, pDrawBuff, used) == 0, "%s at %u drawn differently by the blitters",
+               BenchImages[i].name, align);
+         total_words += words;
+         printCycles(words);
+      }
+      printf("\n%21s bytes", "");
+      for(align = 0; align < BENCH_NUM_ALIGN; align++)
+      {
+         Bench.x = align;
+         bytes = benchItem(INSTR_PUT_BITMAP, callBytesBitmap);
+         total_bytes += bytes;
+         printCycles(bytes);
+      }
+      printf("\n");
+   }
+   ClearScreen();
+   printf("All sprites and alignments, words take %u%% of the time of bytes\n",
+          (total_words * 100U) / total_bytes);
+}
+
+/**
+*  @fn     benchFills
+*  @brief  FillRectangle, masks worked out once and words written, against
+*          the row at a time fill it replaced, for the rectangles Invaders
+*          clears at each bit alignment. Both must fill the same pixels
+*/
+static void benchFills(void)
+{
+   uint16_t i;
+   uint16_t align;
+   uint16_t aligns;
+   uint32_t words;
+   uint32_t total_words = 0;
+   uint32_t total_rows = 0;
+   uint32_t small_words = 0;
+   uint32_t small_rows = 0;
+   uint32_t rows;
+   uint16_t used = pVideoMode->height * pVideoMode->stride;
+
+   printf("\n%-27s", "FillRectangle, CLEAR align");
+   for(align = 0; align < BENCH_NUM_ALIGN; align++)
+      printf(" %7u", align);
+   printf("\n");
+   for(i = 0; i < BENCH_NUM_FILLS; i++)
+   {
+      Bench.y = BENCH_Y;
+      Bench.width = BenchFills[i].width;
+      Bench.height = BenchFills[i].height;
+      aligns = (Bench.width < NUM_X_PIXELS) ? BENCH_NUM_ALIGN : 1U;
+
+      printf("%-14s %3ux%-2u words", BenchFills[i].name, Bench.width, Bench.height);
+      for(align = 0; align < aligns; align++)
+      {
+         Bench.x = align;
+         Bench.action = GRAPH_SET;
+         ClearScreen();
+         callRowsFill();
+         memcpy(ScreenCopy, pDrawBuff, used);
+         ClearScreen();
+         callFillRectangle();
+         CHECK(memcmp(ScreenCopy, pDrawBuff, used) == 0, "%s at %u filled differently",
+               BenchFills[i].name, align);
+         Bench.action = GRAPH_CLEAR;
+         words = benchItem(INSTR_FILL_RECT, callFillRectangle);
+         total_words += words;
+         if(aligns > 1U)
+            small_words += words;
+         printCycles(words);
+      }
+      printf("\n%21s rows ", "");
+      for(align = 0; align < aligns; align++)
+      {
+         Bench.x = align;
+         rows = benchItem(INSTR_FILL_RECT, callRowsFill);
+         total_rows += rows;
+         if(aligns > 1U)
+            small_rows += rows;
+         printCycles(rows);
+      }
+      printf("\n");
+   }
+   ClearScreen();
+   printf("All rectangles and alignments, words take %u%% of the time of rows\n",
+          (total_words * 100U) / total_rows);
+   printf("Sprite sized rectangles, words take %u%% of the time of rows\n",
+          (small_words * 100U) / small_rows);
+}
+
+/**
+*  @fn     benchCircles
+*  @brief  FillCircle, drawn as spans, against the concentric PutCircle
+*          outlines used to fake a filled disc, at the screen centre
+*/
+static void benchCircles(void)
+{
+   uint16_t i;
+   uint32_t fill;
+   uint32_t outlines;
+
+   printf("\n%-27s %7s %7s\n", "Disc, SET        radius", "fill", "circles");
+   Bench.x = NUM_X_PIXELS / 2U;
+   Bench.y = NUM_Y_PIXELS / 2U;
+   Bench.action = GRAPH_SET;
+   for(i = 0; i < BENCH_NUM_RADII; i++)
+   {
+      Bench.radius = BenchRadii[i];
+      fill = benchItem(INSTR_FILL_RECT, callFillCircle);
+      outlines = benchItem(INSTR_FILL_RECT, callPutCircles);
+      printf("%27u", Bench.radius);
+      printCycles(fill);
+      printCycles(outlines);
+      printf("  fill takes %u%%\n", (fill * 100U) / outlines);
+   }
+   ClearScreen();
+}
+
+/**
+*  @fn     benchTextLen
+*  @brief  GetTextLen, from the width table, against looking up each
+*          character's glyph through the font accessor, for a long string
+*          of every printable character in FixedSys
+*/
+static void benchTextLen(void)
+{
+   uint16_t i;
+   uint32_t table;
+   uint32_t chars;
+
+   for(i = 0; i < BENCH_TEXT_LEN; i++)
+      BenchText[i] = (uint8_t)(' ' + (i % ('~' - ' ' + 1U)));
+   BenchText[BENCH_TEXT_LEN] = 0;
+   SetFont(FIXEDSYS_8_14);
+   CHECK(GetTextLen(BenchText) == charsTextLen(BenchText), "GetTextLen %u pixels, glyphs %u",
+         GetTextLen(BenchText), charsTextLen(BenchText));
+
+   table = benchItem(INSTR_PUT_TEXT, callGetTextLen);
+   chars = benchItem(INSTR_PUT_TEXT, callCharsTextLen);
+   printf("\n%-27s %7s %7s\n", "Text length        chars", "table", "glyphs");
+   printf("%27u", BENCH_TEXT_LEN);
+   printCycles(table);
+   printCycles(chars);
+   printf("  table takes %u%%\n", (table * 100U) / chars);
+}
+
+/**
+*  @fn     benchText
+*  @brief  PutText, each frame buffer row written once for the whole string,
+*          against a GPutChar call for each character, in every font at an
+*          odd bit alignment. Both must draw the same pixels
+*/
+static void benchText(void)
+{
+   uint16_t font;
+   uint16_t i;
+   uint32_t run;
+   uint32_t chars;
+   uint16_t used = pVideoMode->height * pVideoMode->stride;
+
+   printf("\n%-32s %7s %7s\n", "PutText, SET", "run", "chars");
+   Bench.x = BENCH_TEXT_X;
+   Bench.y = BENCH_Y;
+   Bench.action = GRAPH_SET;
+   for(font = MIN_FONT; font < MAX_FONT; font++)
+   {
+      SetFont((fontselect_t)font);
+      for(i = 0; i < (sizeof(BenchStrings) / sizeof(BenchStrings[0])); i++)
+      {
+         Bench.pText = (uint8_t*)BenchStrings[i];
+         ClearScreen();
+         callPutChars();
+         memcpy(ScreenCopy, pDrawBuff, used);
+         ClearScreen();
+         run = benchItem(INSTR_PUT_TEXT, callPutText);
+         CHECK(memcmp(ScreenCopy, pDrawBuff, used) == 0, "%s \"%s\" drawn differently",
+               FontNames[font], BenchStrings[i]);
+         chars = benchItem(INSTR_PUT_TEXT, callPutChars);
+         printf("%-15s %-16s", FontNames[font], BenchStrings[i]);
+         printCycles(run);
+         printCycles(chars);
+         printf("  run takes %u%%\n", (run * 100U) / chars);
+      }
+   }
+   ClearScreen();
+}
+
+/**
+*  @fn     benchTextMode
+*  @brief  Updating a number on a status page, where mostly the last digit
+*          changes. Character cell text mode renders only the changed cells,
+*          against erasing and redrawing the number with PutInt16. Both must
+*          show the same number
+*/
+static void benchTextMode(void)
+{
+   uint32_t cells;
+   uint32_t redraw;
+   uint16_t used = pVideoMode->height * pVideoMode->stride;
+
+   Bench.x = BENCH_COUNT_COL * TEXTMODE_CELL_WIDTH;
+   Bench.y = BENCH_COUNT_ROW * TEXTMODE_CELL_HEIGHT;
+   SetFont(FIXEDSYS_8_14);
+   Bench.width = GetTextLen((uint8_t*)"00000");
+   Bench.height = GetTextHeight((uint8_t*)"00000");
+
+   ClearScreen();
+   Bench.count = BENCH_COUNT;
+   callPutInt16();
+   memcpy(ScreenCopy, pDrawBuff, used);
+   ClearScreen();
+   CHECK(TextModeInit(&PackedFixedSys8_14) != 0, "text mode does not take FixedSys");
+   Bench.count = BENCH_COUNT;
+   callTextMode();
+   CHECK(memcmp(ScreenCopy, pDrawBuff, used) == 0, "text mode number differs from PutInt16");
+
+   cells = benchItem(INSTR_TEXT_MODE, callTextMode);
+   ClearScreen();
+   redraw = benchItem(INSTR_PUT_TEXT, callPutInt16);
+   printf("\n%-32s %7s %7s\n", "Status number update", "cells", "redraw");
+   printf("%-32s", "FixedSys8_14 5 digits");
+   printCycles(cells);
+   printCycles(redraw);
+   printf("  cells take %u%%\n", (cells * 100U) / redraw);
+   ClearScreen();
+}
+
+/**
+*  @fn         benchItem
+*  @param[IN]  instrumentation channel to record on
+*  @param[IN]  call to time, with its arguments in Bench
+*  @return     fastest batch, cycles per BENCH_REPS calls
+*/
+static uint32_t benchItem(tInstrChannel channel, void (*pCall)(void))
+{
+   uint16_t sample;
+   uint16_t rep;
+   uint32_t start;
+
+   InstrReset();
+   for(sample = 0; sample < BENCH_SAMPLES; sample++)
+   {
+      hostClock();
+      start = INSTR_CYCLES();
+      for(rep = 0; rep < BENCH_REPS; rep++)
+         pCall();
+      hostClock();
+      InstrRecord(channel, INSTR_CYCLES() - start);
+   }
+   return InstrGetStats(channel)->min;
+}
+
+/**
+*  @fn     hostClock
+*  @brief  Loads InstrFakeCycles from the host monotonic clock
+*/
+static void hostClock(void)
+{
+   struct timespec now;
+
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   InstrFakeCycles = (uint32_t)((((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec) *
+                                (INSTR_CLOCK / 1000000UL) / 1000U);
+}
+
+/**
+*  @fn     callPutBitmap
+*  @brief  Draws Bench.pImage with PutBitmap
+*/
+static void callPutBitmap(void)
+{
+   GotoXY(Bench.x, Bench.y);
+   PutBitmap((tImage*)Bench.pImage, Bench.action);
+}
+
+/**
+*  @fn     callBytesBitmap
+*  @brief  Draws Bench.pImage with the byte at a time blitter
+*/
+static void callBytesBitmap(void)
+{
+   GotoXY(Bench.x, Bench.y);
+   bytesPutBitmap(Bench.pImage, Bench.x, Bench.y, Bench.action);
+}
+
+/**
+*  @fn         bytesPutBitmap
+*  @param[IN]  image
+*  @param[IN]  x coordinate
+*  @param[IN]  y coordinate
+*  @param[IN]  action, GRAPH_SET or GRAPH_CLEAR
+*  @brief      PutBitmap as it was, a frame buffer byte at a time with the
+*              shifts and action worked out for each byte
+*/
+static void bytesPutBitmap(const tImage* pImage, uint16_t x, uint16_t y, uint8_t action)
+{
+   uint8_t* p_fb = pDrawBuff + (y * pVideoMode->stride) + (x >> 3);
+   const uint8_t* p_img = pImage->bitmap;
+   uint8_t bit_pos = x & 7U;
+   uint16_t n_fb = (bit_pos + pImage->width + 7U) >> 3;
+   uint16_t n_img = (pImage->width + 7U) >> 3;
+   uint16_t rows = pImage->height;
+   uint16_t i_img;
+   uint16_t i_fb;
+   uint8_t mask;
+
+   while(rows--)
+   {
+      i_img = 0; i_fb = 0;
+      do
+      {
+         mask = 0;
+         if(i_fb != 0)
+         {
+            mask |= (p_img[i_img] << (8 - bit_pos));  /* rightmost section of prev image byte */
+            i_img++;
+         }
+         if(i_img < n_img)
+            mask |= p_img[i_img] >> bit_pos;          /* leftmost section of image byte */
+
+         if(action == GRAPH_SET)
+            p_fb[i_fb] |= mask;
+         else if(action == GRAPH_CLEAR)
+            p_fb[i_fb] &= ~mask;
+         i_fb++;
+      }
+      while(i_fb < n_fb);
+      p_img += n_img;
+      p_fb += pVideoMode->stride;
+   }
+}
+
+/**
+*  @fn         printCycles
+*  @param[IN]  cycles for BENCH_REPS calls
+*  @brief      Prints cycles per call, to a tenth
+*/
+static void printCycles(uint32_t cycles)
+{
+   uint32_t tenths = (cycles * 10U) / BENCH_REPS;
+
+   printf(" %5u.%u", tenths / 10U, tenths % 10U);
+}
+
+/**
+*  @fn     callFillRectangle
+*  @brief  Fills the Bench rectangle with FillRectangle
+*/
+static void callFillRectangle(void)
+{
+   FillRectangle(Bench.x, Bench.y, Bench.x + Bench.width - 1U, Bench.y + Bench.height - 1U, Bench.action);
+}
+
+/**
+*  @fn     callRowsFill
+*  @brief  Fills the Bench rectangle a row at a time, on the screen context
+*          as FillRectangle does
+*/
+static void callRowsFill(void)
+{
+   rowsFillRectangle(GraphGetScreen(), Bench.x, Bench.y, Bench.x + Bench.width - 1U, Bench.y + Bench.height - 1U, Bench.action);
+}
+
+/**
+*  @fn         rowsFillRectangle
+*  @param[IN]  graphics context
+*  @param[IN]  x1 top left x coordinate
+*  @param[IN]  y1 top left y coordinate
+*  @param[IN]  x2 bottom right x coordinate
+*  @param[IN]  y2 bottom right y coordinate
+*  @param[IN]  action, GRAPH_SET or GRAPH_CLEAR
+*  @brief      FillRectangle as it was, a horizontal line per row with the
+*              masks and action worked out for each. Clipped to the context
+*              once, as FillRectangleCtx() is, so only the fill differs
+*/
+static void rowsFillRectangle(tGraphCtx* pCtx, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                              uint8_t action)
+{
+   tClipRect clip = pCtx->clip;
+   uint16_t y;
+   uint16_t len;
+   uint8_t bit_pos;
+   uint8_t s_mask;
+   uint8_t e_mask;
+   uint8_t* p_fb;
+
+   if(clip.x2 >= pCtx->width)
+      clip.x2 = pCtx->width - 1U;
+   if(clip.y2 >= pCtx->height)
+      clip.y2 = pCtx->height - 1U;
+   if(x1 < clip.x1)
+      x1 = clip.x1;
+   if(y1 < clip.y1)
+      y1 = clip.y1;
+   if(x2 > clip.x2)
+      x2 = clip.x2;
+   if(y2 > clip.y2)
+      y2 = clip.y2;
+   if((x1 > x2) || (y1 > y2))
+      return;
+   bit_pos = x1 & 7U;
+
+   for(y = y1; y <= y2; y++)
+   {
+      p_fb = pCtx->pTarget + (y * pCtx->stride) + (x1 >> 3);
+      len = x2 - x1 + 1U;
+
+      /* write non byte aligned pixels at start of line */
+      if(bit_pos > 0)
+      {
+         s_mask = 0xff >> bit_pos;
+         if((bit_pos + len) < 8)
+         {
+            s_mask &= 0xff << (8 - (bit_pos + len));
+            len = 0;
+         }
+         else
+            len -= (8 - bit_pos);
+
+         if(action == GRAPH_SET)
+            *p_fb |= s_mask;
+         else if(action == GRAPH_CLEAR)
+            *p_fb &= ~s_mask;
+         p_fb++;
+      }
+
+      while(len >= 8)
+      {
+         if(action == GRAPH_SET)
+            *p_fb = 0xff;
+         else if(action == GRAPH_CLEAR)
+            *p_fb = 0;
+         len -= 8;
+         p_fb++;
+      }
+
+      /* write non byte aligned pixels at end of line */
+      if(len > 0)
+      {
+         e_mask = 0xff << (8 - len);
+         if(action == GRAPH_SET)
+            *p_fb |= e_mask;
+         else if(action == GRAPH_CLEAR)
+            *p_fb &= ~e_mask;
+      }
+   }
+}
+
+/**
+*  @fn     callFillCircle
+*  @brief  Draws the Bench disc with FillCircle
+*/
+static void callFillCircle(void)
+{
+   FillCircle(Bench.x, Bench.y, Bench.radius, Bench.action);
+}
+
+/**
+*  @fn     callPutCircles
+*  @brief  Draws the Bench disc as an outline at each radius up to its own
+*/
+static void callPutCircles(void)
+{
+   uint16_t r;
+
+   for(r = 0; r <= Bench.radius; r++)
+      PutCircle(Bench.x, Bench.y, r, Bench.action);
+}
+
+/**
+*  @fn     callGetTextLen
+*  @brief  Measures BenchText with GetTextLen
+*/
+static void callGetTextLen(void)
+{
+   volatile uint16_t len;
+
+   len = GetTextLen(BenchText);
+   (void)len;
+}
+
+/**
+*  @fn     callCharsTextLen
+*  @brief  Measures BenchText a glyph at a time
+*/
+static void callCharsTextLen(void)
+{
+   volatile uint16_t len;
+
+   len = charsTextLen(BenchText);
+   (void)len;
+}
+
+/**
+*  @fn         charsTextLen
+*  @param[IN]  string, FixedSys characters only
+*  @return     width, pixels
+*  @brief      GetTextLen as it was, an indirect call to the font accessor
+*              for each character's glyph
+*/
+static uint16_t charsTextLen(const uint8_t* str)
+{
+   const tChar* (* volatile get_font_char)(uint8_t) = &GetFontFixedSys8_14;
+   uint16_t x_pixels = 0;
+
+   while(*str != 0)
+      x_pixels += get_font_char(*str++)->image->width;
+   return x_pixels;
+}
+
+/**
+*  @fn     callPutText
+*  @brief  Draws Bench.pText with PutText
+*/
+static void callPutText(void)
+{
+   GotoXY(Bench.x, Bench.y);
+   PutText(Bench.pText, Bench.action);
+}
+
+/**
+*  @fn     callPutChars
+*  @brief  Draws Bench.pText a character at a time with GPutChar
+*/
+static void callPutChars(void)
+{
+   uint8_t* str = Bench.pText;
+
+   GotoXY(Bench.x, Bench.y);
+   while(*str != 0)
+      GPutChar(*str++, Bench.action);
+}
+
+/**
+*  @fn     callPutInt16
+*  @brief  Erases the status number and draws the next with PutInt16
+*/
+static void callPutInt16(void)
+{
+   FillRectangle(Bench.x, Bench.y, Bench.x + Bench.width - 1U, Bench.y + Bench.height - 1U, GRAPH_CLEAR);
+   GotoXY(Bench.x, Bench.y);
+   PutInt16(Bench.count++, GRAPH_SET);
+}
+
+/**
+*  @fn     callTextMode
+*  @brief  Writes the next status number into its cells and renders the
+*          cells that changed
+*/
+static void callTextMode(void)
+{
+   uint8_t str[6];
+   uint16_t val = Bench.count++;
+   uint8_t i;
+
+   for(i = 0; i < 5U; i++, val /= 10U)
+      str[4U - i] = (uint8_t)((val % 10U) + '0');
+   str[5] = 0;
+   TextModePutText(BENCH_COUNT_COL, BENCH_COUNT_ROW, str, 0);
+   TextModeRender(TEXTMODE_COLS * TEXTMODE_ROWS);
+}
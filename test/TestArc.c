@@ -0,0 +1,140 @@
+/**
+*  @file   TestArc.c
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Host test of FillCircle, FillEllipse and FillArc
+*          Random shapes, partly off screen, are compared with a floating
+*          point test of each pixel against the ellipse of radii r+0.5. Arc
+*          pixels within ARC_EDGE_TOLERANCE degrees of either edge are not
+*          checked, as the table driven edge may round either way. Each
+*          shape is drawn with XOR and with set, which match only if no
+*          span is drawn twice
+*/
+
+/***** Include files  *********************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "stm32f10x.h"
+#include "Graphics.h"
+#include "TestUtil.h"
+
+/***** Constants  *************************************************/
+#define NUM_RANDOM_SHAPES     2000U
+#define ARC_EDGE_TOLERANCE    1.5      /* degrees */
+
+/***** Types      *************************************************/
+typedef enum {SHAPE_CIRCLE = 0, SHAPE_ELLIPSE, SHAPE_ARC, NUM_SHAPES} tShape;
+
+typedef struct
+{
+   tShape shape;
+   uint16_t cx;
+   uint16_t cy;
+   uint16_t rx;
+   uint16_t ry;
+   uint16_t start;
+   uint16_t end;
+} tShapeParams;
+
+/***** Storage    *************************************************/
+static uint8_t Reference[VIDEO_BUFF_SIZE];
+
+/***** Local prototypes    ****************************************/
+static void drawShape(const tShapeParams* p_shape, uint8_t action);
+static void checkShape(const tShapeParams* p_shape, uint16_t t);
+
+/***** Exported functions  ****************************************/
+int main(void)
+{
+   tShapeParams shape;
+   uint16_t t;
+
+   srand(5);
+   GraphicsInit();
+   TestScreenInit(VIDEO_MODE_320x240);
+   for(t = 0; t < NUM_RANDOM_SHAPES; t++)
+   {
+      shape.shape = (tShape)(rand() % NUM_SHAPES);
+      shape.cx = rand() % 340;
+      shape.cy = rand() % 260;
+      shape.rx = rand() % 150;
+      shape.ry = (shape.shape == SHAPE_ELLIPSE) ? (rand() % 150) : shape.rx;
+      shape.start = rand() % 720;
+      shape.end = rand() % 720;
+
+      ClearScreen();
+      drawShape(&shape, GRAPH_SET);
+      memcpy(Reference, pDrawBuff, VIDEO_BUFF_SIZE);
+      ClearScreen();
+      drawShape(&shape, GRAPH_XOR);
+      CHECK(memcmp(Reference, pDrawBuff, VIDEO_BUFF_SIZE) == 0,
+            "shape %u kind %d at %u,%u radii %u,%u angles %u,%u has a span drawn twice",
+            t, shape.shape, shape.cx, shape.cy, shape.rx, shape.ry, shape.start, shape.end);
+      TestCheckTrailers();
+      checkShape(&shape, t);
+   }
+   printf("TestArc: ok\n");
+   return 0;
+}
+
+/***** Local    functions  ****************************************/
+
+static void drawShape(const tShapeParams* p_shape, uint8_t action)
+{
+   switch(p_shape->shape)
+   {
+      case SHAPE_CIRCLE:
+         FillCircle(p_shape->cx, p_shape->cy, p_shape->rx, action);
+      break;
+
+      case SHAPE_ELLIPSE:
+         FillEllipse(p_shape->cx, p_shape->cy, p_shape->rx, p_shape->ry, action);
+      break;
+
+      default:
+         FillArc(p_shape->cx, p_shape->cy, p_shape->rx, p_shape->start, p_shape->end, action);
+      break;
+   }
+}
+
+/**
+*  @fn         checkShape
+*  @param[IN]  shape drawn
+*  @param[IN]  shape number, for the report
+*  @brief      Compares every screen pixel with the floating point shape
+*/
+static void checkShape(const tShapeParams* p_shape, uint16_t t)
+{
+   double rx = p_shape->rx + 0.5;
+   double ry = p_shape->ry + 0.5;
+   double start = p_shape->start % 360;
+   double span = fmod((p_shape->end % 360) - start + 360.0, 360.0);
+   double dx, dy, angle, rel;
+   uint8_t inside;
+   uint16_t x, y;
+
+   for(y = 0; y < pVideoMode->height; y++)
+   {
+      for(x = 0; x < pVideoMode->width; x++)
+      {
+         dx = (double)x - p_shape->cx;
+         dy = (double)p_shape->cy - y;
+         inside = (((dx * dx) / (rx * rx)) + ((dy * dy) / (ry * ry))) <= 1.0;
+         if((p_shape->shape == SHAPE_ARC) && inside && (span != 0.0))
+         {
+            angle = atan2(dy, dx) * 180.0 / M_PI;
+            rel = ((dx == 0.0) && (dy == 0.0)) ? 0.0 : fmod(angle - start + 720.0, 360.0);
+            if((fabs(rel - span) < ARC_EDGE_TOLERANCE) || (rel < ARC_EDGE_TOLERANCE) ||
+               (rel > (360.0 - ARC_EDGE_TOLERANCE)))
+               continue;
+            inside = rel <= span;
+         }
+         CHECK(TestGetPixel(pDrawBuff, pVideoMode->stride, x, y) == inside,
+               "shape %u kind %d at %u,%u radii %u,%u angles %u,%u differs at %u,%u",
+               t, p_shape->shape, p_shape->cx, p_shape->cy, p_shape->rx, p_shape->ry,
+               p_shape->start, p_shape->end, x, y);
+      }
+   }
+}
@@ -0,0 +1,444 @@
+/**
+*  @file   TestClipFuzz.c
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Host fuzz test of clipping. Draws random primitives with random
+*          clip rectangles, actions and coordinates, many off screen, into
+*          the screen in two video modes and into off-screen buffers of
+*          random size and stride. Checks that no bit outside the target or
+*          clip rectangle changes, including row trailers, the frame buffer
+*          beyond the mode's rows and guard bytes around off-screen buffers.
+*          Fills and bitmaps are also compared with a per-pixel reference.
+*          Build with ASan, argument is the number of primitives per target
+*/
+
+/***** Include files  *********************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stm32f10x.h"
+#include "Graphics.h"
+#include "TestUtil.h"
+
+/***** Constants  *************************************************/
+#define DEFAULT_ITERATIONS    20000U
+#define GUARD_BYTES           64U
+#define OFFSCREEN_BYTES       4096U
+#define NUM_PRIMITIVES        13U
+#define REFRESH_INTERVAL      64U      /* primitives between refilling the target with noise */
+
+/***** Types      *************************************************/
+typedef struct
+{
+   uint16_t x1;            /* effective clip, inclusive, within the target */
+   uint16_t y1;
+   uint16_t x2;
+   uint16_t y2;
+} tTestClip;
+
+/***** Storage    *************************************************/
+static uint8_t Before[VIDEO_BUFF_SIZE];
+static uint8_t Reference[VIDEO_BUFF_SIZE];
+static uint8_t OffScreen[GUARD_BYTES + OFFSCREEN_BYTES + GUARD_BYTES];
+static uint8_t Image[64 * 32];
+
+/***** Local prototypes    ****************************************/
+static void fuzzScreen(tVideoModeId mode, uint32_t iterations);
+static void fuzzOffScreen(uint32_t iterations);
+static void setRandomClip(tGraphCtx* pCtx, tTestClip* p_clip);
+static uint8_t drawRandom(tGraphCtx* pCtx, const tTestClip* p_clip, uint8_t* pRef, uint8_t kind);
+static void checkClip(const tGraphCtx* pCtx, const tTestClip* p_clip, const uint8_t* pBefore,
+                      uint8_t kind, uint32_t iteration);
+static void refPixel(uint8_t* pRef, uint16_t stride, uint16_t x, uint16_t y, uint8_t on, uint8_t action, uint8_t fill);
+static uint8_t inClip(const tTestClip* p_clip, int32_t x, int32_t y);
+static int rnd(int n);
+static uint16_t randomCoord(void);
+
+/***** Exported functions  ****************************************/
+int main(int argc, char** argv)
+{
+   uint32_t iterations = (argc > 1) ? (uint32_t)atoi(argv[1]) : DEFAULT_ITERATIONS;
+
+   srand(7);
+   GraphicsInit();
+   fuzzScreen(VIDEO_MODE_320x240, iterations);
+   fuzzScreen(VIDEO_MODE_256x192, iterations);
+   fuzzScreen(VIDEO_MODE_320x120, iterations / 4U);
+   fuzzOffScreen(iterations);
+   printf("TestClipFuzz: ok\n");
+   return 0;
+}
+
+/***** Local    functions  ****************************************/
+
+/**
+*  @fn         fuzzScreen
+*  @param[IN]  video mode
+*  @param[IN]  number of primitives
+*  @brief      Draws on the screen context. Bytes of the frame buffer past the
+*              mode's rows are guard bytes, as are the row trailers
+*/
+static void fuzzScreen(tVideoModeId mode, uint32_t iterations)
+{
+   tGraphCtx* p_ctx = GraphGetScreen();
+   tTestClip clip;
+   uint32_t t;
+   uint32_t i;
+   uint32_t used;
+   uint8_t kind;
+
+   TestScreenInit(mode);
+   used = (uint32_t)pVideoMode->height * pVideoMode->stride;
+   for(t = 0; t < iterations; t++)
+   {
+      if((t % REFRESH_INTERVAL) == 0)
+      {
+         for(i = 0; i < VIDEO_BUFF_SIZE; i++)
+            pDrawBuff[i] = (uint8_t)rand();
+         for(i = pVideoMode->line_bytes; i < used; i += pVideoMode->stride)
+            pDrawBuff[i] = 0;
+      }
+      setRandomClip(p_ctx, &clip);
+      memcpy(Before, pDrawBuff, VIDEO_BUFF_SIZE);
+      memcpy(Reference, pDrawBuff, VIDEO_BUFF_SIZE);
+      kind = (uint8_t)rnd(NUM_PRIMITIVES);
+      if(drawRandom(p_ctx, &clip, Reference, kind) != 0)
+      {
+         CHECK(memcmp(Reference, pDrawBuff, VIDEO_BUFF_SIZE) == 0,
+               "mode %d primitive %u kind %u differs from reference", mode, t, kind);
+      }
+      checkClip(p_ctx, &clip, Before, kind, t);
+      CHECK(memcmp(&Before[used], &pDrawBuff[used], VIDEO_BUFF_SIZE - used) == 0,
+            "mode %d primitive %u kind %u wrote past the last row", mode, t, kind);
+   }
+   ResetClipRect();
+}
+
+/**
+*  @fn         fuzzOffScreen
+*  @param[IN]  number of primitives
+*  @brief      Draws into buffers of random width, height and stride, with
+*              guard bytes either side
+*/
+static void fuzzOffScreen(uint32_t iterations)
+{
+   tGraphCtx ctx;
+   tTestClip clip;
+   uint8_t* p_target = &OffScreen[GUARD_BYTES];
+   uint16_t width = 8, height = 8, stride = 1;
+   uint32_t size = 8;
+   uint32_t t;
+   uint32_t i;
+   uint8_t kind;
+
+   for(t = 0; t < iterations; t++)
+   {
+      if((t % REFRESH_INTERVAL) == 0)
+      {
+         width = 1 + rnd(200);
+         stride = ((width + 7U) / 8U) + rnd(3);
+         height = 1 + rnd(OFFSCREEN_BYTES / stride);
+         if(height > 150)
+            height = 150;
+         size = (uint32_t)stride * height;
+         for(i = 0; i < sizeof(OffScreen); i++)
+            OffScreen[i] = (uint8_t)rand();
+         GraphCtxInit(&ctx, p_target, width, height, stride);
+      }
+      setRandomClip(&ctx, &clip);
+      memcpy(Before, OffScreen, sizeof(OffScreen));
+      memcpy(Reference, p_target, size);
+      kind = (uint8_t)rnd(NUM_PRIMITIVES);
+      if(drawRandom(&ctx, &clip, Reference, kind) != 0)
+      {
+         CHECK(memcmp(Reference, p_target, size) == 0,
+               "off-screen %ux%u stride %u primitive %u kind %u differs from reference",
+               width, height, stride, t, kind);
+      }
+      checkClip(&ctx, &clip, &Before[GUARD_BYTES], kind, t);
+      CHECK((memcmp(Before, OffScreen, GUARD_BYTES) == 0) &&
+            (memcmp(&Before[GUARD_BYTES + size], &OffScreen[GUARD_BYTES + size], GUARD_BYTES) == 0),
+            "off-screen %ux%u stride %u primitive %u kind %u wrote outside the buffer",
+            width, height, stride, t, kind);
+   }
+}
+
+/**
+*  @fn         setRandomClip
+*  @param[IN]  graphics context
+*  @param[OUT] effective clip rectangle, limited to the target
+*  @brief      Sets no clip, a clip rectangle, or one partly or wholly outside
+*              the target
+*/
+static void setRandomClip(tGraphCtx* pCtx, tTestClip* p_clip)
+{
+   uint16_t width = (pCtx->flags & GRAPH_CTX_SCREEN) ? pVideoMode->width : pCtx->width;
+   uint16_t height = (pCtx->flags & GRAPH_CTX_SCREEN) ? pVideoMode->height : pCtx->height;
+   uint16_t x1, y1, x2, y2;
+
+   if(rnd(3) == 0)
+   {
+      ResetClipRectCtx(pCtx);
+      x1 = 0;
+      y1 = 0;
+      x2 = 0xFFFF;
+      y2 = 0xFFFF;
+   }
+   else
+   {
+      x1 = rnd(width + 10);
+      y1 = rnd(height + 10);
+      x2 = x1 + rnd(width + 10);
+      y2 = y1 + rnd(height + 10);
+      SetClipRectCtx(pCtx, x1, y1, x2, y2);
+   }
+   p_clip->x1 = x1;
+   p_clip->y1 = y1;
+   p_clip->x2 = (x2 < width) ? x2 : width - 1U;
+   p_clip->y2 = (y2 < height) ? y2 : height - 1U;
+}
+
+/**
+*  @fn         drawRandom
+*  @param[IN]  graphics context
+*  @param[IN]  effective clip rectangle
+*  @param[OUT] reference copy of target, updated for fills and bitmaps
+*  @param[IN]  kind of primitive
+*  @return     1 if the reference was updated
+*/
+static uint8_t drawRandom(tGraphCtx* pCtx, const tTestClip* p_clip, uint8_t* pRef, uint8_t kind)
+{
+   uint8_t action = (uint8_t)rnd(4);
+   uint16_t x = randomCoord();
+   uint16_t y = randomCoord();
+   uint16_t x2, y2, w, h, nb;
+   uint16_t xx, yy;
+   uint16_t r, c;
+   uint8_t pattern[8];
+   uint8_t on;
+   tPoint points[GRAPH_MAX_POLY_POINTS];
+   tImage image;
+   uint8_t n;
+
+   switch(kind)
+   {
+      case 0:
+         PutPixelCtx(pCtx, x, y, action);
+      break;
+
+      case 1:
+         PutLineCtx(pCtx, x, y, randomCoord(), randomCoord(), action);
+      break;
+
+      case 2:
+         PutVlineCtx(pCtx, x, y, rnd(300), action);
+      break;
+
+      case 3:
+         PutRectangleCtx(pCtx, x, y, x + rnd(100), y + rnd(100), action);
+      break;
+
+      case 4:
+         /* Fill with solid, user pattern or dither, checked per pixel */
+         x = rnd(340);
+         y = rnd(260);
+         x2 = x + rnd(100);
+         y2 = y + rnd(100);
+         if(rnd(2) != 0)
+         {
+            x = rnd(10);
+            x2 = 300 + rnd(40);
+         }
+         switch(rnd(3))
+         {
+            case 0:  SetFillPatternCtx(pCtx, 0);          break;
+            case 1:  for(r = 0; r < 8; r++)
+                        pattern[r] = (uint8_t)rand();
+                     SetFillPatternCtx(pCtx, pattern);    break;
+            default: SetFillDitherCtx(pCtx, rnd(GRAPH_DITHER_LEVELS)); break;
+         }
+         FillRectangleCtx(pCtx, x, y, x2, y2, action);
+         for(yy = y; yy <= y2; yy++)
+         {
+            for(xx = x; xx <= x2; xx++)
+            {
+               if(inClip(p_clip, xx, yy))
+               {
+                  on = (pCtx->pPattern == 0) || ((pCtx->pPattern[yy & 7U] & (0x80U >> (xx & 7U))) != 0);
+                  refPixel(pRef, pCtx->stride, xx, yy, on, action, 1);
+               }
+            }
+         }
+         SetFillPatternCtx(pCtx, 0);
+      return 1;
+
+      case 5:
+         PutCircleCtx(pCtx, x, y, rnd(120), action);
+      break;
+
+      case 6:
+         FillCircleCtx(pCtx, x, y, rnd(150), action);
+      break;
+
+      case 7:
+         FillEllipseCtx(pCtx, x, y, rnd(150), rnd(150), action);
+      break;
+
+      case 8:
+         FillArcCtx(pCtx, x, y, rnd(150), rnd(720), rnd(720), action);
+      break;
+
+      case 9:
+         n = 3 + rnd(GRAPH_MAX_POLY_POINTS - 2);
+         for(r = 0; r < n; r++)
+         {
+            points[r].x = rnd(2 * GRAPH_MAX_COORD) - GRAPH_MAX_COORD;
+            points[r].y = rnd(2 * GRAPH_MAX_COORD) - GRAPH_MAX_COORD;
+            if(rnd(4) != 0)
+            {
+               points[r].x = rnd(500) - 90;
+               points[r].y = rnd(400) - 80;
+            }
+         }
+         FillPolygonCtx(pCtx, points, n, action);
+      break;
+
+      case 10:
+         FillTriangleCtx(pCtx, rnd(600) - 140, rnd(500) - 130, rnd(600) - 140, rnd(500) - 130,
+                         rnd(600) - 140, rnd(500) - 130, action);
+      break;
+
+      default:
+         /* Bitmap, or a run of them as a glyph run, checked per pixel */
+         w = 1 + rnd(40);
+         h = 1 + rnd(20);
+         nb = (w + 7U) / 8U;
+         for(r = 0; r < (nb * h); r++)
+            Image[r] = (uint8_t)rand();
+         for(r = 0; r < h; r++)
+         {
+            if((w & 7U) != 0)
+               Image[(r * nb) + nb - 1U] &= (uint8_t)(0xFF << (8U - (w & 7U)));
+         }
+         image.bitmap = Image;
+         image.width = (uint8_t)w;
+         image.height = (uint8_t)h;
+         image.datasize = 0;
+         x = rnd(340);
+         y = rnd(260);
+         GotoXYCtx(pCtx, x, y);
+         if(kind == 11)
+            PutBitmapCtx(pCtx, &image, action);
+         else
+         {
+            const tImage* p_glyphs[1] = {&image};
+            PutGlyphRunCtx(pCtx, p_glyphs, 1, action);
+         }
+         for(r = 0; r < h; r++)
+         {
+            for(c = 0; c < w; c++)
+            {
+               if((((Image[(r * nb) + (c / 8U)] >> (7U - (c & 7U))) & 1U) != 0) && inClip(p_clip, x + c, y + r))
+                  refPixel(pRef, pCtx->stride, x + c, y + r, 1, action, 0);
+            }
+         }
+      return 1;
+   }
+   return 0;
+}
+
+/**
+*  @fn         checkClip
+*  @param[IN]  graphics context
+*  @param[IN]  effective clip rectangle
+*  @param[IN]  target before drawing
+*  @param[IN]  kind of primitive, for the report
+*  @param[IN]  iteration, for the report
+*  @brief      Checks every changed bit lies within the target and clip, so
+*              padding bits beyond the width and trailer bytes are unchanged.
+*              The screen context is only sized to the mode when drawn into,
+*              so it is checked against the mode itself
+*/
+static void checkClip(const tGraphCtx* pCtx, const tTestClip* p_clip, const uint8_t* pBefore,
+                      uint8_t kind, uint32_t iteration)
+{
+   uint8_t screen = (pCtx->flags & GRAPH_CTX_SCREEN) != 0;
+   const uint8_t* p_after = screen ? pDrawBuff : pCtx->pTarget;
+   uint16_t width = screen ? pVideoMode->width : pCtx->width;
+   uint16_t height = screen ? pVideoMode->height : pCtx->height;
+   uint16_t stride = screen ? pVideoMode->stride : pCtx->stride;
+   uint32_t i;
+   uint16_t x, y;
+   uint8_t changed;
+   uint8_t b;
+
+   for(i = 0; i < ((uint32_t)height * stride); i++)
+   {
+      changed = pBefore[i] ^ p_after[i];
+      if(changed == 0)
+         continue;
+      y = (uint16_t)(i / stride);
+      for(b = 0; b < 8; b++)
+      {
+         x = (uint16_t)(((i % stride) * 8U) + b);
+         CHECK(((changed & (0x80U >> b)) == 0) || ((x < width) && inClip(p_clip, x, y)),
+               "primitive %u kind %u wrote %u,%u outside %ux%u clip %u,%u %u,%u",
+               iteration, kind, x, y, width, height, p_clip->x1, p_clip->y1, p_clip->x2, p_clip->y2);
+      }
+   }
+}
+
+/**
+*  @fn         refPixel
+*  @param[OUT] reference buffer
+*  @param[IN]  bytes from one row to the next
+*  @param[IN]  x coordinate
+*  @param[IN]  y coordinate
+*  @param[IN]  1 if source pixel set
+*  @param[IN]  action
+*  @param[IN]  1 for a fill, where set also clears unset pattern pixels
+*/
+static void refPixel(uint8_t* pRef, uint16_t stride, uint16_t x, uint16_t y, uint8_t on, uint8_t action, uint8_t fill)
+{
+   uint8_t mask = 0x80U >> (x & 7U);
+   uint8_t* p_byte = &pRef[(y * stride) + (x >> 3)];
+
+   if(on == 0)
+   {
+      if((fill != 0) && (action == GRAPH_SET))
+         *p_byte &= ~mask;
+   }
+   else if(action == GRAPH_CLEAR)
+      *p_byte &= ~mask;
+   else if(action == GRAPH_XOR)
+      *p_byte ^= mask;
+   else
+      *p_byte |= mask;
+}
+
+/**
+*  @fn         inClip
+*  @return     1 if point lies within effective clip rectangle
+*/
+static uint8_t inClip(const tTestClip* p_clip, int32_t x, int32_t y)
+{
+   return (x >= p_clip->x1) && (x <= p_clip->x2) && (y >= p_clip->y1) && (y <= p_clip->y2);
+}
+
+/**
+*  @fn         rnd
+*  @return     random number from 0 to n-1
+*/
+static int rnd(int n)
+{
+   return rand() % n;
+}
+
+/**
+*  @fn     randomCoord
+*  @return coordinate, mostly on or near the screen, sometimes about to wrap
+*/
+static uint16_t randomCoord(void)
+{
+   return (rnd(10) == 0) ? (uint16_t)(0xFFFF - rnd(50)) : (uint16_t)rnd(420);
+}
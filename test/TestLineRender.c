@@ -0,0 +1,221 @@
+/**
+*  @file   TestLineRender.c
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Host test of line render mode, and a timing model of its deadlines
+*          The line render callback stamps each line with its row and field,
+*          and spends a set time in the emulated CPU, with the sync interrupts
+*          also taking time. Each line sent is checked against the renders
+*          finished by then: an on time line must hold its own row from this
+*          field, and a line is late if its render had not finished. The late
+*          lines counted so must match VideoGetLateLines(). Renders must stay
+*          ahead of the beam and not overwrite a ring slot still to be sent.
+*          The render time is swept to find where lines start to be late,
+*          which must lie within the bounds of a row's time on screen
+*/
+
+/***** Include files  *********************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stm32f10x.h"
+#include "Video.h"
+#include "HostPeriph.h"
+#include "TestUtil.h"
+
+/***** Constants  *************************************************/
+#define NUM_FIELDS            4U       /* even, so each run ends on an even field */
+#define ISR_TICKS             16U      /* time of each video interrupt, 2us */
+#define ISRS_PER_LINE         3U       /* CC1, CC2 and line DMA complete */
+#define COST_STEP             4U       /* render time sweep, ticks */
+
+/***** Types      *************************************************/
+
+/***** Storage    *************************************************/
+static const tVideoModeId Modes[] = {
+      VIDEO_MODE_320x240, VIDEO_MODE_320x120, VIDEO_MODE_256x192, VIDEO_MODE_320x480I
+      };
+
+static uint32_t renderTicks;           /* time spent by each render            */
+static uint8_t  numFields;             /* fields started since the run began   */
+static uint8_t  lastBroad;
+static uint8_t  fieldParity;
+static uint8_t  Rendered[VIDEO_MAX_ROWS];  /* ring line of the field rendered, by index */
+static int16_t  lastSent;              /* ring line index last sent, -1 none   */
+static uint16_t linesSent;             /* lines sent in the field, repeats too */
+static uint32_t modelLate;
+
+/***** Local prototypes    ****************************************/
+static uint32_t runFields(tVideoStandard standard, tVideoModeId mode, uint32_t cost);
+static void onPeriod(uint16_t arr, uint16_t ccr1);
+static void onLine(const uint8_t* pLine, uint16_t bytes);
+static void renderLine(uint16_t row, uint8_t* pLine);
+
+/***** Exported functions  ****************************************/
+int main(void)
+{
+   uint8_t s;
+   uint8_t m;
+   uint32_t cost;
+   uint32_t late;
+   uint32_t row_ticks;
+   uint32_t budget;
+   uint32_t slack;
+   uint16_t rows;
+
+   for(s = 0; s < VIDEO_NUM_STANDARDS; s++)
+   {
+      for(m = 0; m < sizeof(Modes) / sizeof(Modes[0]); m++)
+      {
+         /* Render time at which lines go late, from a cost no line can miss */
+         cost = 0;
+         do
+         {
+            cost += COST_STEP;
+            late = runFields((tVideoStandard)s, Modes[m], cost);
+         } while(late == 0);
+
+         /* Each row has its line repeats on screen, less the interrupts in them.
+            The ring, filled ahead of the picture, covers a little over that */
+         rows = pVideoMode->height >> pVideoMode->interlace;
+         row_ticks = pVideoTiming->line_period * pVideoMode->line_repeat;
+         budget = row_ticks - (ISRS_PER_LINE * ISR_TICKS * pVideoMode->line_repeat);
+         slack = ((VIDEO_LINE_RING + 1U) * pVideoTiming->line_period) / rows;
+         CHECK((cost > (budget - COST_STEP)) && (cost <= (budget + slack + COST_STEP)),
+               "%s %ux%u late from %u ticks a line, budget %u", (s == VIDEO_STANDARD_PAL) ? "PAL" : "NTSC",
+               pVideoMode->width, pVideoMode->height, cost, budget);
+
+         /* Well over the budget, most lines are late */
+         late = runFields((tVideoStandard)s, Modes[m], 2U * row_ticks);
+         CHECK(late >= ((NUM_FIELDS * rows * pVideoMode->line_repeat) / 2U), "only %u lines late", late);
+
+         printf("TestLineRender: %-4s %ux%u late from %u ticks, %u tick rows\n",
+                (s == VIDEO_STANDARD_PAL) ? "PAL" : "NTSC", pVideoMode->width,
+                pVideoMode->height, cost, row_ticks);
+      }
+   }
+   printf("TestLineRender: ok\n");
+   return 0;
+}
+
+/***** Local    functions  ****************************************/
+
+/**
+*  @fn         runFields
+*  @param[IN]  TV standard
+*  @param[IN]  video mode
+*  @param[IN]  time each render takes, ticks
+*  @return     late lines, which the model and the video driver agree on
+*  @brief      Runs the video generator in line render mode until NUM_FIELDS
+*              whole fields have been sent, stopping the timer as the next begins
+*/
+static uint32_t runFields(tVideoStandard standard, tVideoModeId mode, uint32_t cost)
+{
+   uint16_t driver_late;
+
+   TIM_Cmd(TIM1, DISABLE);
+   HostReset();
+   HostIsrTicks = ISR_TICKS;
+   pHostPeriodHook = onPeriod;
+   pHostLineHook = onLine;
+   setLineRenderCallback(renderLine);
+   renderTicks = cost;
+   numFields = 0;
+   lastBroad = 0;
+   modelLate = 0;
+
+   CHECK(VideoSetMode(mode) == 0, "video mode %d not supported", mode);
+   VideoInit(VIDEO_RENDER_LINE, standard);
+   driver_late = VideoGetLateLines();
+   while(numFields <= NUM_FIELDS)
+      HostRunPeriods(1);
+   TIM_Cmd(TIM1, DISABLE);
+
+   driver_late = VideoGetLateLines() - driver_late;
+   CHECK(driver_late == modelLate, "%ux%u render of %u ticks, %u late lines, model has %u",
+         pVideoMode->width, pVideoMode->height, cost, driver_late, modelLate);
+   return modelLate;
+}
+
+/**
+*  @fn         onPeriod
+*  @param[IN]  auto reload
+*  @param[IN]  sync pulse width, ticks
+*  @brief      A broad sync pulse after any other starts a field. Checks the
+*              last field sent every row, then clears the model for the next
+*/
+static void onPeriod(uint16_t arr, uint16_t ccr1)
+{
+   uint8_t broad = (ccr1 == pVideoTiming->long_sync);
+
+   (void)arr;
+   if((broad != 0) && (lastBroad == 0))
+   {
+      if(numFields != 0)
+      {
+         CHECK(linesSent == ((pVideoMode->height >> pVideoMode->interlace) * pVideoMode->line_repeat),
+               "field %u sent %u lines", numFields - 1U, linesSent);
+      }
+      numFields++;
+      memset(Rendered, 0, sizeof(Rendered));
+      lastSent = -1;
+      linesSent = 0;
+   }
+   lastBroad = broad;
+}
+
+/**
+*  @fn         onLine
+*  @param[IN]  line data sent
+*  @param[IN]  bytes sent, the line and its trailer
+*  @brief      Model of the deadline. The line is late unless its render had
+*              finished, else it must carry the stamp of its row and field
+*/
+static void onLine(const uint8_t* pLine, uint16_t bytes)
+{
+   int16_t index = (int16_t)(linesSent / pVideoMode->line_repeat);
+   uint16_t row = (uint16_t)((index << pVideoMode->interlace) + fieldParity);
+
+   CHECK(bytes == (pVideoMode->line_bytes + 1U), "line of %u bytes", bytes);
+   CHECK(pLine[pVideoMode->line_bytes] == 0, "line %d trailer not zero", index);
+   if(Rendered[index] == 0)
+      modelLate++;
+   else
+   {
+      CHECK((((pLine[0] << 8) | pLine[1]) == row) && (pLine[2] == numFields) &&
+            (pLine[3] == (uint8_t)(row ^ numFields)),
+            "line %d sent row %u of field %u, not row %u of field %u", index,
+            (pLine[0] << 8) | pLine[1], pLine[2], row, numFields);
+   }
+   lastSent = index;
+   linesSent++;
+}
+
+/**
+*  @fn         renderLine
+*  @param[IN]  buffer row
+*  @param[OUT] line buffer to fill
+*  @brief      Line render callback, stamps the line and takes renderTicks.
+*              The ring slot last held the line VIDEO_LINE_RING before, which
+*              the beam must have finished with
+*/
+static void renderLine(uint16_t row, uint8_t* pLine)
+{
+   int16_t index = (int16_t)(row >> pVideoMode->interlace);
+
+   if(index == 0)
+      fieldParity = row & pVideoMode->interlace;
+   CHECK((row & pVideoMode->interlace) == fieldParity, "row %u rendered in field of parity %u",
+         row, fieldParity);
+   CHECK(index > lastSent, "row %u rendered after the beam passed it", row);
+   CHECK((index < (int16_t)VIDEO_LINE_RING) || (lastSent > (index - (int16_t)VIDEO_LINE_RING)),
+         "row %u overwrites a ring line still to be sent", row);
+
+   memset(pLine, 0xAA, pVideoMode->line_bytes);
+   pLine[0] = (uint8_t)(row >> 8);
+   pLine[1] = (uint8_t)row;
+   pLine[2] = numFields;
+   pLine[3] = (uint8_t)(row ^ numFields);
+   HostSpend(renderTicks);
+   Rendered[index] = 1;
+}
@@ -0,0 +1,312 @@
+/**
+*  @file   TestPolygon.c
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Host test of FillPolygon and FillTriangle
+*          Fixed cases are compared with golden images in TEST_GOLDEN_DIR,
+*          run with -w to rewrite them after an intended change. Random
+*          polygons are compared with an even-odd test of each pixel centre
+*          in floating point, and pairs of triangles drawn with XOR with the
+*          quadrilateral they make up
+*/
+
+/***** Include files  *********************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "stm32f10x.h"
+#include "Graphics.h"
+#include "TestUtil.h"
+
+/***** Constants  *************************************************/
+#define NUM_RANDOM_POLYGONS   200U
+#define NUM_RANDOM_QUADS      500U
+#define EDGE_TOLERANCE        0.01     /* pixel centres this close to an edge may go either way */
+#define MESH_COLS             6
+#define MESH_ROWS             4
+
+/***** Types      *************************************************/
+typedef struct
+{
+   const char* name;
+   tVideoModeId mode;
+   void (*pDraw)(void);
+} tGoldenCase;
+
+/***** Storage    *************************************************/
+static const tPoint Star[] = {{160, 10}, {134, 84}, {55, 86}, {117, 134}, {95, 209},
+                              {160, 165}, {225, 209}, {203, 134}, {265, 86}, {186, 84}};
+static const tPoint Pentagram[] = {{160, 10}, {95, 209}, {265, 86}, {55, 86}, {225, 209}};
+static const tPoint Hexagon[] = {{290, 45}, {160, -30}, {30, 45}, {30, 195}, {160, 270}, {290, 195}};
+static const tPoint OffScreen[] = {{-8000, 200}, {150, -7000}, {8191, 100}, {200, 8000}};
+
+static uint8_t Reference[VIDEO_BUFF_SIZE];
+
+/***** Local prototypes    ****************************************/
+static void drawTriangle(void);
+static void drawStar(void);
+static void drawPentagram(void);
+static void drawOffScreen(void);
+static void drawClipped(void);
+static void drawDither(void);
+static void drawSlivers(void);
+static void drawMesh(void);
+static void drawSmallMode(void);
+static void checkMesh(void);
+static void checkRandomPolygons(void);
+static void checkRandomQuads(void);
+static int randomCoord(int range, int margin);
+
+static const tGoldenCase GoldenCases[] = {
+      {"poly_triangle",   VIDEO_MODE_320x240, drawTriangle},
+      {"poly_star",       VIDEO_MODE_320x240, drawStar},
+      {"poly_pentagram",  VIDEO_MODE_320x240, drawPentagram},
+      {"poly_offscreen",  VIDEO_MODE_320x240, drawOffScreen},
+      {"poly_clipped",    VIDEO_MODE_320x240, drawClipped},
+      {"poly_dither",     VIDEO_MODE_320x240, drawDither},
+      {"poly_slivers",    VIDEO_MODE_320x240, drawSlivers},
+      {"poly_mesh",       VIDEO_MODE_320x240, drawMesh},
+      {"poly_256x192",    VIDEO_MODE_256x192, drawSmallMode}
+      };
+
+/***** Exported functions  ****************************************/
+int main(int argc, char** argv)
+{
+   uint8_t update = (argc > 1) && (strcmp(argv[1], "-w") == 0);
+   uint16_t i;
+
+   GraphicsInit();
+   for(i = 0; i < sizeof(GoldenCases) / sizeof(GoldenCases[0]); i++)
+   {
+      TestScreenInit(GoldenCases[i].mode);
+      GoldenCases[i].pDraw();
+      TestCheckTrailers();
+      TestGolden(GoldenCases[i].name, update);
+   }
+   if(update != 0)
+   {
+      printf("TestPolygon: %u golden images written\n", i);
+      return 0;
+   }
+
+   checkMesh();
+   checkRandomPolygons();
+   checkRandomQuads();
+   printf("TestPolygon: ok\n");
+   return 0;
+}
+
+/***** Local    functions  ****************************************/
+
+static void drawTriangle(void)
+{
+   FillTriangle(40, 20, 290, 70, 110, 225, GRAPH_SET);
+}
+
+/* Concave, ten vertices */
+static void drawStar(void)
+{
+   FillPolygon(Star, sizeof(Star) / sizeof(Star[0]), GRAPH_SET);
+}
+
+/* Self intersecting, the even-odd rule leaves the centre empty */
+static void drawPentagram(void)
+{
+   FillPolygon(Pentagram, sizeof(Pentagram) / sizeof(Pentagram[0]), GRAPH_SET);
+}
+
+/* Vertices up to GRAPH_MAX_COORD off screen */
+static void drawOffScreen(void)
+{
+   FillPolygon(OffScreen, sizeof(OffScreen) / sizeof(OffScreen[0]), GRAPH_SET);
+}
+
+/* Crosses the clip rectangle, XOR over a filled rectangle */
+static void drawClipped(void)
+{
+   FillRectangle(100, 60, 219, 179, GRAPH_SET);
+   SetClipRect(60, 40, 259, 199);
+   FillPolygon(Hexagon, sizeof(Hexagon) / sizeof(Hexagon[0]), GRAPH_XOR);
+   ResetClipRect();
+}
+
+static void drawDither(void)
+{
+   SetFillDither(24);
+   FillPolygon(Star, sizeof(Star) / sizeof(Star[0]), GRAPH_SET);
+   SetFillPattern(0);
+}
+
+/* Thin triangles, and a collinear one which draws nothing */
+static void drawSlivers(void)
+{
+   FillTriangle(10, 20, 310, 23, 10, 21, GRAPH_SET);
+   FillTriangle(20, 40, 23, 230, 21, 40, GRAPH_SET);
+   FillTriangle(40, 40, 300, 220, 41, 41, GRAPH_SET);
+   FillTriangle(50, 100, 150, 150, 250, 200, GRAPH_SET);
+}
+
+/**
+*  @fn     drawMesh
+*  @brief  Grid of quads split into triangles, inner vertices moved off the
+*          grid. Drawn with XOR, so a shared edge drawn twice or missed
+*          shows as a seam
+*/
+static void drawMesh(void)
+{
+   int16_t x[MESH_ROWS + 1][MESH_COLS + 1];
+   int16_t y[MESH_ROWS + 1][MESH_COLS + 1];
+   uint8_t r, c;
+
+   for(r = 0; r <= MESH_ROWS; r++)
+   {
+      for(c = 0; c <= MESH_COLS; c++)
+      {
+         x[r][c] = 20 + (c * 46);
+         y[r][c] = 20 + (r * 50);
+         if((r != 0) && (r != MESH_ROWS) && (c != 0) && (c != MESH_COLS))
+         {
+            x[r][c] += ((r * 7) + (c * 13)) % 31 - 15;
+            y[r][c] += ((r * 11) + (c * 5)) % 29 - 14;
+         }
+      }
+   }
+   for(r = 0; r < MESH_ROWS; r++)
+   {
+      for(c = 0; c < MESH_COLS; c++)
+      {
+         FillTriangle(x[r][c], y[r][c], x[r][c+1], y[r][c+1], x[r+1][c+1], y[r+1][c+1], GRAPH_XOR);
+         FillTriangle(x[r][c], y[r][c], x[r+1][c+1], y[r+1][c+1], x[r+1][c], y[r+1][c], GRAPH_XOR);
+      }
+   }
+}
+
+/* Clipped to the mode, not the frame buffer */
+static void drawSmallMode(void)
+{
+   FillTriangle(-40, 10, 400, 90, 120, 300, GRAPH_SET);
+}
+
+/**
+*  @fn     checkMesh
+*  @brief  The XOR mesh must fill its outline exactly, pixel centres inside
+*          the outer edges of 20..296 by 20..220
+*/
+static void checkMesh(void)
+{
+   TestScreenInit(VIDEO_MODE_320x240);
+   drawMesh();
+   memcpy(Reference, pDrawBuff, VIDEO_BUFF_SIZE);
+   ClearScreen();
+   FillRectangle(20, 20, 20 + (MESH_COLS * 46) - 1, 20 + (MESH_ROWS * 50) - 1, GRAPH_SET);
+   CHECK(memcmp(Reference, pDrawBuff, VIDEO_BUFF_SIZE) == 0, "triangle mesh has seams or overlaps");
+}
+
+/**
+*  @fn     checkRandomPolygons
+*  @brief  Random polygons, partly off screen, against an even-odd test of
+*          each pixel centre. Centres within EDGE_TOLERANCE of an edge are
+*          not checked, as the fixed point edge may round either way
+*/
+static void checkRandomPolygons(void)
+{
+   tPoint points[GRAPH_MAX_POLY_POINTS];
+   uint16_t t;
+   uint8_t n;
+   uint8_t i;
+   uint16_t x, y;
+   double xc, yc, xi, nearest;
+   uint8_t inside;
+   uint32_t checked = 0;
+
+   srand(9);
+   TestScreenInit(VIDEO_MODE_320x240);
+   for(t = 0; t < NUM_RANDOM_POLYGONS; t++)
+   {
+      n = 3 + (rand() % (GRAPH_MAX_POLY_POINTS - 2));
+      for(i = 0; i < n; i++)
+      {
+         points[i].x = randomCoord(500, 90);
+         points[i].y = randomCoord(400, 80);
+      }
+      ClearScreen();
+      FillPolygon(points, n, GRAPH_XOR);
+      TestCheckTrailers();
+
+      for(y = 0; y < pVideoMode->height; y++)
+      {
+         for(x = 0; x < pVideoMode->width; x++)
+         {
+            xc = x + 0.5;
+            yc = y + 0.5;
+            inside = 0;
+            nearest = 1e9;
+            for(i = 0; i < n; i++)
+            {
+               const tPoint* p0 = &points[i];
+               const tPoint* p1 = &points[(i + 1) % n];
+               if((p0->y <= yc) != (p1->y <= yc))
+               {
+                  xi = p0->x + (((yc - p0->y) * (p1->x - p0->x)) / (double)(p1->y - p0->y));
+                  if(xi < xc)
+                     inside ^= 1;
+                  if(fabs(xi - xc) < nearest)
+                     nearest = fabs(xi - xc);
+               }
+            }
+            if(nearest >= EDGE_TOLERANCE)
+            {
+               CHECK(TestGetPixel(pDrawBuff, pVideoMode->stride, x, y) == inside,
+                     "polygon %u of %u points differs at %u,%u", t, n, x, y);
+               checked++;
+            }
+         }
+      }
+   }
+   CHECK(checked > 0, "no pixels checked");
+}
+
+/**
+*  @fn     checkRandomQuads
+*  @brief  Any quadrilateral, split along a diagonal into two triangles drawn
+*          with XOR, matches the quadrilateral drawn as one polygon, as the
+*          diagonal's crossings cancel
+*/
+static void checkRandomQuads(void)
+{
+   tPoint q[4];
+   uint16_t t;
+   uint8_t i;
+
+   srand(11);
+   TestScreenInit(VIDEO_MODE_320x240);
+   for(t = 0; t < NUM_RANDOM_QUADS; t++)
+   {
+      for(i = 0; i < 4; i++)
+      {
+         q[i].x = randomCoord(400, 40);
+         q[i].y = randomCoord(300, 30);
+      }
+      ClearScreen();
+      FillTriangle(q[0].x, q[0].y, q[1].x, q[1].y, q[2].x, q[2].y, GRAPH_XOR);
+      FillTriangle(q[0].x, q[0].y, q[2].x, q[2].y, q[3].x, q[3].y, GRAPH_XOR);
+      memcpy(Reference, pDrawBuff, VIDEO_BUFF_SIZE);
+      ClearScreen();
+      FillPolygon(q, 4, GRAPH_SET);
+      CHECK(memcmp(Reference, pDrawBuff, VIDEO_BUFF_SIZE) == 0,
+            "quad %u: triangles %d,%d %d,%d %d,%d %d,%d do not match polygon",
+            t, q[0].x, q[0].y, q[1].x, q[1].y, q[2].x, q[2].y, q[3].x, q[3].y);
+   }
+}
+
+/**
+*  @fn         randomCoord
+*  @param[IN]  range of values
+*  @param[IN]  amount of range below 0
+*  @return     coordinate from -margin to range-margin-1
+*/
+static int randomCoord(int range, int margin)
+{
+   return (rand() % range) - margin;
+}
@@ -0,0 +1,249 @@
+/**
+*  @file   TestSwap.c
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Host test of the double buffer swap, built with VIDEO_DOUBLE_BUFFER
+*          Swaps are requested at chosen and random points of each field, and
+*          every line sent is checked against a model: a swap requested before
+*          the sync interrupt starts a field's lines applies to that field,
+*          later ones to the next, and any number of requests before the latch
+*          make one swap. Each field must come wholly from one buffer, never
+*          the draw buffer, and IsSwapPending() must clear at the latch with
+*          pDrawBuff then the buffer that was on screen
+*/
+
+/***** Include files  *********************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stm32f10x.h"
+#include "Video.h"
+#include "HostPeriph.h"
+#include "TestUtil.h"
+
+/***** Constants  *************************************************/
+#define NUM_RANDOM_FIELDS     40U
+#define REQUEST_CHANCE        200      /* one request in this many timer periods */
+
+/***** Types      *************************************************/
+typedef enum {PULSE_BROAD, PULSE_PRE, PULSE_LINE, PULSE_POST} tPulse;
+
+/***** Storage    *************************************************/
+static const uint8_t* Buffers[2];      /* FrameBuff and the back buffer, as first drawn into */
+static uint8_t  scanIndex;             /* buffer the model expects on screen */
+static uint8_t  requests;              /* swap requests since the last latch */
+static uint8_t  lateRequests;          /* requests after the latch, before the lines start */
+static tPulse   lastPulse;
+static uint16_t pulseCount;            /* periods of this kind in a row      */
+static uint16_t fieldLines;            /* lines sent in the current field    */
+static uint32_t numSwaps;
+
+/***** Local prototypes    ****************************************/
+static void runStandard(tVideoStandard standard);
+static void requestSwap(void);
+static void runToPulse(tPulse pulse, uint16_t count);
+static void runFields(uint16_t fields);
+static void onPeriod(uint16_t arr, uint16_t ccr1);
+static void onLine(const uint8_t* pLine, uint16_t bytes);
+static uint8_t bufferOf(const uint8_t* p);
+
+/***** Exported functions  ****************************************/
+int main(void)
+{
+   srand(3);
+   runStandard(VIDEO_STANDARD_PAL);
+   runStandard(VIDEO_STANDARD_NTSC);
+   printf("TestSwap: ok, %u swaps\n", numSwaps);
+   return 0;
+}
+
+/***** Local    functions  ****************************************/
+
+/**
+*  @fn         runStandard
+*  @param[IN]  TV standard
+*  @brief      Runs the directed cases then random requests. Each run ends as
+*              a field starts, so the next begins with the sync interrupt at
+*              the start of a field
+*/
+static void runStandard(tVideoStandard standard)
+{
+   uint16_t f;
+   uint32_t swaps;
+
+   TIM_Cmd(TIM1, DISABLE);
+   HostReset();
+   pHostPeriodHook = onPeriod;
+   pHostLineHook = onLine;
+   CHECK(VideoSetMode(VIDEO_MODE_320x240) == 0, "video mode not supported");
+   VideoInit(VIDEO_RENDER_FRAME, standard);
+   CHECK(IsSwapPending() == 0, "swap pending at start");
+   if(Buffers[0] == 0)
+   {
+      /* Screen starts as FrameBuff, drawing into the other buffer */
+      Buffers[0] = FrameBuff;
+      Buffers[1] = pDrawBuff;
+      CHECK(Buffers[1] != FrameBuff, "draw buffer is on screen");
+   }
+   scanIndex = bufferOf(pDrawBuff) ^ 1U;
+   requests = 0;
+   lateRequests = 0;
+   lastPulse = PULSE_POST;
+   pulseCount = 0;
+   fieldLines = 0;
+
+   /* No request, no swap */
+   runFields(2);
+
+   /* Request in the picture applies to the next field */
+   runToPulse(PULSE_LINE, 100);
+   requestSwap();
+   runFields(2);
+
+   /* Two requests in the broad sync pulses make one swap in that field */
+   runToPulse(PULSE_BROAD, 2);
+   requestSwap();
+   runToPulse(PULSE_PRE, 1);
+   requestSwap();
+   swaps = numSwaps;
+   runFields(2);
+   CHECK(numSwaps == (swaps + 1U), "double request made %u swaps", numSwaps - swaps);
+
+   /* Request at the start of the last equalising pulse is latched by its sync
+      interrupt, one just after that interrupt waits for the next field */
+   runToPulse(PULSE_PRE, pVideoTiming->num_pre_frame_sync);
+   requestSwap();
+   runToPulse(PULSE_LINE, 1);
+   CHECK(requests == 0, "swap at last equalising pulse not latched");
+   runToPulse(PULSE_PRE, pVideoTiming->num_pre_frame_sync);
+   HostRun(pVideoTiming->line_period / 4U);
+   VideoSwapBuffers();
+   lateRequests = 1;
+   runToPulse(PULSE_LINE, 1);
+   CHECK(IsSwapPending() != 0, "swap requested after the latch was taken by this field");
+   runFields(2);
+
+   /* Random requests at the start of timer periods */
+   for(f = 0; f < NUM_RANDOM_FIELDS; f++)
+   {
+      do
+      {
+         HostRunPeriods(1);
+         if((rand() % REQUEST_CHANCE) == 0)
+            requestSwap();
+      } while((lastPulse != PULSE_BROAD) || (pulseCount != 1U));
+   }
+   runFields(2);
+   TIM_Cmd(TIM1, DISABLE);
+}
+
+/**
+*  @fn     requestSwap
+*  @brief  Requests a swap from the main loop
+*/
+static void requestSwap(void)
+{
+   VideoSwapBuffers();
+   CHECK(IsSwapPending() != 0, "swap request not pending");
+   requests++;
+}
+
+/**
+*  @fn         runToPulse
+*  @param[IN]  kind of timer period
+*  @param[IN]  period of that kind in the field, from 1
+*  @brief      Runs until that timer period has just started
+*/
+static void runToPulse(tPulse pulse, uint16_t count)
+{
+   do
+   {
+      HostRunPeriods(1);
+   } while((lastPulse != pulse) || (pulseCount != count));
+}
+
+/**
+*  @fn         runFields
+*  @param[IN]  number of fields
+*  @brief      Runs to the start of a later field
+*/
+static void runFields(uint16_t fields)
+{
+   while(fields-- > 0)
+      runToPulse(PULSE_BROAD, 1);
+}
+
+/**
+*  @fn         onPeriod
+*  @param[IN]  auto reload
+*  @param[IN]  sync pulse width, ticks
+*  @brief      Follows the sync pulses. The sync interrupt of the last
+*              equalising pulse latches any swap, so it has been taken by the
+*              time the first line period starts
+*/
+static void onPeriod(uint16_t arr, uint16_t ccr1)
+{
+   tPulse pulse;
+
+   if(arr == pVideoTiming->line_period)
+      pulse = PULSE_LINE;
+   else if(ccr1 == pVideoTiming->long_sync)
+      pulse = PULSE_BROAD;
+   else
+      pulse = ((lastPulse == PULSE_LINE) || (lastPulse == PULSE_POST)) ? PULSE_POST : PULSE_PRE;
+
+   pulseCount = (pulse == lastPulse) ? (pulseCount + 1U) : 1U;
+   if((pulse == PULSE_LINE) && (lastPulse != PULSE_LINE))
+   {
+      if(requests != 0)
+      {
+         scanIndex ^= 1U;
+         numSwaps++;
+      }
+      requests = lateRequests;
+      lateRequests = 0;
+      fieldLines = 0;
+      CHECK(IsSwapPending() == (requests != 0), "swap still pending as the field's lines start");
+      CHECK(pDrawBuff == Buffers[scanIndex ^ 1U], "draw buffer is not the one taken off screen");
+   }
+   else
+   {
+      CHECK(IsSwapPending() == (requests != 0), "swap pending %u with %u requests",
+            IsSwapPending(), requests);
+   }
+   lastPulse = pulse;
+}
+
+/**
+*  @fn         onLine
+*  @param[IN]  line data sent
+*  @param[IN]  bytes sent
+*  @brief      Checks each line comes from the buffer on screen
+*/
+static void onLine(const uint8_t* pLine, uint16_t bytes)
+{
+   (void)bytes;
+   CHECK(lastPulse == PULSE_LINE, "line sent in blanking");
+   CHECK(bufferOf(pLine) == scanIndex, "line %u of field sent from buffer %u, not %u",
+         fieldLines, bufferOf(pLine), scanIndex);
+   CHECK((pLine < pDrawBuff) || (pLine >= (pDrawBuff + VIDEO_BUFF_SIZE)), "line sent from draw buffer");
+   fieldLines++;
+}
+
+/**
+*  @fn         bufferOf
+*  @param[IN]  address in a frame buffer
+*  @return     index of buffer in Buffers
+*/
+static uint8_t bufferOf(const uint8_t* p)
+{
+   uint8_t i;
+
+   for(i = 0; i < 2U; i++)
+   {
+      if((p >= Buffers[i]) && (p < (Buffers[i] + VIDEO_BUFF_SIZE)))
+         return i;
+   }
+   TestFail(__FILE__, __LINE__, "line not from a frame buffer");
+   return 0;
+}
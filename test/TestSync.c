@@ -0,0 +1,313 @@
+/**
+*  @file   TestSync.c
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Host test of the sync pulse trains made by TIM1_CC_IRQHandler
+*          Each video standard and mode is run for a number of fields through
+*          the emulated timer, recording every timer period as a broad sync,
+*          equalising or line pulse, and every line sent. Checks the pulse
+*          counts and widths of each field against the standard, that the
+*          line grid carries on unbroken across fields while interlaced
+*          fields start half a line apart, that field parity alternates in
+*          the vertical blanking callback, and that each field scans out the
+*          rows of its parity in order
+*/
+
+/***** Include files  *********************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stm32f10x.h"
+#include "Video.h"
+#include "HostPeriph.h"
+#include "TestUtil.h"
+
+/***** Constants  *************************************************/
+#define NUM_FIELDS            4U       /* even, so each run ends on an even field */
+#define MAX_FIELDS            (NUM_FIELDS + 1U)
+#define TIMER_TICK_NS         125U     /* TIM1 at 8MHz */
+#define H_SYNC_TICKS          ((4700U + (TIMER_TICK_NS / 2U)) / TIMER_TICK_NS)
+#define SHORT_SYNC_TICKS      ((2350U + (TIMER_TICK_NS / 2U)) / TIMER_TICK_NS)
+
+/***** Types      *************************************************/
+typedef enum {PULSE_BROAD, PULSE_PRE, PULSE_LINE, PULSE_POST} tPulse;
+
+/* Field timing of each standard, as published, not taken from Video.c */
+typedef struct
+{
+   const char* name;
+   uint16_t line_ns;
+   uint8_t  broad;
+   uint8_t  pre;
+   uint8_t  post;
+   uint16_t first_active;
+   uint16_t last_active;
+   uint16_t frame_lines;      /* interlaced, a progressive field is half a line shorter */
+} tStandardSpec;
+
+typedef struct
+{
+   uint32_t start;            /* half lines since the run started */
+   uint32_t first_line;       /* half line of the first line pulse */
+   uint16_t pulses[4];        /* periods of each tPulse */
+   uint16_t picture_start;    /* line pulse of the first picture line, counted from 1 */
+   uint16_t picture_lines;
+   uint16_t first_row;
+   int8_t   vblank_end;       /* field parity passed to the callback, -1 if not called */
+   int8_t   vblank_start;
+} tFieldRecord;
+
+/***** Storage    *************************************************/
+static const tStandardSpec Specs[VIDEO_NUM_STANDARDS] = {
+      {"PAL",  64000U, 5U, 5U, 6U, 6U,  309U, 625U},
+      {"NTSC", 63556U, 6U, 6U, 6U, 10U, 262U, 525U}
+      };
+
+static const tVideoModeId Modes[] = {
+      VIDEO_MODE_320x240, VIDEO_MODE_320x120, VIDEO_MODE_320x480I, VIDEO_MODE_256x384I
+      };
+
+static tFieldRecord Fields[MAX_FIELDS];
+static uint8_t  numFields;
+static tPulse   lastPulse;
+static uint32_t halfLines;
+
+/***** Local prototypes    ****************************************/
+static void runFields(tVideoStandard standard, tVideoModeId mode);
+static void checkFields(tVideoStandard standard);
+static void onPeriod(uint16_t arr, uint16_t ccr1);
+static void onLine(const uint8_t* pLine, uint16_t bytes);
+static void onVblank(uint8_t start, uint8_t field);
+
+/***** Exported functions  ****************************************/
+int main(void)
+{
+   uint8_t s;
+   uint8_t m;
+
+   for(s = 0; s < VIDEO_NUM_STANDARDS; s++)
+   {
+      for(m = 0; m < sizeof(Modes) / sizeof(Modes[0]); m++)
+      {
+         runFields((tVideoStandard)s, Modes[m]);
+         checkFields((tVideoStandard)s);
+      }
+   }
+   printf("TestSync: ok\n");
+   return 0;
+}
+
+/***** Local    functions  ****************************************/
+
+/**
+*  @fn         runFields
+*  @param[IN]  TV standard
+*  @param[IN]  video mode
+*  @brief      Starts the video generator and runs it until NUM_FIELDS whole
+*              fields have been sent, stopping the timer as the next begins
+*/
+static void runFields(tVideoStandard standard, tVideoModeId mode)
+{
+   TIM_Cmd(TIM1, DISABLE);
+   HostReset();
+   memset(Fields, 0, sizeof(Fields));
+   numFields = 0;
+   lastPulse = PULSE_POST;
+   halfLines = 0;
+   pHostPeriodHook = onPeriod;
+   pHostLineHook = onLine;
+   setVerticalBlankingCallback(onVblank);
+
+   CHECK(VideoSetMode(mode) == 0, "video mode %d not supported", mode);
+   VideoInit(VIDEO_RENDER_FRAME, standard);
+   while(numFields <= NUM_FIELDS)
+      HostRunPeriods(1);
+   TIM_Cmd(TIM1, DISABLE);
+}
+
+/**
+*  @fn         checkFields
+*  @param[IN]  TV standard
+*  @brief      Checks the whole fields recorded against the standard and mode
+*/
+static void checkFields(tVideoStandard standard)
+{
+   const tStandardSpec* p_spec = &Specs[standard];
+   uint8_t il = pVideoMode->interlace;
+   uint16_t lines = p_spec->last_active - p_spec->first_active + 1U;
+   uint16_t field_half_lines;
+   uint8_t parity;
+   uint8_t f;
+   const tFieldRecord* p_field;
+
+   CHECK(pVideoTiming->line_period == ((p_spec->line_ns + (TIMER_TICK_NS / 2U)) / TIMER_TICK_NS),
+         "%s line period %u ticks", p_spec->name, pVideoTiming->line_period);
+
+   for(f = 0; f < NUM_FIELDS; f++)
+   {
+      p_field = &Fields[f];
+      parity = il & f;
+
+      /* Interlaced odd field has an extra equalising pulse before its lines,
+         even field after them */
+      CHECK((p_field->pulses[PULSE_BROAD] == p_spec->broad) &&
+            (p_field->pulses[PULSE_PRE] == (p_spec->pre + parity)) &&
+            (p_field->pulses[PULSE_LINE] == lines) &&
+            (p_field->pulses[PULSE_POST] == (p_spec->post + (il & (parity ^ 1U)))),
+            "%s %ux%u field %u: %u broad, %u pre, %u line, %u post pulses",
+            p_spec->name, pVideoMode->width, pVideoMode->height, f, p_field->pulses[PULSE_BROAD],
+            p_field->pulses[PULSE_PRE], p_field->pulses[PULSE_LINE], p_field->pulses[PULSE_POST]);
+
+      /* Field is half the frame, so interlaced fields start half a line apart */
+      field_half_lines = Fields[f + 1U].start - p_field->start;
+      CHECK(field_half_lines == (p_spec->frame_lines - (il ^ 1U)),
+            "%s %ux%u field %u is %u half lines", p_spec->name, pVideoMode->width,
+            pVideoMode->height, f, field_half_lines);
+      CHECK((p_field->start & 1U) == parity, "%s field %u starts at half line %u",
+            p_spec->name, f, p_field->start);
+      CHECK((p_field->first_line & 1U) == 0, "%s field %u lines start mid line at half line %u",
+            p_spec->name, f, p_field->first_line);
+
+      /* Blanking ends then starts once in each field, with its parity */
+      CHECK((p_field->vblank_end == parity) && (p_field->vblank_start == parity),
+            "%s field %u vertical blanking callback parity %d,%d", p_spec->name, f,
+            p_field->vblank_end, p_field->vblank_start);
+
+      /* Picture is the mode's rows of this parity, in the line periods given by the
+         mode. The sync interrupt counts a line at its sync pulse, before it starts,
+         so line pulse n of the field sends scan line first_active+n */
+      CHECK(p_field->picture_lines == ((pVideoMode->height >> il) * pVideoMode->line_repeat),
+            "%s %ux%u field %u sent %u lines", p_spec->name, pVideoMode->width,
+            pVideoMode->height, f, p_field->picture_lines);
+      CHECK(p_field->first_row == parity, "%s field %u starts on row %u", p_spec->name, f,
+            p_field->first_row);
+      CHECK(p_field->picture_start == (pVideoMode->first_line - p_spec->first_active),
+            "%s %ux%u field %u picture starts on line pulse %u", p_spec->name, pVideoMode->width,
+            pVideoMode->height, f, p_field->picture_start);
+   }
+}
+
+/**
+*  @fn         onPeriod
+*  @param[IN]  auto reload, period is one tick more
+*  @param[IN]  sync pulse width, ticks
+*  @brief      Classifies each timer period and checks its sync pulse width.
+*              A broad pulse after any other starts a field
+*/
+static void onPeriod(uint16_t arr, uint16_t ccr1)
+{
+   uint16_t half = pVideoTiming->line_period / 2U;
+   tFieldRecord* p_field;
+   tPulse pulse;
+
+   if(arr == pVideoTiming->line_period)
+   {
+      CHECK(ccr1 == H_SYNC_TICKS, "line sync %u ticks", ccr1);
+      CHECK((lastPulse == PULSE_PRE) || (lastPulse == PULSE_LINE), "line pulse after pulse %d", lastPulse);
+      pulse = PULSE_LINE;
+   }
+   else
+   {
+      CHECK(arr == half, "period of %u ticks", arr + 1U);
+      if(ccr1 == SHORT_SYNC_TICKS)
+         pulse = ((lastPulse == PULSE_LINE) || (lastPulse == PULSE_POST)) ? PULSE_POST : PULSE_PRE;
+      else
+      {
+         /* Broad pulse leaves a gap of a line sync before the next half line */
+         CHECK((ccr1 + H_SYNC_TICKS >= half - 1U) && (ccr1 + H_SYNC_TICKS <= half + 1U),
+               "broad sync %u ticks", ccr1);
+         pulse = PULSE_BROAD;
+      }
+   }
+
+   if((pulse == PULSE_BROAD) && (lastPulse != PULSE_BROAD))
+   {
+      CHECK((numFields == 0) || (lastPulse == PULSE_POST), "field ends on pulse %d", lastPulse);
+      numFields++;
+      if(numFields <= MAX_FIELDS)
+      {
+         Fields[numFields - 1U].start = halfLines;
+         Fields[numFields - 1U].vblank_end = -1;
+         Fields[numFields - 1U].vblank_start = -1;
+      }
+   }
+   CHECK((pulse != PULSE_PRE) || (lastPulse != PULSE_POST), "field has no broad sync");
+   lastPulse = pulse;
+
+   if((numFields != 0) && (numFields <= MAX_FIELDS))
+   {
+      p_field = &Fields[numFields - 1U];
+      if((pulse == PULSE_LINE) && (p_field->pulses[PULSE_LINE] == 0))
+         p_field->first_line = halfLines;
+      p_field->pulses[pulse]++;
+   }
+   halfLines += (pulse == PULSE_LINE) ? 2U : 1U;
+}
+
+/**
+*  @fn         onLine
+*  @param[IN]  line data sent
+*  @param[IN]  bytes sent, the row and its trailer
+*  @brief      Checks each line is the next row of the field, sent in the
+*              line period after the previous one
+*/
+static void onLine(const uint8_t* pLine, uint16_t bytes)
+{
+   tFieldRecord* p_field;
+   uint32_t offset = (uint32_t)(pLine - FrameBuff);
+   uint16_t row = (uint16_t)(offset / pVideoMode->stride);
+   uint16_t line_pulse;
+   uint16_t expect;
+
+   CHECK((numFields != 0) && (lastPulse == PULSE_LINE), "line sent outside the active lines");
+   if(numFields > MAX_FIELDS)
+      return;
+   p_field = &Fields[numFields - 1U];
+   line_pulse = p_field->pulses[PULSE_LINE];
+   CHECK((pLine >= FrameBuff) && ((offset % pVideoMode->stride) == 0) && (row < pVideoMode->height),
+         "line sent from offset %u of the frame buffer", offset);
+   CHECK(bytes == pVideoMode->stride, "line of %u bytes", bytes);
+   CHECK(FrameBuff[offset + pVideoMode->line_bytes] == 0, "row %u trailer not zero", row);
+
+   if(p_field->picture_lines == 0)
+   {
+      p_field->picture_start = line_pulse;
+      p_field->first_row = row;
+   }
+   else
+   {
+      CHECK(line_pulse == (p_field->picture_start + p_field->picture_lines), "line pulse %u skipped",
+            line_pulse - 1U);
+      expect = p_field->first_row +
+               ((p_field->picture_lines / pVideoMode->line_repeat) << pVideoMode->interlace);
+      CHECK(row == expect, "field %u line %u sent row %u, not %u", numFields - 1U,
+            p_field->picture_lines, row, expect);
+   }
+   p_field->picture_lines++;
+}
+
+/**
+*  @fn         onVblank
+*  @param[IN]  1 at start of blanking, 0 at end
+*  @param[IN]  field parity
+*  @brief      Records the callbacks of each field, blanking ends once before
+*              the picture and starts once after it
+*/
+static void onVblank(uint8_t start, uint8_t field)
+{
+   tFieldRecord* p_field;
+
+   if((numFields == 0) || (numFields > MAX_FIELDS))
+      return;
+   p_field = &Fields[numFields - 1U];
+   if(start != 0)
+   {
+      CHECK((p_field->vblank_end >= 0) && (p_field->vblank_start < 0), "blanking started twice");
+      p_field->vblank_start = (int8_t)field;
+   }
+   else
+   {
+      CHECK((p_field->vblank_end < 0) && (p_field->picture_lines == 0), "blanking ended twice");
+      p_field->vblank_end = (int8_t)field;
+   }
+}
@@ -0,0 +1,234 @@
+/**
+*  @file   TestUtil.c
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Host test helpers: failure reports, screen set up, and golden
+*          images stored as binary PBM (P4) files, one bit per pixel with
+*          the MSB leftmost as in the frame buffer
+*/
+
+/***** Include files  *********************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include "stm32f10x.h"
+#include "Graphics.h"
+#include "TestUtil.h"
+
+/***** Constants  *************************************************/
+#define PBM_MAX_BYTES   (VIDEO_MAX_LINE_BYTES * VIDEO_MAX_ROWS)
+
+/***** Types      *************************************************/
+
+/***** Storage    *************************************************/
+
+/***** Local prototypes    ****************************************/
+static uint8_t readPbm(const char* path, uint8_t* pBits, uint16_t* p_width, uint16_t* p_height);
+static int readPbmNumber(FILE* p_file);
+
+/***** Exported functions  ****************************************/
+/**
+*  @fn         TestFail
+*  @param[IN]  source file
+*  @param[IN]  source line
+*  @param[IN]  printf format and arguments
+*  @brief      Reports a failed check and exits
+*/
+void TestFail(const char* file, int line, const char* format, ...)
+{
+   va_list args;
+
+   fprintf(stderr, "%s:%d: ", file, line);
+   va_start(args, format);
+   vfprintf(stderr, format, args);
+   va_end(args);
+   fputc('\n', stderr);
+   exit(1);
+}
+
+/**
+*  @fn         TestScreenInit
+*  @param[IN]  video mode
+*  @brief      Sets video mode with the timer stopped, so it applies at once,
+*              then clears the draw buffer and screen clip and fill pattern
+*/
+void TestScreenInit(tVideoModeId mode)
+{
+   TIM_Cmd(TIM1, DISABLE);
+   CHECK(VideoSetMode(mode) == 0, "video mode %d not supported", mode);
+   ResetClipRect();
+   SetFillPattern(0);
+   ClearScreen();
+}
+
+/**
+*  @fn         TestGetPixel
+*  @param[IN]  buffer
+*  @param[IN]  bytes from one row to the next
+*  @param[IN]  x coordinate
+*  @param[IN]  y coordinate
+*  @return     1 if pixel set
+*/
+uint8_t TestGetPixel(const uint8_t* pBuff, uint16_t stride, uint16_t x, uint16_t y)
+{
+   return (pBuff[(y * stride) + (x >> 3)] >> (7U - (x & 7U))) & 1U;
+}
+
+/**
+*  @fn     TestCheckTrailers
+*  @brief  Checks the zero trailer byte of every row, and the draw buffer
+*          beyond the rows of the video mode, are still zero
+*/
+void TestCheckTrailers(void)
+{
+   uint32_t i;
+   uint32_t end = (uint32_t)pVideoMode->height * pVideoMode->stride;
+
+   for(i = 0; i < end; i += pVideoMode->stride)
+      CHECK(pDrawBuff[i + pVideoMode->line_bytes] == 0, "trailer of row %u written", i / pVideoMode->stride);
+   for(i = end; i < VIDEO_BUFF_SIZE; i++)
+      CHECK(pDrawBuff[i] == 0, "byte %u beyond last row written", i);
+}
+
+/**
+*  @fn         TestWritePbm
+*  @param[IN]  file name
+*  @param[IN]  buffer
+*  @param[IN]  width, pixels
+*  @param[IN]  height, pixels
+*  @param[IN]  bytes from one row to the next
+*  @return     1 if written
+*/
+uint8_t TestWritePbm(const char* path, const uint8_t* pBuff, uint16_t width, uint16_t height, uint16_t stride)
+{
+   FILE* p_file = fopen(path, "wb");
+   uint16_t y;
+   uint16_t bytes = (width + 7U) / 8U;
+
+   if(p_file == 0)
+      return 0;
+   fprintf(p_file, "P4\n%u %u\n", width, height);
+   for(y = 0; y < height; y++)
+      fwrite(&pBuff[y * stride], 1, bytes, p_file);
+   fclose(p_file);
+   return 1;
+}
+
+/**
+*  @fn         TestGolden
+*  @param[IN]  case name, file is TEST_GOLDEN_DIR name.pbm
+*  @param[IN]  1 to rewrite the golden image from the draw buffer
+*  @brief      Compares the draw buffer, over the video mode, with a golden
+*              image. On a mismatch the image drawn is left in TEST_OUTPUT_DIR
+*/
+void TestGolden(const char* name, uint8_t update)
+{
+   static uint8_t golden[PBM_MAX_BYTES];
+   char path[128];
+   uint16_t width;
+   uint16_t height;
+   uint16_t bytes = (pVideoMode->width + 7U) / 8U;
+   uint16_t x, y;
+   uint32_t diffs = 0;
+   int32_t first = -1;
+
+   snprintf(path, sizeof(path), TEST_GOLDEN_DIR "%s.pbm", name);
+   if(update != 0)
+   {
+      CHECK(TestWritePbm(path, pDrawBuff, pVideoMode->width, pVideoMode->height, pVideoMode->stride) != 0,
+            "cannot write %s", path);
+      return;
+   }
+
+   CHECK(readPbm(path, golden, &width, &height) != 0, "cannot read %s", path);
+   CHECK((width == pVideoMode->width) && (height == pVideoMode->height),
+         "%s is %ux%u, mode is %ux%u", path, width, height, pVideoMode->width, pVideoMode->height);
+   for(y = 0; y < height; y++)
+   {
+      for(x = 0; x < width; x++)
+      {
+         if(TestGetPixel(golden, bytes, x, y) != TestGetPixel(pDrawBuff, pVideoMode->stride, x, y))
+         {
+            if(first < 0)
+               first = ((int32_t)y << 16) | x;
+            diffs++;
+         }
+      }
+   }
+   if(diffs != 0)
+   {
+      snprintf(path, sizeof(path), TEST_OUTPUT_DIR "%s.pbm", name);
+      TestWritePbm(path, pDrawBuff, pVideoMode->width, pVideoMode->height, pVideoMode->stride);
+   }
+   CHECK(diffs == 0, "%s: %u pixels differ from golden image, first at %d,%d, drawn image is %s",
+         name, diffs, first & 0xFFFF, first >> 16, path);
+}
+
+/***** Local    functions  ****************************************/
+
+/**
+*  @fn         readPbm
+*  @param[IN]  file name
+*  @param[OUT] pixel data, rows of (width+7)/8 bytes
+*  @param[OUT] width
+*  @param[OUT] height
+*  @return     1 if read
+*/
+static uint8_t readPbm(const char* path, uint8_t* pBits, uint16_t* p_width, uint16_t* p_height)
+{
+   FILE* p_file = fopen(path, "rb");
+   int width;
+   int height;
+   size_t bytes;
+   uint8_t ok = 0;
+
+   if(p_file == 0)
+      return 0;
+   if((fgetc(p_file) == 'P') && (fgetc(p_file) == '4'))
+   {
+      width = readPbmNumber(p_file);
+      height = readPbmNumber(p_file);
+      bytes = (size_t)((width + 7) / 8) * (size_t)height;
+      /* Single white space character ends the header */
+      if((width > 0) && (height > 0) && (bytes <= PBM_MAX_BYTES) && (fgetc(p_file) != EOF) &&
+         (fread(pBits, 1, bytes, p_file) == bytes))
+      {
+         *p_width = (uint16_t)width;
+         *p_height = (uint16_t)height;
+         ok = 1;
+      }
+   }
+   fclose(p_file);
+   return ok;
+}
+
+/**
+*  @fn         readPbmNumber
+*  @param[IN]  file
+*  @return     next decimal number of header, skipping white space and comments
+*/
+static int readPbmNumber(FILE* p_file)
+{
+   int c;
+   int value = 0;
+
+   do
+   {
+      c = fgetc(p_file);
+      if(c == '#')
+      {
+         while((c != '\n') && (c != EOF))
+            c = fgetc(p_file);
+      }
+   }
+   while((c == ' ') || (c == '\t') || (c == '\r') || (c == '\n'));
+
+   while((c >= '0') && (c <= '9'))
+   {
+      value = (value * 10) + (c - '0');
+      c = fgetc(p_file);
+   }
+   ungetc(c, p_file);
+   return value;
+}
@@ -0,0 +1,31 @@
+/**
+*  @file   TestUtil.h
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Include file for host test helpers
+*/
+
+#ifndef __TESTUTIL_H
+#define __TESTUTIL_H
+
+#include "stm32f10x.h"
+#include "Graphics.h"
+
+/***** Constants  *************************************************/
+#define TEST_GOLDEN_DIR       "golden/"   /* tests run from the test directory */
+#define TEST_OUTPUT_DIR       "build/"    /* images of failed golden cases */
+
+/* Stops the test with a message if a condition does not hold */
+#define CHECK(cond, ...)      do { if(!(cond)) TestFail(__FILE__, __LINE__, __VA_ARGS__); } while(0)
+
+/***** Types      *************************************************/
+
+/***** Exported functions   ***************************************/
+void TestFail(const char* file, int line, const char* format, ...);
+void TestScreenInit(tVideoModeId mode);
+uint8_t TestGetPixel(const uint8_t* pBuff, uint16_t stride, uint16_t x, uint16_t y);
+void TestCheckTrailers(void);
+uint8_t TestWritePbm(const char* path, const uint8_t* pBuff, uint16_t width, uint16_t height, uint16_t stride);
+void TestGolden(const char* name, uint8_t update);
+
+#endif  /*  __TESTUTIL_H  */
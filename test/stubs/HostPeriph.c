@@ -0,0 +1,482 @@
+/**
+*  @file   HostPeriph.c
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Host emulation of the peripherals used by the video generator
+*          TIM1 runs on a model clock in timer ticks. Each period loads the
+*          preloaded ARR, CCR1 and CCR2, then raises its compare events in
+*          time order, calling TIM1_CC_IRQHandler as the NVIC would. Line DMA
+*          on channel 5 takes the time of the SPI transfer and ends with a
+*          DMA1_Channel5_IRQHandler call, memory to memory DMA copies at once.
+*          A pended PendSV runs once no interrupt is active, and interrupts
+*          that fall due while it spends time pre-empt it.
+*          DMA addresses are 32 bits, so buffers must lie in the low 4GB,
+*          which a non PIE host executable gives
+*/
+
+/***** Include files  *********************************************/
+#include <string.h>
+#include "HostPeriph.h"
+
+/***** Constants  *************************************************/
+#define NO_EVENT           0xFFFFFFFFUL
+#define DMA_CCR_CLEAR      0xFFFF800FUL   /* bits kept by DMA_Init, as stm_lib */
+#define DMA_CCR_PSIZE_WORD 0x0200UL
+#define SPI_CR1_SPE        0x0040U
+#define SPI_CR1_BR_POS     3U
+
+/***** Types      *************************************************/
+typedef enum {EVENT_CC1, EVENT_CC2, EVENT_DMA_TC, EVENT_UPDATE} tEvent;
+
+/***** Storage    *************************************************/
+TIM_TypeDef HostTIM1;
+SPI_TypeDef HostSPI2;
+DMA_Channel_TypeDef HostDMA1_Channel[7];
+GPIO_TypeDef HostGPIO[3];
+SCB_Type HostSCB;
+DWT_Type HostDWT;
+CoreDebug_Type HostCoreDebug;
+
+uint32_t HostTicks = 0;
+uint32_t HostIsrTicks = 0;
+uint32_t HostDmaCopyBytes = 0;
+void (*pHostPeriodHook)(uint16_t, uint16_t) = 0;
+void (*pHostLineHook)(const uint8_t*, uint16_t) = 0;
+
+static uint32_t DmaFlags = 0;          /* DMA1 ISR, TCx flags        */
+static uint32_t periodStart;           /* tick of last update event  */
+static uint16_t shadowARR;
+static uint16_t shadowCCR1;
+static uint16_t shadowCCR2;
+static uint8_t  cc1Done;
+static uint8_t  cc2Done;
+static uint32_t lineDone = NO_EVENT;   /* tick the line DMA completes */
+static uint8_t  isrActive = 0;
+static uint32_t isrTime = 0;           /* ticks spent in interrupts  */
+static uint8_t  pendSvActive = 0;
+
+/***** Local prototypes    ****************************************/
+static void startPeriod(void);
+static uint32_t nextEvent(tEvent* p_event);
+static void runEvents(uint32_t until);
+static void raiseTimer(uint16_t flag);
+static void dispatchTimer(void);
+static void runPendSV(void);
+static void startLine(void);
+static void copyMemToMem(DMA_Channel_TypeDef* p_chan);
+static __INLINE void* dmaAddress(uint32_t address);
+
+/***** Exported functions  ****************************************/
+/**
+*  @fn     HostReset
+*  @brief  Clears peripheral registers, model time and hooks. The video
+*          interrupt handlers keep their state, so call between whole fields
+*/
+void HostReset(void)
+{
+   memset(&HostTIM1, 0, sizeof(HostTIM1));
+   memset(&HostSPI2, 0, sizeof(HostSPI2));
+   memset(HostDMA1_Channel, 0, sizeof(HostDMA1_Channel));
+   memset(HostGPIO, 0, sizeof(HostGPIO));
+   memset(&HostSCB, 0, sizeof(HostSCB));
+   HostTicks = 0;
+   HostIsrTicks = 0;
+   HostDmaCopyBytes = 0;
+   pHostPeriodHook = 0;
+   pHostLineHook = 0;
+   DmaFlags = 0;
+   lineDone = NO_EVENT;
+}
+
+/**
+*  @fn         HostRun
+*  @param[IN]  time to run, ticks
+*  @brief      Runs the main loop for a time, taking the interrupts that fall due
+*/
+void HostRun(uint32_t ticks)
+{
+   runEvents(HostTicks + ticks);
+}
+
+/**
+*  @fn         HostRunPeriods
+*  @param[IN]  number of TIM1 periods
+*  @brief      Runs until that many more timer periods have started
+*/
+void HostRunPeriods(uint32_t periods)
+{
+   tEvent event;
+   uint32_t time;
+
+   while(periods > 0)
+   {
+      time = nextEvent(&event);
+      if(time == NO_EVENT)
+         return;
+      runEvents(time);
+      if(event == EVENT_UPDATE)
+         periods--;
+   }
+}
+
+/**
+*  @fn         HostSpend
+*  @param[IN]  CPU time, ticks
+*  @brief      Accounts for time taken by the code now running. In the main loop
+*              or PendSV, interrupts falling due pre-empt it, and it finishes
+*              later by the time they take. In an interrupt handler they wait
+*              until it returns
+*/
+void HostSpend(uint32_t ticks)
+{
+   uint32_t until = HostTicks + ticks;
+   uint32_t isr_start;
+
+   if(isrActive != 0)
+   {
+      HostTicks += ticks;
+      isrTime += ticks;
+      return;
+   }
+   do
+   {
+      isr_start = isrTime;
+      runEvents(until);
+      until += isrTime - isr_start;
+   } while(isrTime != isr_start);
+}
+
+/**
+*  @fn         HostClz
+*  @param[IN]  value
+*  @return     leading zero bits, 32 for 0 as the CLZ instruction
+*/
+uint32_t HostClz(uint32_t value)
+{
+   return (value == 0) ? 32U : (uint32_t)__builtin_clz(value);
+}
+
+/***** Standard peripheral library ********************************/
+void RCC_AHBPeriphClockCmd(uint32_t periph, FunctionalState state)  { (void)periph; (void)state; }
+void RCC_APB1PeriphClockCmd(uint32_t periph, FunctionalState state) { (void)periph; (void)state; }
+void RCC_APB2PeriphClockCmd(uint32_t periph, FunctionalState state) { (void)periph; (void)state; }
+
+void GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* init)       { (void)GPIOx; (void)init; }
+void GPIO_SetBits(GPIO_TypeDef* GPIOx, uint16_t pins)             { GPIOx->ODR |= pins; }
+void GPIO_ResetBits(GPIO_TypeDef* GPIOx, uint16_t pins)           { GPIOx->ODR &= ~(uint32_t)pins; }
+
+void NVIC_PriorityGroupConfig(uint32_t group)                     { (void)group; }
+void NVIC_Init(NVIC_InitTypeDef* init)                            { (void)init; }
+void NVIC_SetPriority(IRQn_Type irq, uint32_t priority)           { (void)irq; (void)priority; }
+
+void TIM_DeInit(TIM_TypeDef* TIMx)
+{
+   memset(TIMx, 0, sizeof(TIM_TypeDef));
+}
+
+void TIM_TimeBaseInit(TIM_TypeDef* TIMx, TIM_TimeBaseInitTypeDef* init)
+{
+   TIMx->ARR = init->TIM_Period;
+   TIMx->PSC = init->TIM_Prescaler;
+}
+
+void TIM_OC1Init(TIM_TypeDef* TIMx, TIM_OCInitTypeDef* init)      { TIMx->CCR1 = init->TIM_Pulse; }
+void TIM_OC2Init(TIM_TypeDef* TIMx, TIM_OCInitTypeDef* init)      { TIMx->CCR2 = init->TIM_Pulse; }
+
+/* Compare and auto reload registers are always preloaded */
+void TIM_OC1PreloadConfig(TIM_TypeDef* TIMx, uint16_t preload)    { (void)TIMx; (void)preload; }
+void TIM_OC2PreloadConfig(TIM_TypeDef* TIMx, uint16_t preload)    { (void)TIMx; (void)preload; }
+void TIM_ARRPreloadConfig(TIM_TypeDef* TIMx, FunctionalState state) { (void)TIMx; (void)state; }
+void TIM_CtrlPWMOutputs(TIM_TypeDef* TIMx, FunctionalState state) { (void)TIMx; (void)state; }
+
+void TIM_ITConfig(TIM_TypeDef* TIMx, uint16_t it, FunctionalState state)
+{
+   if(state != DISABLE)
+      TIMx->DIER |= it;
+   else
+      TIMx->DIER &= ~it;
+}
+
+void TIM_DMACmd(TIM_TypeDef* TIMx, uint16_t source, FunctionalState state)
+{
+   TIM_ITConfig(TIMx, source, state);
+}
+
+void TIM_Cmd(TIM_TypeDef* TIMx, FunctionalState state)
+{
+   if(state != DISABLE)
+   {
+      TIMx->CR1 |= TIM_CR1_CEN;
+      periodStart = HostTicks;
+      startPeriod();
+   }
+   else
+      TIMx->CR1 &= ~TIM_CR1_CEN;
+}
+
+void TIM_ClearFlag(TIM_TypeDef* TIMx, uint16_t flag)              { TIMx->SR &= ~flag; }
+void TIM_ClearITPendingBit(TIM_TypeDef* TIMx, uint16_t it)        { TIMx->SR &= ~it; }
+
+ITStatus TIM_GetITStatus(TIM_TypeDef* TIMx, uint16_t it)
+{
+   return (((TIMx->SR & it) != 0) && ((TIMx->DIER & it) != 0)) ? SET : RESET;
+}
+
+void SPI_Init(SPI_TypeDef* SPIx, SPI_InitTypeDef* init)
+{
+   SPIx->CR1 = init->SPI_Direction | init->SPI_Mode | init->SPI_DataSize | init->SPI_CPOL |
+               init->SPI_CPHA | init->SPI_NSS | init->SPI_BaudRatePrescaler | init->SPI_FirstBit;
+}
+
+void SPI_Cmd(SPI_TypeDef* SPIx, FunctionalState state)
+{
+   if(state != DISABLE)
+      SPIx->CR1 |= SPI_CR1_SPE;
+   else
+      SPIx->CR1 &= ~SPI_CR1_SPE;
+}
+
+void SPI_I2S_DMACmd(SPI_TypeDef* SPIx, uint16_t req, FunctionalState state) { (void)SPIx; (void)req; (void)state; }
+FlagStatus SPI_I2S_GetFlagStatus(SPI_TypeDef* SPIx, uint16_t flag)          { (void)SPIx; (void)flag; return SET; }
+void SPI_I2S_SendData(SPI_TypeDef* SPIx, uint16_t data)                     { SPIx->DR = data; }
+
+void DMA_DeInit(DMA_Channel_TypeDef* DMAy_Channelx)
+{
+   memset(DMAy_Channelx, 0, sizeof(DMA_Channel_TypeDef));
+}
+
+void DMA_Init(DMA_Channel_TypeDef* DMAy_Channelx, DMA_InitTypeDef* init)
+{
+   DMAy_Channelx->CCR = (DMAy_Channelx->CCR & DMA_CCR_CLEAR) | init->DMA_DIR | init->DMA_Mode |
+                        init->DMA_PeripheralInc | init->DMA_MemoryInc | init->DMA_PeripheralDataSize |
+                        init->DMA_MemoryDataSize | init->DMA_Priority | init->DMA_M2M;
+   DMAy_Channelx->CNDTR = init->DMA_BufferSize;
+   DMAy_Channelx->CPAR = init->DMA_PeripheralBaseAddr;
+   DMAy_Channelx->CMAR = init->DMA_MemoryBaseAddr;
+}
+
+void DMA_ITConfig(DMA_Channel_TypeDef* DMAy_Channelx, uint32_t it, FunctionalState state)
+{
+   if(state != DISABLE)
+      DMAy_Channelx->CCR |= it;
+   else
+      DMAy_Channelx->CCR &= ~it;
+}
+
+void DMA_Cmd(DMA_Channel_TypeDef* DMAy_Channelx, FunctionalState state)
+{
+   if(state == DISABLE)
+   {
+      DMAy_Channelx->CCR &= ~(uint32_t)DMA_CCR5_EN;
+      return;
+   }
+   DMAy_Channelx->CCR |= DMA_CCR5_EN;
+   if((DMAy_Channelx->CCR & DMA_CCR1_MEM2MEM) != 0)
+      copyMemToMem(DMAy_Channelx);
+   else if(DMAy_Channelx == DMA1_Channel5)
+      startLine();
+}
+
+FlagStatus DMA_GetFlagStatus(uint32_t flag)   { return ((DmaFlags & flag) != 0) ? SET : RESET; }
+void DMA_ClearFlag(uint32_t flag)             { DmaFlags &= ~flag; }
+ITStatus DMA_GetITStatus(uint32_t it)         { return ((DmaFlags & it) != 0) ? SET : RESET; }
+void DMA_ClearITPendingBit(uint32_t it)       { DmaFlags &= ~it; }
+
+/***** Local    functions  ****************************************/
+
+/**
+*  @fn     startPeriod
+*  @brief  Update event, loads the preloaded registers
+*/
+static void startPeriod(void)
+{
+   shadowARR = TIM1->ARR;
+   shadowCCR1 = TIM1->CCR1;
+   shadowCCR2 = TIM1->CCR2;
+   cc1Done = (shadowCCR1 > shadowARR);
+   cc2Done = (shadowCCR2 > shadowARR);
+   if(pHostPeriodHook != 0)
+      pHostPeriodHook(shadowARR, shadowCCR1);
+}
+
+/**
+*  @fn         nextEvent
+*  @param[OUT] event
+*  @return     tick the next event is due, NO_EVENT if none
+*/
+static uint32_t nextEvent(tEvent* p_event)
+{
+   uint32_t time = NO_EVENT;
+
+   *p_event = EVENT_UPDATE;
+   if((TIM1->CR1 & TIM_CR1_CEN) != 0)
+   {
+      time = periodStart + shadowARR + 1U;
+      if((cc2Done == 0) && ((periodStart + shadowCCR2) <= time))
+      {
+         *p_event = EVENT_CC2;
+         time = periodStart + shadowCCR2;
+      }
+      if((cc1Done == 0) && ((periodStart + shadowCCR1) <= time))
+      {
+         *p_event = EVENT_CC1;
+         time = periodStart + shadowCCR1;
+      }
+   }
+   if((lineDone != NO_EVENT) && (lineDone < time))
+   {
+      *p_event = EVENT_DMA_TC;
+      time = lineDone;
+   }
+   return time;
+}
+
+/**
+*  @fn         runEvents
+*  @param[IN]  tick to run up to
+*  @brief      Handles events due up to a time, in order. An event due while
+*              an interrupt was still running is handled as soon as it returns
+*/
+static void runEvents(uint32_t until)
+{
+   tEvent event;
+   uint32_t time;
+
+   while((time = nextEvent(&event)) <= until)
+   {
+      if(time > HostTicks)
+         HostTicks = time;
+      switch(event)
+      {
+         case EVENT_CC1:
+            cc1Done = 1;
+            raiseTimer(TIM_FLAG_CC1);
+         break;
+
+         case EVENT_CC2:
+            cc2Done = 1;
+            /* CC2 DMA request copies a word from memory to peripheral */
+            if(((TIM1->DIER & TIM_DMA_CC2) != 0) && ((DMA1_Channel3->CCR & DMA_CCR5_EN) != 0))
+            {
+               *(uint32_t*)dmaAddress(DMA1_Channel3->CPAR) = *(uint32_t*)dmaAddress(DMA1_Channel3->CMAR);
+               if((DMA1_Channel5->CCR & DMA_CCR5_EN) != 0)
+                  startLine();
+            }
+            raiseTimer(TIM_FLAG_CC2);
+         break;
+
+         case EVENT_DMA_TC:
+            lineDone = NO_EVENT;
+            DMA1_Channel5->CNDTR = 0;
+            DmaFlags |= DMA1_IT_TC5;
+            if((DMA1_Channel5->CCR & DMA_CCR5_TCIE) != 0)
+            {
+               isrActive = 1;
+               DMA1_Channel5_IRQHandler();
+               isrActive = 0;
+               HostTicks += HostIsrTicks;
+               isrTime += HostIsrTicks;
+            }
+         break;
+
+         case EVENT_UPDATE:
+            periodStart += shadowARR + 1U;
+            startPeriod();
+         break;
+      }
+      if(pendSvActive == 0)
+         runPendSV();
+   }
+   if(HostTicks < until)
+      HostTicks = until;
+}
+
+/**
+*  @fn         raiseTimer
+*  @param[IN]  TIM1 status flag
+*  @brief      Sets flag, calling the handler while enabled flags are pending
+*/
+static void raiseTimer(uint16_t flag)
+{
+   TIM1->SR |= flag;
+   dispatchTimer();
+}
+
+/**
+*  @fn     dispatchTimer
+*  @brief  Calls TIM1_CC_IRQHandler until no enabled compare flag is set, as
+*          the handler takes one flag per call
+*/
+static void dispatchTimer(void)
+{
+   while((TIM1->SR & TIM1->DIER & (TIM_IT_CC1 | TIM_IT_CC2)) != 0)
+   {
+      isrActive = 1;
+      TIM1_CC_IRQHandler();
+      isrActive = 0;
+      HostTicks += HostIsrTicks;
+      isrTime += HostIsrTicks;
+   }
+}
+
+/**
+*  @fn     runPendSV
+*  @brief  Runs PendSV while it is pending, tail chaining if pended again
+*/
+static void runPendSV(void)
+{
+   while((SCB->ICSR & SCB_ICSR_PENDSVSET) != 0)
+   {
+      SCB->ICSR &= ~SCB_ICSR_PENDSVSET;
+      pendSvActive = 1;
+      PendSV_Handler();
+      pendSvActive = 0;
+   }
+}
+
+/**
+*  @fn     startLine
+*  @brief  Line DMA enabled, reports the line and schedules its completion
+*          from the SPI bit rate. TIM1 runs at 8MHz and SPI2 at 28MHz over
+*          the prescaler
+*/
+static void startLine(void)
+{
+   uint32_t bytes = DMA1_Channel5->CNDTR;
+   uint32_t divider = 2UL << ((SPI2->CR1 & SPI_BaudRatePrescaler_256) >> SPI_CR1_BR_POS);
+
+   if(bytes == 0)
+      return;
+   if(pHostLineHook != 0)
+      pHostLineHook((const uint8_t*)dmaAddress(DMA1_Channel5->CMAR), (uint16_t)bytes);
+   lineDone = HostTicks + (((bytes * 64UL * divider) + 27U) / 28U);
+}
+
+/**
+*  @fn         copyMemToMem
+*  @param[IN]  channel
+*  @brief      Memory to memory transfer, completes at once
+*/
+static void copyMemToMem(DMA_Channel_TypeDef* p_chan)
+{
+   uint32_t bytes = p_chan->CNDTR * (((p_chan->CCR & DMA_CCR_PSIZE_WORD) != 0) ? 4U : 1U);
+
+   if((p_chan->CCR & DMA_CCR1_DIR) != 0)
+      memcpy(dmaAddress(p_chan->CPAR), dmaAddress(p_chan->CMAR), bytes);
+   else
+      memcpy(dmaAddress(p_chan->CMAR), dmaAddress(p_chan->CPAR), bytes);
+   HostDmaCopyBytes += bytes;
+   p_chan->CNDTR = 0;
+   if(p_chan == DMA1_Channel1)
+      DmaFlags |= DMA1_FLAG_TC1;
+}
+
+/**
+*  @fn         dmaAddress
+*  @param[IN]  DMA address register value
+*  @return     host pointer
+*/
+static __INLINE void* dmaAddress(uint32_t address)
+{
+   return (void*)(uintptr_t)address;
+}
@@ -0,0 +1,38 @@
+/**
+*  @file   HostPeriph.h
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Include file for host emulation of the video peripherals
+*/
+
+#ifndef __HOSTPERIPH_H
+#define __HOSTPERIPH_H
+
+#include "stm32f10x.h"
+
+/***** Constants  *************************************************/
+
+/***** Types      *************************************************/
+
+/***** Global storage**********************************************/
+extern uint32_t HostTicks;          /* model time, TIM1 ticks since HostReset() */
+extern uint32_t HostIsrTicks;       /* CPU time taken by each interrupt, ticks  */
+extern uint32_t HostDmaCopyBytes;   /* bytes moved by memory to memory DMA      */
+
+/* Called as each TIM1 period starts, with the preloaded ARR and CCR1 now in effect */
+extern void (*pHostPeriodHook)(uint16_t arr, uint16_t ccr1);
+/* Called as each line DMA starts, with the line data and bytes to send */
+extern void (*pHostLineHook)(const uint8_t* pLine, uint16_t bytes);
+
+/***** Exported functions   ***************************************/
+void HostReset(void);
+void HostRun(uint32_t ticks);
+void HostRunPeriods(uint32_t periods);
+void HostSpend(uint32_t ticks);
+
+/* Interrupt handlers, in Video.c */
+void TIM1_CC_IRQHandler(void);
+void DMA1_Channel5_IRQHandler(void);
+void PendSV_Handler(void);
+
+#endif  /*  __HOSTPERIPH_H  */
@@ -0,0 +1,300 @@
+/**
+*  @file   stm32f10x.h
+*  @author Rob Gee
+*  @date   November 2017
+*  @brief  Host stand-in for the device header and standard peripheral library
+*          Peripherals are structs in RAM and the library calls are emulated in
+*          HostPeriph.c, so the video and graphics modules build with gcc.
+*          Only what the modules use is declared, values are as in stm_lib
+*/
+
+#ifndef __STM32F10x_H
+#define __STM32F10x_H
+
+#include <stdint.h>
+
+/***** Constants  *************************************************/
+#define __INLINE                       inline
+#define __REV(x)                       __builtin_bswap32(x)
+#define __CLZ(x)                       HostClz(x)
+#define __disable_irq()
+#define __enable_irq()
+
+#define SystemCoreClock                56000000UL
+
+/* Core */
+#define SCB_ICSR_PENDSVSET             ((uint32_t)0x10000000)
+#define CoreDebug_DEMCR_TRCENA_Msk     (1UL << 24)
+#define DWT_CTRL_CYCCNTENA_Msk         (1UL << 0)
+
+/* RCC */
+#define RCC_AHBPeriph_DMA1             ((uint32_t)0x00000001)
+#define RCC_APB1Periph_SPI2            ((uint32_t)0x00004000)
+#define RCC_APB2Periph_AFIO            ((uint32_t)0x00000001)
+#define RCC_APB2Periph_GPIOA           ((uint32_t)0x00000004)
+#define RCC_APB2Periph_GPIOB           ((uint32_t)0x00000008)
+#define RCC_APB2Periph_TIM1            ((uint32_t)0x00000800)
+
+/* GPIO */
+#define GPIO_Pin_0                     ((uint16_t)0x0001)
+#define GPIO_Pin_1                     ((uint16_t)0x0002)
+#define GPIO_Pin_2                     ((uint16_t)0x0004)
+#define GPIO_Pin_7                     ((uint16_t)0x0080)
+#define GPIO_Pin_8                     ((uint16_t)0x0100)
+#define GPIO_Pin_9                     ((uint16_t)0x0200)
+#define GPIO_Pin_12                    ((uint16_t)0x1000)
+#define GPIO_Pin_15                    ((uint16_t)0x8000)
+
+/* NVIC */
+#define NVIC_PriorityGroup_1           ((uint32_t)0x600)
+
+/* TIM */
+#define TIM_CR1_CEN                    ((uint16_t)0x0001)
+#define TIM_IT_CC1                     ((uint16_t)0x0002)
+#define TIM_IT_CC2                     ((uint16_t)0x0004)
+#define TIM_FLAG_Update                ((uint16_t)0x0001)
+#define TIM_FLAG_CC1                   ((uint16_t)0x0002)
+#define TIM_FLAG_CC2                   ((uint16_t)0x0004)
+#define TIM_DMA_CC2                    ((uint16_t)0x0400)
+#define TIM_CKD_DIV1                   ((uint16_t)0x0000)
+#define TIM_CounterMode_Up             ((uint16_t)0x0000)
+#define TIM_OCMode_PWM1                ((uint16_t)0x0060)
+#define TIM_OutputState_Enable         ((uint16_t)0x0001)
+#define TIM_OCPolarity_High            ((uint16_t)0x0000)
+#define TIM_OCPolarity_Low             ((uint16_t)0x0002)
+#define TIM_OCPreload_Enable           ((uint16_t)0x0008)
+
+/* SPI */
+#define SPI_BaudRatePrescaler_2        ((uint16_t)0x0000)
+#define SPI_BaudRatePrescaler_4        ((uint16_t)0x0008)
+#define SPI_BaudRatePrescaler_256      ((uint16_t)0x0038)
+#define SPI_Direction_1Line_Tx         ((uint16_t)0xC000)
+#define SPI_Mode_Master                ((uint16_t)0x0104)
+#define SPI_DataSize_8b                ((uint16_t)0x0000)
+#define SPI_CPOL_High                  ((uint16_t)0x0002)
+#define SPI_CPHA_1Edge                 ((uint16_t)0x0000)
+#define SPI_NSS_Soft                   ((uint16_t)0x0200)
+#define SPI_FirstBit_MSB               ((uint16_t)0x0000)
+#define SPI_I2S_DMAReq_Tx              ((uint16_t)0x0002)
+#define SPI_I2S_FLAG_TXE               ((uint16_t)0x0002)
+
+/* DMA */
+#define DMA_CCR1_MEM2MEM               ((uint16_t)0x4000)
+#define DMA_CCR1_DIR                   ((uint16_t)0x0010)
+#define DMA_CCR5_EN                    ((uint16_t)0x0001)
+#define DMA_CCR5_TCIE                  ((uint16_t)0x0002)
+#define DMA1_FLAG_TC1                  ((uint32_t)0x00000002)
+#define DMA1_IT_TC5                    ((uint32_t)0x00020000)
+#define DMA_DIR_PeripheralDST          ((uint32_t)0x00000010)
+#define DMA_DIR_PeripheralSRC          ((uint32_t)0x00000000)
+#define DMA_PeripheralInc_Enable       ((uint32_t)0x00000040)
+#define DMA_PeripheralInc_Disable      ((uint32_t)0x00000000)
+#define DMA_MemoryInc_Enable           ((uint32_t)0x00000080)
+#define DMA_MemoryInc_Disable          ((uint32_t)0x00000000)
+#define DMA_PeripheralDataSize_Byte    ((uint32_t)0x00000000)
+#define DMA_PeripheralDataSize_Word    ((uint32_t)0x00000200)
+#define DMA_MemoryDataSize_Byte        ((uint32_t)0x00000000)
+#define DMA_MemoryDataSize_Word        ((uint32_t)0x00000800)
+#define DMA_Mode_Circular              ((uint32_t)0x00000020)
+#define DMA_Mode_Normal                ((uint32_t)0x00000000)
+#define DMA_Priority_VeryHigh          ((uint32_t)0x00003000)
+#define DMA_Priority_High              ((uint32_t)0x00002000)
+#define DMA_Priority_Low               ((uint32_t)0x00000000)
+#define DMA_M2M_Enable                 ((uint32_t)0x00004000)
+#define DMA_M2M_Disable                ((uint32_t)0x00000000)
+
+/* Peripheral instances */
+#define TIM1                           (&HostTIM1)
+#define SPI2                           (&HostSPI2)
+#define DMA1_Channel1                  (&HostDMA1_Channel[0])
+#define DMA1_Channel3                  (&HostDMA1_Channel[2])
+#define DMA1_Channel5                  (&HostDMA1_Channel[4])
+#define GPIOA                          (&HostGPIO[0])
+#define GPIOB                          (&HostGPIO[1])
+#define GPIOC                          (&HostGPIO[2])
+#define SCB                            (&HostSCB)
+#define DWT                            (&HostDWT)
+#define CoreDebug                      (&HostCoreDebug)
+
+/***** Types      *************************************************/
+/* Older short names, still used by some of the application */
+typedef uint32_t u32;
+typedef uint16_t u16;
+typedef uint8_t  u8;
+
+typedef enum {RESET = 0, SET = !RESET} FlagStatus, ITStatus;
+typedef enum {DISABLE = 0, ENABLE = !DISABLE} FunctionalState;
+
+typedef enum {TIM1_CC_IRQn = 27, DMA1_Channel5_IRQn = 15, PendSV_IRQn = -2} IRQn_Type;
+typedef enum {GPIO_Speed_10MHz = 1, GPIO_Speed_2MHz, GPIO_Speed_50MHz} GPIOSpeed_TypeDef;
+typedef enum {GPIO_Mode_AF_PP = 0x18} GPIOMode_TypeDef;
+
+typedef struct
+{
+   volatile uint32_t ICSR;
+} SCB_Type;
+
+typedef struct
+{
+   volatile uint32_t CTRL;
+   volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+   volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct
+{
+   volatile uint32_t IDR;
+   volatile uint32_t ODR;
+} GPIO_TypeDef;
+
+typedef struct
+{
+   volatile uint16_t CR1;
+   volatile uint16_t DIER;
+   volatile uint16_t SR;
+   volatile uint16_t CCER;
+   volatile uint16_t PSC;
+   volatile uint16_t ARR;
+   volatile uint16_t CCR1;
+   volatile uint16_t CCR2;
+} TIM_TypeDef;
+
+typedef struct
+{
+   volatile uint16_t CR1;
+   volatile uint16_t CR2;
+   volatile uint16_t SR;
+   volatile uint16_t DR;
+} SPI_TypeDef;
+
+typedef struct
+{
+   volatile uint32_t CCR;
+   volatile uint32_t CNDTR;
+   volatile uint32_t CPAR;     /* addresses are 32 bits, as on the target */
+   volatile uint32_t CMAR;
+} DMA_Channel_TypeDef;
+
+typedef struct
+{
+   uint16_t GPIO_Pin;
+   GPIOSpeed_TypeDef GPIO_Speed;
+   GPIOMode_TypeDef GPIO_Mode;
+} GPIO_InitTypeDef;
+
+typedef struct
+{
+   uint8_t NVIC_IRQChannel;
+   uint8_t NVIC_IRQChannelPreemptionPriority;
+   uint8_t NVIC_IRQChannelSubPriority;
+   FunctionalState NVIC_IRQChannelCmd;
+} NVIC_InitTypeDef;
+
+typedef struct
+{
+   uint16_t TIM_Prescaler;
+   uint16_t TIM_CounterMode;
+   uint16_t TIM_Period;
+   uint16_t TIM_ClockDivision;
+   uint8_t  TIM_RepetitionCounter;
+} TIM_TimeBaseInitTypeDef;
+
+typedef struct
+{
+   uint16_t TIM_OCMode;
+   uint16_t TIM_OutputState;
+   uint16_t TIM_OutputNState;
+   uint16_t TIM_Pulse;
+   uint16_t TIM_OCPolarity;
+   uint16_t TIM_OCNPolarity;
+   uint16_t TIM_OCIdleState;
+   uint16_t TIM_OCNIdleState;
+} TIM_OCInitTypeDef;
+
+typedef struct
+{
+   uint16_t SPI_Direction;
+   uint16_t SPI_Mode;
+   uint16_t SPI_DataSize;
+   uint16_t SPI_CPOL;
+   uint16_t SPI_CPHA;
+   uint16_t SPI_NSS;
+   uint16_t SPI_BaudRatePrescaler;
+   uint16_t SPI_FirstBit;
+   uint16_t SPI_CRCPolynomial;
+} SPI_InitTypeDef;
+
+typedef struct
+{
+   uint32_t DMA_PeripheralBaseAddr;
+   uint32_t DMA_MemoryBaseAddr;
+   uint32_t DMA_DIR;
+   uint32_t DMA_BufferSize;
+   uint32_t DMA_PeripheralInc;
+   uint32_t DMA_MemoryInc;
+   uint32_t DMA_PeripheralDataSize;
+   uint32_t DMA_MemoryDataSize;
+   uint32_t DMA_Mode;
+   uint32_t DMA_Priority;
+   uint32_t DMA_M2M;
+} DMA_InitTypeDef;
+
+/***** Global storage**********************************************/
+extern TIM_TypeDef HostTIM1;
+extern SPI_TypeDef HostSPI2;
+extern DMA_Channel_TypeDef HostDMA1_Channel[7];
+extern GPIO_TypeDef HostGPIO[3];
+extern SCB_Type HostSCB;
+extern DWT_Type HostDWT;
+extern CoreDebug_Type HostCoreDebug;
+
+/***** Exported functions   ***************************************/
+uint32_t HostClz(uint32_t value);
+
+void RCC_AHBPeriphClockCmd(uint32_t periph, FunctionalState state);
+void RCC_APB1PeriphClockCmd(uint32_t periph, FunctionalState state);
+void RCC_APB2PeriphClockCmd(uint32_t periph, FunctionalState state);
+
+void GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* init);
+void GPIO_SetBits(GPIO_TypeDef* GPIOx, uint16_t pins);
+void GPIO_ResetBits(GPIO_TypeDef* GPIOx, uint16_t pins);
+
+void NVIC_PriorityGroupConfig(uint32_t group);
+void NVIC_Init(NVIC_InitTypeDef* init);
+void NVIC_SetPriority(IRQn_Type irq, uint32_t priority);
+
+void TIM_DeInit(TIM_TypeDef* TIMx);
+void TIM_TimeBaseInit(TIM_TypeDef* TIMx, TIM_TimeBaseInitTypeDef* init);
+void TIM_OC1Init(TIM_TypeDef* TIMx, TIM_OCInitTypeDef* init);
+void TIM_OC2Init(TIM_TypeDef* TIMx, TIM_OCInitTypeDef* init);
+void TIM_OC1PreloadConfig(TIM_TypeDef* TIMx, uint16_t preload);
+void TIM_OC2PreloadConfig(TIM_TypeDef* TIMx, uint16_t preload);
+void TIM_ARRPreloadConfig(TIM_TypeDef* TIMx, FunctionalState state);
+void TIM_ITConfig(TIM_TypeDef* TIMx, uint16_t it, FunctionalState state);
+void TIM_DMACmd(TIM_TypeDef* TIMx, uint16_t source, FunctionalState state);
+void TIM_CtrlPWMOutputs(TIM_TypeDef* TIMx, FunctionalState state);
+void TIM_Cmd(TIM_TypeDef* TIMx, FunctionalState state);
+void TIM_ClearFlag(TIM_TypeDef* TIMx, uint16_t flag);
+ITStatus TIM_GetITStatus(TIM_TypeDef* TIMx, uint16_t it);
+void TIM_ClearITPendingBit(TIM_TypeDef* TIMx, uint16_t it);
+
+void SPI_Init(SPI_TypeDef* SPIx, SPI_InitTypeDef* init);
+void SPI_Cmd(SPI_TypeDef* SPIx, FunctionalState state);
+void SPI_I2S_DMACmd(SPI_TypeDef* SPIx, uint16_t req, FunctionalState state);
+FlagStatus SPI_I2S_GetFlagStatus(SPI_TypeDef* SPIx, uint16_t flag);
+void SPI_I2S_SendData(SPI_TypeDef* SPIx, uint16_t data);
+
+void DMA_DeInit(DMA_Channel_TypeDef* DMAy_Channelx);
+void DMA_Init(DMA_Channel_TypeDef* DMAy_Channelx, DMA_InitTypeDef* init);
+void DMA_ITConfig(DMA_Channel_TypeDef* DMAy_Channelx, uint32_t it, FunctionalState state);
+void DMA_Cmd(DMA_Channel_TypeDef* DMAy_Channelx, FunctionalState state);
+FlagStatus DMA_GetFlagStatus(uint32_t flag);
+void DMA_ClearFlag(uint32_t flag);
+ITStatus DMA_GetITStatus(uint32_t it);
+void DMA_ClearITPendingBit(uint32_t it);
+
+#endif  /*  __STM32F10x_H  */